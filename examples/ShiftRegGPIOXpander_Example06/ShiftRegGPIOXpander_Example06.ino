@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example06.ino
+  * @brief  : Flush jitter benchmark of the ShiftRegGPIOXpander_ESP32 library hot paths placement
+  * 
+  * The example measures the time taken by digitalToggleSr() -a Main Buffer
+  * modification plus a full flush- while a second task keeps writing to the
+  * NVS flash partition through the Preferences library. Every flash write
+  * disables the flash cache, stalling any code executed from flash.
+  * 
+  * Build and run the example twice to compare both configurations:
+  * - Without build flags: the flushing code runs from flash, the maximum
+  * times show the stalls produced by the flash writes.
+  * - With the SRGX_IRAM_HOT_PATHS macro defined for the whole build -i.e.
+  * PlatformIO build_flags = -DSRGX_IRAM_HOT_PATHS-: the flushing code runs
+  * from IRAM, the maximum times stay close to the mean.
+  * 
+  * @note Defining the macro in the sketch is not enough, the library source
+  * files must be compiled with it.
+  * 
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url: 
+  * 
+  * Framework: Arduino
+  * Platform: ESP32
+  * 
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025 
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <Preferences.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 5 // Task priority level
+#define FlashWrtTskPrrtyLvl 4 // Task priority level
+#define SamplesQty 2000 // Toggles measured for each report
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+//================================================>> General use definitions END
+ 
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+//========================================>> General use function prototypes END
+ 
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void flashWrtTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+ 
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t flashWrtTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() { 
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+
+   // Create the flash writing task, the source of the flash cache disabling
+    xReturned = xTaskCreatePinnedToCore(
+       flashWrtTsk,  // Callback function/task to be called
+       "FlashWriteTask",  // Name of the task
+       4096,   // Stack size
+       NULL,  // Pointer to the parameters for the function to work with
+       FlashWrtTskPrrtyLvl, // Priority level given to the task
+       &flashWrtTskHndl, // Task handle
+       (ssdExecTskCore == 0)?1:0 // Run in the other core if it's a dual core mcu, the cache stalls affect both cores
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x02);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}  
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint8_t ds{33};
+   uint8_t sh_cp{26};
+   uint8_t st_cp{25};
+   uint8_t srQty{2};
+
+   uint8_t SRGXstrtngVal [2] {0x00, 0x00};
+
+   Serial.begin(115200);
+
+   ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+   srgx.begin(SRGXstrtngVal); 
+
+   Serial.println("Flush jitter benchmark");
+#if SRGX_IRAM_EN
+   Serial.println("Hot paths placement: IRAM (SRGX_IRAM_HOT_PATHS defined)");
+#else
+   Serial.println("Hot paths placement: flash (default)");
+#endif
+   Serial.println("====================================");
+
+   for(;;){
+      int64_t minTm{INT64_MAX};
+      int64_t maxTm{0};
+      int64_t ttlTm{0};
+
+      for(uint16_t smplInc{0}; smplInc < SamplesQty; smplInc++){
+         const int64_t strtTm{esp_timer_get_time()};
+
+         srgx.digitalToggleSr(0);
+         const int64_t elpsdTm{esp_timer_get_time() - strtTm};
+         
+         if(elpsdTm < minTm)
+            minTm = elpsdTm;
+         if(elpsdTm > maxTm)
+            maxTm = elpsdTm;
+         ttlTm += elpsdTm;
+         if((smplInc % 50) == 0)
+            vTaskDelay(1); // Let the flash writing task run
+      }
+      Serial.println("Toggle + flush time (us) min: " + String((int32_t)minTm) + " max: " + String((int32_t)maxTm) + " mean: " + String((float)ttlTm / SamplesQty) + " jitter: " + String((int32_t)(maxTm - minTm)));
+      vTaskDelay(1000);
+   }
+}
+
+void flashWrtTsk(void *pvParameters){
+   Preferences prefs;
+   uint32_t wrtCntr{0};
+
+   prefs.begin("SRGXBench", false);
+   for(;;){
+      prefs.putUInt("wrtCntr", wrtCntr++);   // Each NVS write erases or programs flash, disabling the flash cache
+      vTaskDelay(2);
+   }
+}
+
+//================================================>> General use functions BEGIN
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  * 
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {    
+   }
+   
+   return;
+ }
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,150 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example07.ino
+  * @brief  : Bulk sparse writes benchmark of the ShiftRegGPIOXpander_ESP32 library
+  * 
+  * The example compares the time taken to apply irregular updates of 8, 64
+  * and 256 pins by a loop of digitalWriteSr() invocations -two mutexes taking
+  * and a full flush for each pin- and by a single writeMany() invocation -one
+  * mutex taking, register merged writes and a single flush-. The latches and
+  * shift registers lines writes per update of both are counted on the host
+  * by the extras/host/tests/SRGXBulkWrtsTest.cpp test.
+  * 
+  * No hardware is needed to run the benchmark, the shift registers lines
+  * are driven anyway.
+  * 
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url: 
+  * 
+  * Framework: Arduino
+  * Platform: ESP32
+  * 
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025 
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 5 // Task priority level
+#define MaxUpdtsQty 256 // Longest pins list benchmarked
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+//================================================>> General use definitions END
+ 
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+//========================================>> General use function prototypes END
+ 
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+ 
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() { 
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}  
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint8_t ds{33};
+   uint8_t sh_cp{26};
+   uint8_t st_cp{25};
+   uint8_t srQty{4};
+
+   uint8_t SRGXstrtngVal [4] {0x00, 0x00, 0x00, 0x00};
+   static SRGXPinValue updts[MaxUpdtsQty];
+   const uint16_t updtsQtys[3]{8, 64, MaxUpdtsQty};
+
+   Serial.begin(115200);
+
+   ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+   srgx.begin(SRGXstrtngVal); 
+
+   for(uint16_t updtInc{0}; updtInc < MaxUpdtsQty; updtInc++){ // Irregular pins sequence, with alternating values
+      updts[updtInc].pin = (updtInc * 13 + 5) % (srgx.getMaxSRGXPin() + 1);
+      updts[updtInc].value = (updtInc % 3)?HIGH:LOW;
+   }
+
+   Serial.println("Bulk sparse writes benchmark");
+   Serial.println("====================================");
+
+   for(;;){
+      for(uint8_t qtyInc{0}; qtyInc < 3; qtyInc++){
+         const uint16_t updtsQty{updtsQtys[qtyInc]};
+         int64_t strtTm{esp_timer_get_time()};
+
+         for(uint16_t updtInc{0}; updtInc < updtsQty; updtInc++)
+            srgx.digitalWriteSr(updts[updtInc].pin, updts[updtInc].value);
+         const int64_t loopTm{esp_timer_get_time() - strtTm};
+
+         strtTm = esp_timer_get_time();
+         srgx.writeMany(updts, updtsQty);
+         const int64_t bulkTm{esp_timer_get_time() - strtTm};
+
+         Serial.println(String(updtsQty) + " updates -> digitalWriteSr() loop: " + String((int32_t)loopTm) + " us, writeMany(): " + String((int32_t)bulkTm) + " us");
+      }
+      Serial.println("------------------------------------");
+      vTaskDelay(5000);
+   }
+}
+
+//================================================>> General use functions BEGIN
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  * 
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {    
+   }
+   
+   return;
+ }
+//=========================================>> User Functions Implementations END
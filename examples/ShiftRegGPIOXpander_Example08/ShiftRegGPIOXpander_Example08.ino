@@ -0,0 +1,173 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example08.ino
+  * @brief  : Latched frames trace recorder example of the ShiftRegGPIOXpander_ESP32 library
+  *
+  * The example starts the trace recorder, lets two tasks modify the outputs
+  * for a while and then prints the trace recorder dump through the serial
+  * port in hexadecimal, together with the worst recording time added to the
+  * flushes.
+  *
+  * Copy the dump lines -between the BEGIN and END marks- to a text file and
+  * decode it in the host with the extras/SRGXTraceDecoder.py script:
+  *    python3 SRGXTraceDecoder.py dump.txt --elf <sketch .elf file>
+  *
+  * No hardware is needed to run the example, the shift registers lines
+  * are driven anyway.
+  *
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url:
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 5 // Task priority level
+#define BlinkTskPrrtyLvl 4 // Task priority level
+#define TraceRngSize 1024 // Trace recorder ring buffer size, in bytes
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+uint8_t ds{33};
+uint8_t sh_cp{26};
+uint8_t st_cp{25};
+uint8_t srQty{2};
+
+ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void blinkTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t blinkTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   static uint8_t dump[16 + 2 + TraceRngSize];
+   const SRGXPinValue pattern[4]{{0, HIGH}, {5, HIGH}, {0, LOW}, {5, LOW}};
+
+   Serial.begin(115200);
+
+   srgx.beginTrace(TraceRngSize); // Started before begin(), so the initial flush is recorded as well
+   srgx.begin();
+
+   xReturned = xTaskCreatePinnedToCore(
+      blinkTsk,  // Callback function/task to be called
+      "BlinkTask",  // Name of the task
+      2048,   // Stack size
+      NULL,  // Pointer to the parameters for the function to work with
+      BlinkTskPrrtyLvl, // Priority level given to the task
+      &blinkTskHndl, // Task handle
+      ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+   );
+   if(xReturned != pdPASS)
+      Error_Handler(0x02);
+
+   Serial.println("Trace recorder example");
+   Serial.println("====================================");
+   Serial.println("Main task handle: 0x" + String((uint32_t)(uintptr_t)mainCtrlTskHndl, HEX) + ", blink task handle: 0x" + String((uint32_t)(uintptr_t)blinkTskHndl, HEX));
+
+   for(;;){
+      for(uint8_t stepInc{0}; stepInc < 20; stepInc++){
+         srgx.writeMany(&pattern[(stepInc % 2) * 2], 2);
+         vTaskDelay(100);
+      }
+      const uint32_t dumpLen{srgx.dumpTrace(dump, sizeof(dump))};
+
+      Serial.println("Worst recording time: " + String(srgx.getTraceWrstCycles()) + " CPU cycles, worst flush time: " + String(srgx.getFlushWrstTm()) + " us");
+      Serial.println("---- SRGT dump BEGIN ----");
+      for(uint32_t byteInc{0}; byteInc < dumpLen; byteInc++){
+         if(dump[byteInc] < 0x10)
+            Serial.print("0");
+         Serial.print(dump[byteInc], HEX);
+         if((byteInc % 32) == 31)
+            Serial.println();
+      }
+      Serial.println();
+      Serial.println("---- SRGT dump END ----");
+      vTaskDelay(10000);
+   }
+}
+
+void blinkTsk(void *pvParameters){
+   for(;;){
+      srgx.digitalToggleSr(12);
+      vTaskDelay(250);
+   }
+}
+
+//================================================>> General use functions BEGIN
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  *
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {
+   }
+
+   return;
+ }
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,323 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example09.ino
+  * @brief  : Public API benchmark suite of the ShiftRegGPIOXpander_ESP32 library
+  *
+  * The example measures every public writing and reading method of the
+  * ShiftRegGPIOXpander and SRGXVPort classes, for chains of 1, 2, 4, 8, 16
+  * and 32 shift registers, invoked concurrently by 1, 2, 4 and 8 tasks
+  * sharing the same object. For each combination it reports:
+  * - The time per operation in nanoseconds, as throughput: elapsed time /
+  * total operations executed by all the tasks.
+  * - The flushes per operation, counted by the trace recorder (see
+  * ShiftRegGPIOXpander::beginTrace()) in a second pass, so the recorder
+  * does not affect the times measured.
+  * The shift registers lines GPIO writes per operation are not estimated
+  * here, they are counted by the extras/host host build, which runs the same
+  * operations against counting GPIO and FreeRTOS stubs
+  * (make -C extras/host test).
+  *
+  * The results are printed as CSV lines prefixed with "SRGXBENCH," so they
+  * can be filtered out of the serial port log and compared against a
+  * previous run with the extras/SRGXBenchCompare.py script, catching
+  * regressions in the shifting or locking paths before they reach the
+  * production hardware.
+  *
+  * No hardware is needed to run the benchmark, the shift registers lines
+  * are driven anyway. A complete run takes several minutes.
+  *
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url:
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define BenchTskPrrtyLvl 5 // Task priority level
+#define MaxBenchTsksQty 8  // Highest contention level benchmarked
+#define TraceRngSize 512   // Trace recorder ring buffer size, the evicted records are counted as well
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+/**
+ * @brief Objects and data used by the benchmarked operations.
+ */
+struct BenchObjs{
+   ShiftRegGPIOXpander* srgxPtr;
+   SRGXVPort* portPtr;  // Pins 0 to 3, shared
+   SRGXVPort* exclPortPtr; // Pins 4 to 7, reserved for it's exclusive use
+   uint8_t msk[32];
+   uint8_t vals[32];
+   SRGXPinValue items[8];
+   uint8_t pins[8];
+};
+
+/**
+ * @brief A benchmarked operation, opIdx is the operation number inside the task's run.
+ */
+struct BenchOp{
+   const char* name;
+   void (*opFn)(BenchObjs &objs, const uint32_t &opIdx);
+};
+
+/**
+ * @brief Pin used by the opIdx operation, spread all over the chain avoiding the exclusive port pins.
+ */
+uint8_t benchPin(BenchObjs &objs, const uint32_t &opIdx){
+   uint8_t pin = (opIdx * 5) % (objs.srgxPtr->getMaxSRGXPin() + 1);
+
+   if((pin >= 4) && (pin < 8))
+      pin -= 4;
+
+   return pin;
+}
+
+const BenchOp benchOps[]{
+   {"digitalWriteSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSr(benchPin(o, i), i & 0x01);}},
+   {"digitalWriteSr(SRGXPinDsc)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSr(SRGXPin<1, 3>(), i & 0x01);}},
+   {"digitalToggleSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSr(benchPin(o, i));}},
+   {"digitalReadSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalReadSr(benchPin(o, i));}},
+   {"digitalReadSgmntSr", [](BenchObjs &o, const uint32_t &i){uint16_t sgmnt{0}; o.srgxPtr->digitalReadSgmntSr(0, 8, sgmnt);}},
+   {"setBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->setBit(benchPin(o, i));}},
+   {"resetBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->resetBit(benchPin(o, i));}},
+   {"flipBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->flipBit(benchPin(o, i));}},
+   {"digitalWriteSrAllSet", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrAllSet();}},
+   {"digitalWriteSrAllReset", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrAllReset();}},
+   {"digitalToggleSrAll", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSrAll();}},
+   {"digitalWriteSrMaskSet", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrMaskSet(o.msk);}},
+   {"digitalWriteSrMaskReset", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrMaskReset(o.msk);}},
+   {"digitalToggleSrMask", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSrMask(o.msk);}},
+   {"stampOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampOverMain(o.vals);}},
+   {"stampMaskOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampMaskOverMain(o.msk, o.vals);}},
+   {"stampSgmntOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampSgmntOverMain(o.vals, 0, 4);}},
+   {"digitalWriteSrToAux+moveAuxToMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrToAux(benchPin(o, i), HIGH); o.srgxPtr->moveAuxToMain();}},
+   {"copyMainToAux+discardAux", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->copyMainToAux(); o.srgxPtr->discardAux();}},
+   {"writeMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->writeMany(o.items, 8);}},
+   {"setMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->setMany(o.pins, 8);}},
+   {"resetMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->resetMany(o.pins, 8);}},
+   {"toggleMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->toggleMany(o.pins, 8);}},
+   {"writeAsync+wait", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->writeAsync(benchPin(o, i), i & 0x01).wait();}},
+   {"digitalWriteSrToSnapshot+moveSnapshotToMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrToSnapshot(0, benchPin(o, i), HIGH); o.srgxPtr->moveSnapshotToMain(0);}},
+   {"SRGXVPort::writePort", [](BenchObjs &o, const uint32_t &i){o.portPtr->writePort(i & 0x0F);}},
+   {"SRGXVPort::readPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->readPort();}},
+   {"SRGXVPort::digitalWriteSr", [](BenchObjs &o, const uint32_t &i){o.portPtr->digitalWriteSr(i % 4, i & 0x01);}},
+   {"SRGXVPort::setBit", [](BenchObjs &o, const uint32_t &i){o.portPtr->setBit(i % 4);}},
+   {"SRGXVPort::incPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->incPort();}},
+   {"SRGXVPort::xorPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->xorPort(0x05);}},
+   {"SRGXVPort::cmpXchgPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->cmpXchgPort(o.portPtr->readPort(), i & 0x0F);}},
+   {"SRGXVPort::rotLPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->rotLPort();}},
+   {"SRGXVPort::writePort(exclusive)", [](BenchObjs &o, const uint32_t &i){o.exclPortPtr->writePort(i & 0x0F);}},
+   {"SRGXVPort::writePortAsync+wait", [](BenchObjs &o, const uint32_t &i){o.portPtr->writePortAsync(i & 0x0F).wait();}},
+};
+const uint8_t benchOpsQty{sizeof(benchOps) / sizeof(benchOps[0])};
+
+const uint8_t srQtys[]{1, 2, 4, 8, 16, 32};
+const uint8_t tsksQtys[]{1, 2, 4, 8};
+
+BenchObjs benchObjs;
+const BenchOp* curOpPtr{nullptr};
+uint32_t curOpsQty{0};  // Operations executed by each task
+SemaphoreHandle_t benchDoneSmphr{NULL};
+static uint8_t dump[16 + 32 + TraceRngSize];
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+uint32_t countFlushes(ShiftRegGPIOXpander &srgx);
+int64_t runBench(const uint8_t &tsksQty);
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void benchTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t benchTskHndl[MaxBenchTsksQty] {};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint8_t ds{33};
+   uint8_t sh_cp{26};
+   uint8_t st_cp{25};
+
+   Serial.begin(115200);
+
+   benchDoneSmphr = xSemaphoreCreateCounting(MaxBenchTsksQty, 0);
+   if(benchDoneSmphr == NULL)
+      Error_Handler(0x02);
+   for(uint8_t tskInc{0}; tskInc < MaxBenchTsksQty; tskInc++){
+      xReturned = xTaskCreatePinnedToCore(
+         benchTsk,  // Callback function/task to be called
+         "BenchTask",  // Name of the task
+         3072,   // Stack size
+         NULL,  // Pointer to the parameters for the function to work with
+         BenchTskPrrtyLvl, // Priority level given to the task
+         &benchTskHndl[tskInc], // Task handle
+         tskNO_AFFINITY // Both cores compete for the object
+      );
+      if(xReturned != pdPASS)
+         Error_Handler(0x03);
+   }
+
+   for(;;){
+      Serial.println("Public API benchmark suite");
+      Serial.println("SRGXBENCH,method,srQty,tasks,ops,ns_per_op,flushes_per_op");
+      for(uint8_t srQtyIdx{0}; srQtyIdx < sizeof(srQtys); srQtyIdx++){
+         const uint8_t srQty{srQtys[srQtyIdx]};
+         ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+         srgx.begin();
+         srgx.beginSnapshots(1);
+         SRGXVPort port{srgx.createSRGXVPort(0, 4)};
+         SRGXVPort exclPort{srgx.createSRGXVPort(4, 4)};
+         port.begin(0);
+         exclPort.begin(0);
+         exclPort.reservePins();
+
+         benchObjs.srgxPtr = &srgx;
+         benchObjs.portPtr = &port;
+         benchObjs.exclPortPtr = &exclPort;
+         for(uint8_t idx{0}; idx < 32; idx++){
+            benchObjs.msk[idx] = (idx == 0)?0x0F:0x5A;   // The exclusive port pins are left out of the masks
+            benchObjs.vals[idx] = 0xA5 ^ idx;
+         }
+         for(uint8_t idx{0}; idx < 8; idx++){
+            benchObjs.pins[idx] = benchPin(benchObjs, idx * 7 + 1);
+            benchObjs.items[idx] = SRGXPinValue{benchObjs.pins[idx], static_cast<uint8_t>(idx & 0x01)};
+         }
+
+         for(uint8_t opIdx{0}; opIdx < benchOpsQty; opIdx++){
+            for(uint8_t tsksQtyIdx{0}; tsksQtyIdx < sizeof(tsksQtys); tsksQtyIdx++){
+               const uint8_t tsksQty{tsksQtys[tsksQtyIdx]};
+
+               curOpPtr = &benchOps[opIdx];
+               curOpsQty = 16 + (256 / srQty) / tsksQty;   // Similar run times for every chain length and contention level
+               const uint32_t totOpsQty{(uint32_t)tsksQty * curOpsQty};
+               const int64_t elapsedUs{runBench(tsksQty)};  // Timed pass
+
+               srgx.beginTrace(TraceRngSize);   // Flushes counting pass
+               runBench(tsksQty);
+               const uint32_t flshsQty{countFlushes(srgx)};
+               srgx.endTrace();
+
+               const float flshsPerOp{(float)flshsQty / totOpsQty};
+               Serial.printf("SRGXBENCH,%s,%u,%u,%lu,%lu,%.3f\n", curOpPtr->name, srQty, tsksQty, (unsigned long)totOpsQty, (unsigned long)((elapsedUs * 1000) / totOpsQty), flshsPerOp);
+            }
+         }
+         exclPort.releasePins();
+      }
+      Serial.println("SRGXBENCH,done");
+      vTaskDelay(60000);
+   }
+}
+
+void benchTsk(void *pvParameters){
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      for(uint32_t opInc{0}; opInc < curOpsQty; opInc++)
+         curOpPtr->opFn(benchObjs, opInc);
+      xSemaphoreGive(benchDoneSmphr);
+   }
+}
+
+//================================================>> General use functions BEGIN
+/**
+ * @brief Runs the current operation in tsksQty tasks at once, returns the elapsed time in microseconds.
+ */
+int64_t runBench(const uint8_t &tsksQty){
+   const int64_t strtTm{esp_timer_get_time()};
+
+   for(uint8_t tskInc{0}; tskInc < tsksQty; tskInc++)
+      xTaskNotifyGive(benchTskHndl[tskInc]);
+   for(uint8_t tskInc{0}; tskInc < tsksQty; tskInc++)
+      xSemaphoreTake(benchDoneSmphr, portMAX_DELAY);
+
+   return esp_timer_get_time() - strtTm;
+}
+
+/**
+ * @brief Returns the quantity of flushes recorded since the trace recorder was started: the records in the dump plus the ones evicted.
+ */
+uint32_t countFlushes(ShiftRegGPIOXpander &srgx){
+   const uint32_t dumpLen{srgx.dumpTrace(dump, sizeof(dump))};
+   uint32_t recsLen{0};
+   uint32_t result{0};
+
+   if(dumpLen > 0){
+      memcpy(&recsLen, dump + 8, 4);
+      memcpy(&result, dump + 12, 4);
+      for(uint32_t recOffset{16 + (uint32_t)dump[5]}; (recOffset + 10) <= (16 + dump[5] + recsLen); recOffset += 10 + 2 * dump[recOffset + 9])
+         result++;
+   }
+
+   return result;
+}
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  *
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {
+   }
+
+   return;
+ }
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,581 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example10.ino
+  * @brief  : Concurrency stress test and latched frames checker of the ShiftRegGPIOXpander_ESP32 library
+  *
+  * The example runs rounds of randomized operations mixes from several tasks
+  * -on both cores- over a single ShiftRegGPIOXpander object, and checks the
+  * results against a sequential model of each task:
+  * - Each task owns one shift register: pins 0 to 3 are written through the
+  * ShiftRegGPIOXpander methods -single pin, pin descriptor, mask, stamp, bulk,
+  * asynchronous, Auxiliary Buffer and snapshot slot operations- and pins 4 to 7
+  * through a SRGXVPort -exclusive for the odd tasks, so they are written
+  * lock-free-, every mutator writing the pins of a single shift register is in
+  * the mix.
+  * - After every operation the task reads it's register back from the Main
+  * Buffer, it must hold the value of the task's model: any difference is a
+  * lost update.
+  * - Every frame latched during the round is captured by the trace recorder
+  * (see ShiftRegGPIOXpander::beginTrace()). Projected over each task's
+  * register, the sequence of latched frames must be a subsequence of the
+  * values the task's model took, in order: a value never set, or set
+  * earlier than an already latched one, is a linearizability violation.
+  * - The last frame latched must hold the final value of every task.
+  *
+  * Each round reports the throughput, the mean and worst operation latency,
+  * and the estimated lock waiting time: the mean latency under contention
+  * minus the mean latency of the same mix executed by a single task.
+  *
+  * @note The Auxiliary Buffer is shared by the tasks: a pin staged by a task
+  * might be moved to the Main Buffer by any other task's operation, so the
+  * value staged is added to the task's model history when staged. A snapshot
+  * slot commit writes the whole chain image, so each task stages and commits
+  * it's own slot with the operations gate closed -no other task's operation in
+  * progress, see gateTake()-, mixed with asynchronous writes queued before the
+  * slot is copied and after it's staged. The other whole chain operations
+  * -digitalWriteSrAllSet(), stampOverMain()-, copyMainToAux(true) and
+  * discardAux() overwrite or drop other tasks' pins by definition and are left
+  * out of the mix. The same mix is interleaved step by step on a host computer
+  * by extras/host/tests/SRGXLinearizabilityTest.cpp, where the snapshot slots
+  * sequences are interleaved with the other tasks' operations too.
+  *
+  * No hardware is needed to run the example, the shift registers lines
+  * are driven anyway.
+  *
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url:
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 4 // Task priority level
+#define StressTskPrrtyLvl 5 // Task priority level
+#define StressTsksQty 8 // Tasks stressing the object, one shift register each
+#define OpsPerRound 200 // Operations executed by each task in a round
+#define TraceRngSize 16384 // Trace recorder ring buffer size, the frames evicted are folded into the dump base frame
+#define OpsMixQty 33 // Operations in the mix, see stressOp()
+#define ChainOpsFrst 31 // First of the whole chain operations of the mix, executed with the operations gate closed
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+uint8_t ds{33};
+uint8_t sh_cp{26};
+uint8_t st_cp{25};
+
+ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, StressTsksQty);
+
+/**
+ * @brief State of each stressing task for the current round.
+ */
+struct StressTskSt{
+   SRGXVPort* portPtr;  // Pins 4 to 7 of the task's shift register
+   uint32_t rndSeed;
+   uint8_t model;   // Value the task's shift register must hold
+   uint8_t hist[2 * OpsPerRound + 1];   // Values taken by the model, hist[0] is the value at the round start, up to two per operation
+   uint16_t histQty;
+   uint32_t lostUpdtsQty;  // Main Buffer read backs not matching the model
+   uint64_t latencySumUs;
+   uint32_t latencyWrstUs;
+};
+
+StressTskSt stressTsks[StressTsksQty]{};
+uint8_t runTsksQty{StressTsksQty};  // Tasks started in the round, 1 for the calibration round
+SemaphoreHandle_t roundDoneSmphr{NULL};
+SemaphoreHandle_t opsGateSmphr{NULL}; // A token for each task, see gateTake()
+SemaphoreHandle_t chainOpsMtx{NULL};
+static uint8_t dump[16 + StressTsksQty + TraceRngSize];
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+uint32_t checkFrames(uint32_t &framesQty);
+void gateGive(const bool &chainOp);
+void gateTake(const bool &chainOp);
+int64_t runRound(const uint8_t &tsksQty, const uint32_t &roundNmbr);
+void stressOp(const uint8_t &tskIdx, const uint32_t &rnd);
+uint32_t xorShift(uint32_t &seed);
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+void stressTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+TaskHandle_t stressTskHndl[StressTsksQty] {};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint32_t roundNmbr{0};
+
+   Serial.begin(115200);
+
+   srgx.begin();
+   srgx.beginSnapshots(StressTsksQty);  // A slot for each task, the slot index is the task's index
+   roundDoneSmphr = xSemaphoreCreateCounting(StressTsksQty, 0);
+   opsGateSmphr = xSemaphoreCreateCounting(StressTsksQty, StressTsksQty);
+   chainOpsMtx = xSemaphoreCreateMutex();
+   if((roundDoneSmphr == NULL) || (opsGateSmphr == NULL) || (chainOpsMtx == NULL))
+      Error_Handler(0x02);
+   for(uint8_t tskIdx{0}; tskIdx < StressTsksQty; tskIdx++){
+      stressTsks[tskIdx].portPtr = new SRGXVPort(srgx.createSRGXVPort(tskIdx * 8 + 4, 4));
+      stressTsks[tskIdx].portPtr->begin(0);
+      if(tskIdx % 2)
+         stressTsks[tskIdx].portPtr->reservePins();   // Lock-free writes
+      xReturned = xTaskCreatePinnedToCore(
+         stressTsk,  // Callback function/task to be called
+         "StressTask",  // Name of the task
+         3072,   // Stack size
+         (void*)(uintptr_t)tskIdx,  // Index of the task
+         StressTskPrrtyLvl, // Priority level given to the task
+         &stressTskHndl[tskIdx], // Task handle
+         tskNO_AFFINITY // Both cores compete for the object
+      );
+      if(xReturned != pdPASS)
+         Error_Handler(0x03);
+   }
+
+   Serial.println("Concurrency stress test and latched frames checker");
+   Serial.println("====================================");
+   for(;;){
+      uint32_t framesQty{0};
+
+      runRound(1, roundNmbr++);  // Calibration round, no contention
+      const float soloLatencyUs{(float)stressTsks[0].latencySumUs / OpsPerRound};
+      const uint32_t soloViolsQty{checkFrames(framesQty) + stressTsks[0].lostUpdtsQty};
+
+      const int64_t roundUs{runRound(StressTsksQty, roundNmbr++)};
+      uint64_t latencySumUs{0};
+      uint32_t latencyWrstUs{0};
+      uint32_t lostUpdtsQty{0};
+      const uint32_t violsQty{checkFrames(framesQty)};
+
+      for(uint8_t tskIdx{0}; tskIdx < StressTsksQty; tskIdx++){
+         latencySumUs += stressTsks[tskIdx].latencySumUs;
+         lostUpdtsQty += stressTsks[tskIdx].lostUpdtsQty;
+         if(stressTsks[tskIdx].latencyWrstUs > latencyWrstUs)
+            latencyWrstUs = stressTsks[tskIdx].latencyWrstUs;
+      }
+      const float meanLatencyUs{(float)latencySumUs / (StressTsksQty * OpsPerRound)};
+
+      Serial.printf("Round %lu: %u tasks x %u ops in %lu us -> %.0f ops/s\n", (unsigned long)roundNmbr / 2, StressTsksQty, OpsPerRound, (unsigned long)roundUs, (StressTsksQty * OpsPerRound * 1000000.0) / roundUs);
+      Serial.printf("   Latency mean %.1f us, worst %lu us, single task mean %.1f us -> estimated lock wait %.1f us/op\n", meanLatencyUs, (unsigned long)latencyWrstUs, soloLatencyUs, meanLatencyUs - soloLatencyUs);
+      Serial.printf("   Frames checked %lu, lost updates %lu, frame violations %lu, calibration round violations %lu -> %s\n", (unsigned long)framesQty, (unsigned long)lostUpdtsQty, (unsigned long)violsQty, (unsigned long)soloViolsQty, ((lostUpdtsQty + violsQty + soloViolsQty) == 0)?"PASS":"FAIL");
+      vTaskDelay(1000);
+   }
+}
+
+void stressTsk(void *pvParameters){
+   const uint8_t tskIdx{(uint8_t)(uintptr_t)pvParameters};
+   StressTskSt &tskSt{stressTsks[tskIdx]};
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      for(uint16_t opInc{0}; opInc < OpsPerRound; opInc++){
+         uint16_t rdBack{0};
+         const uint32_t rnd{xorShift(tskSt.rndSeed)};
+         const bool chainOp{((rnd >> 16) % OpsMixQty) >= ChainOpsFrst};
+
+         gateTake(chainOp);
+         const int64_t strtTm{esp_timer_get_time()};
+
+         stressOp(tskIdx, rnd);
+         const uint32_t latencyUs{(uint32_t)(esp_timer_get_time() - strtTm)};
+
+         tskSt.latencySumUs += latencyUs;
+         if(latencyUs > tskSt.latencyWrstUs)
+            tskSt.latencyWrstUs = latencyUs;
+         tskSt.hist[++tskSt.histQty] = tskSt.model;
+         srgx.digitalReadSgmntSr(tskIdx * 8, 8, rdBack);
+         if((uint8_t)rdBack != tskSt.model){
+            tskSt.lostUpdtsQty++;
+            tskSt.model = (uint8_t)rdBack;   // Resynchronized, so a single lost update is not counted again by every following operation
+            tskSt.hist[tskSt.histQty] = tskSt.model;
+         }
+         gateGive(chainOp);
+      }
+      srgx.digitalWriteSr(tskIdx * 8, tskSt.model & 0x01); // A synchronous flush after any asynchronous write of the round
+      xSemaphoreGive(roundDoneSmphr);
+   }
+}
+
+//================================================>> General use functions BEGIN
+/**
+ * @brief Executes a random operation over the task's shift register, and updates the task's model accordingly.
+ */
+void stressOp(const uint8_t &tskIdx, const uint32_t &rnd){
+   StressTskSt &tskSt{stressTsks[tskIdx]};
+   const uint8_t basePin{(uint8_t)(tskIdx * 8)};
+   const uint8_t pin{(uint8_t)(rnd & 0x03)};  // Pins 0 to 3, through the ShiftRegGPIOXpander methods
+   const uint8_t val{(uint8_t)((rnd >> 2) & 0x0F)};
+   const uint8_t pinMsk{(uint8_t)(0x01 << pin)};
+   const uint8_t port{(uint8_t)(tskSt.model >> 4)};
+   uint8_t msk[StressTsksQty]{};
+   uint8_t vals[StressTsksQty]{};
+
+   msk[tskIdx] = (rnd >> 6) & 0x0F;
+   vals[tskIdx] = (rnd >> 10) & 0x0F;
+   switch((rnd >> 16) % OpsMixQty){
+      case 0:
+         srgx.digitalWriteSr(basePin + pin, val & 0x01);
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         break;
+      case 1:
+         srgx.digitalToggleSr(basePin + pin);
+         tskSt.model ^= pinMsk;
+         break;
+      case 2:
+         srgx.setBit(basePin + pin);
+         tskSt.model |= pinMsk;
+         break;
+      case 3:
+         srgx.resetBit(basePin + pin);
+         tskSt.model &= ~pinMsk;
+         break;
+      case 4:
+         srgx.flipBit(basePin + pin);
+         tskSt.model ^= pinMsk;
+         break;
+      case 5:
+         srgx.digitalWriteSrMaskSet(msk);
+         tskSt.model |= msk[tskIdx];
+         break;
+      case 6:
+         srgx.digitalWriteSrMaskReset(msk);
+         tskSt.model &= ~msk[tskIdx];
+         break;
+      case 7:
+         srgx.digitalToggleSrMask(msk);
+         tskSt.model ^= msk[tskIdx];
+         break;
+      case 8:
+         srgx.stampMaskOverMain(msk, vals);
+         tskSt.model = (tskSt.model & ~msk[tskIdx]) | (vals[tskIdx] & msk[tskIdx]);
+         break;
+      case 9:{
+         uint8_t sgmnt[2]{val, 0x00};
+
+         srgx.stampSgmntOverMain(sgmnt, basePin, 4);
+         tskSt.model = (tskSt.model & 0xF0) | val;
+         break;
+      }
+      case 10:{
+         const SRGXPinValue items[2]{{(uint8_t)(basePin + pin), (uint8_t)(val & 0x01)}, {(uint8_t)(basePin + ((pin + 1) & 0x03)), (uint8_t)(val & 0x02)}};
+
+         srgx.writeMany(items, 2);
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         tskSt.model = (val & 0x02)?(tskSt.model | (0x01 << ((pin + 1) & 0x03))):(tskSt.model & ~(0x01 << ((pin + 1) & 0x03)));
+         break;
+      }
+      case 11:{
+         const uint8_t pins[2]{(uint8_t)(basePin + pin), (uint8_t)(basePin + ((pin + 2) & 0x03))};
+
+         srgx.toggleMany(pins, 2);
+         tskSt.model ^= pinMsk | (0x01 << ((pin + 2) & 0x03));
+         break;
+      }
+      case 12:{
+         const uint8_t pins[2]{(uint8_t)(basePin + pin), (uint8_t)(basePin + ((pin + 1) & 0x03))};
+
+         srgx.setMany(pins, 2);
+         tskSt.model |= pinMsk | (0x01 << ((pin + 1) & 0x03));
+         break;
+      }
+      case 13:{
+         const uint8_t pins[2]{(uint8_t)(basePin + pin), (uint8_t)(basePin + ((pin + 3) & 0x03))};
+
+         srgx.resetMany(pins, 2);
+         tskSt.model &= ~(pinMsk | (0x01 << ((pin + 3) & 0x03)));
+         break;
+      }
+      case 14:{
+         SRGXAsyncHndl asyncHndl{srgx.writeAsync(basePin + pin, val & 0x01)};
+
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         if(val & 0x02)
+            asyncHndl.wait();
+         break;
+      }
+      case 15:{
+         SRGXAsyncHndl asyncHndl{srgx.stampAsync(msk, vals)};
+
+         tskSt.model = (tskSt.model & ~msk[tskIdx]) | (vals[tskIdx] & msk[tskIdx]);
+         if(val & 0x02)
+            asyncHndl.wait();
+         break;
+      }
+      case 16:
+         srgx.digitalWriteSr(SRGXPinDsc{tskIdx, pinMsk, StressTsksQty}, val & 0x01);
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         break;
+      case 17:
+         tskSt.portPtr->writePort(val);
+         tskSt.model = (tskSt.model & 0x0F) | (val << 4);
+         break;
+      case 18:
+         tskSt.portPtr->xorPort(val);
+         tskSt.model ^= (val << 4);
+         break;
+      case 19:
+         tskSt.portPtr->incPort();
+         tskSt.model = (tskSt.model & 0x0F) | (((port + 1) & 0x0F) << 4);
+         break;
+      case 20:
+         tskSt.portPtr->orPort(val);
+         tskSt.model |= (val << 4);
+         break;
+      case 21:
+         tskSt.portPtr->andPort(val);
+         tskSt.model &= 0x0F | (val << 4);
+         break;
+      case 22:
+         tskSt.portPtr->decPort();
+         tskSt.model = (tskSt.model & 0x0F) | (((port - 1) & 0x0F) << 4);
+         break;
+      case 23:
+         tskSt.portPtr->rotLPort();
+         tskSt.model = (tskSt.model & 0x0F) | ((((port << 1) | (port >> 3)) & 0x0F) << 4);
+         break;
+      case 24:
+         tskSt.portPtr->shftRPort();
+         tskSt.model = (tskSt.model & 0x0F) | ((port >> 1) << 4);
+         break;
+      case 25:
+         tskSt.portPtr->cmpXchgPort(port, val);   // No other task writes the port, the exchange always succeeds
+         tskSt.model = (tskSt.model & 0x0F) | (val << 4);
+         break;
+      case 26:
+         tskSt.portPtr->flipBit(pin);
+         tskSt.model ^= (pinMsk << 4);
+         break;
+      case 27:{
+         SRGXAsyncHndl asyncHndl{tskSt.portPtr->writePortAsync(val)};
+
+         tskSt.model = (tskSt.model & 0x0F) | (val << 4);
+         if(val & 0x02)
+            asyncHndl.wait();
+         break;
+      }
+      case 28:
+         srgx.digitalWriteSrToAux(basePin + pin, val & 0x01);
+         srgx.moveAuxToMain();   // Might find the Auxiliary Buffer already moved by other task's operation
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         break;
+      case 29:
+         srgx.digitalToggleSrToAux(basePin + pin);
+         tskSt.model ^= pinMsk;
+         tskSt.hist[++tskSt.histQty] = tskSt.model;   // The staged value is latched by the Auxiliary Buffer move, before the last write
+         srgx.digitalWriteSr(basePin + ((pin + 1) & 0x03), val & 0x01);
+         tskSt.model = (val & 0x01)?(tskSt.model | (0x01 << ((pin + 1) & 0x03))):(tskSt.model & ~(0x01 << ((pin + 1) & 0x03)));
+         break;
+      case 30:
+         srgx.copyMainToAux(false); // Fails harmlessly if other task's Auxiliary Buffer exists
+         srgx.digitalWriteSrToAux(basePin + pin, val & 0x01);
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         if(srgx.digitalReadSr(basePin + pin) != (val & 0x01))  // The reading moves the Auxiliary Buffer
+            tskSt.lostUpdtsQty++;
+         break;
+      case 31:{   // The gate is closed, the empty slot is staged with the current value of every task
+         const uint8_t slotVal{(uint8_t)((val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk))};
+
+         srgx.digitalWriteSrToSnapshot(tskIdx, basePin + pin, val & 0x01);
+         srgx.writeAsync(basePin + pin, !(val & 0x01));  // Queued after the staging, superseded by the commit
+         tskSt.model = (val & 0x01)?(tskSt.model & ~pinMsk):(tskSt.model | pinMsk);
+         tskSt.hist[++tskSt.histQty] = tskSt.model;   // Might be latched by the flushing task before the commit
+         srgx.moveSnapshotToMain(tskIdx);
+         tskSt.model = slotVal;
+         break;
+      }
+      case 32:   // The gate is closed, the asynchronous write queued before the copy is included in the slot
+         srgx.writeAsync(basePin + pin, val & 0x01);
+         tskSt.model = (val & 0x01)?(tskSt.model | pinMsk):(tskSt.model & ~pinMsk);
+         tskSt.hist[++tskSt.histQty] = tskSt.model;   // Might be latched by the flushing task before the commit
+         srgx.copyMainToSnapshot(tskIdx);
+         srgx.stampMaskOverSnapshot(tskIdx, msk, vals);
+         srgx.moveSnapshotToMain(tskIdx, val & 0x08);
+         if(val & 0x08)
+            srgx.discardSnapshot(tskIdx); // The slot kept is emptied, every sequence starts with an empty slot
+         tskSt.model = (tskSt.model & ~msk[tskIdx]) | (vals[tskIdx] & msk[tskIdx]);
+         break;
+   }
+
+   return;
+}
+
+/**
+ * @brief Gives back the operations gate tokens taken by gateTake().
+ */
+void gateGive(const bool &chainOp){
+   for(uint8_t tknInc{0}; tknInc < (chainOp?StressTsksQty:1); tknInc++)
+      xSemaphoreGive(opsGateSmphr);
+   if(chainOp)
+      xSemaphoreGive(chainOpsMtx);
+
+   return;
+}
+
+/**
+ * @brief Takes the operations gate: a single register operation takes a token, a whole chain operation takes every token, so no other task's operation is in progress during it.
+ */
+void gateTake(const bool &chainOp){
+   if(chainOp){
+      xSemaphoreTake(chainOpsMtx, portMAX_DELAY);  // A single task collects the tokens at a time, so no two tasks hold part of them
+      for(uint8_t tknInc{0}; tknInc < StressTsksQty; tknInc++)
+         xSemaphoreTake(opsGateSmphr, portMAX_DELAY);
+   }
+   else
+      xSemaphoreTake(opsGateSmphr, portMAX_DELAY);
+
+   return;
+}
+
+/**
+ * @brief Runs a round with tsksQty tasks, returns the round duration in microseconds.
+ */
+int64_t runRound(const uint8_t &tsksQty, const uint32_t &roundNmbr){
+   int64_t strtTm{0};
+
+   srgx.endTrace();
+   srgx.beginTrace(TraceRngSize);
+   runTsksQty = tsksQty;
+   for(uint8_t tskIdx{0}; tskIdx < StressTsksQty; tskIdx++){
+      uint16_t rdBack{0};
+      StressTskSt &tskSt{stressTsks[tskIdx]};
+
+      srgx.digitalReadSgmntSr(tskIdx * 8, 8, rdBack);
+      tskSt.model = (uint8_t)rdBack;
+      tskSt.hist[0] = tskSt.model;
+      tskSt.histQty = 0;
+      tskSt.rndSeed = (roundNmbr * StressTsksQty + tskIdx) * 2654435761UL + 1;
+      tskSt.lostUpdtsQty = 0;
+      tskSt.latencySumUs = 0;
+      tskSt.latencyWrstUs = 0;
+   }
+   strtTm = esp_timer_get_time();
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++)
+      xTaskNotifyGive(stressTskHndl[tskIdx]);
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++)
+      xSemaphoreTake(roundDoneSmphr, portMAX_DELAY);
+   strtTm = esp_timer_get_time() - strtTm;
+   vTaskDelay(10);   // Let any pending asynchronous flush finish
+
+   return strtTm;
+}
+
+/**
+ * @brief Replays the frames latched in the round, checking them against the tasks' models histories. Returns the quantity of violations found.
+ */
+uint32_t checkFrames(uint32_t &framesQty){
+   const uint32_t dumpLen{srgx.dumpTrace(dump, sizeof(dump))};
+   uint8_t frame[StressTsksQty];
+   uint16_t matchIdx[StressTsksQty]{};
+   uint32_t recsLen{0};
+   uint32_t result{0};
+
+   framesQty = 0;
+   if(dumpLen == 0)
+      return 1;
+   memcpy(&recsLen, dump + 8, 4);
+   memcpy(frame, dump + 16, StressTsksQty);
+   for(uint32_t recOffset{16 + StressTsksQty}; (recOffset + 10) <= (16 + StressTsksQty + recsLen); recOffset += 10 + 2 * dump[recOffset + 9]){
+      for(uint8_t diffInc{0}; diffInc < dump[recOffset + 9]; diffInc++)
+         frame[dump[recOffset + 10 + 2 * diffInc]] ^= dump[recOffset + 11 + 2 * diffInc];
+      framesQty++;
+      for(uint8_t tskIdx{0}; tskIdx < StressTsksQty; tskIdx++){   // The latched value must be the current or a later value of the task's model
+         const StressTskSt &tskSt{stressTsks[tskIdx]};
+         uint16_t histIdx{matchIdx[tskIdx]};
+
+         while((histIdx <= tskSt.histQty) && (tskSt.hist[histIdx] != frame[tskIdx]))
+            histIdx++;
+         if(histIdx > tskSt.histQty)
+            result++;
+         else
+            matchIdx[tskIdx] = histIdx;
+      }
+   }
+   for(uint8_t tskIdx{0}; tskIdx < StressTsksQty; tskIdx++){  // The last frame holds the final value of every task
+      if(frame[tskIdx] != stressTsks[tskIdx].model)
+         result++;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Marsaglia's xorshift32 pseudo random numbers generator.
+ */
+uint32_t xorShift(uint32_t &seed){
+   seed ^= seed << 13;
+   seed ^= seed >> 17;
+   seed ^= seed << 5;
+
+   return seed;
+}
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  *
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {
+   }
+
+   return;
+ }
+//=========================================>> User Functions Implementations END
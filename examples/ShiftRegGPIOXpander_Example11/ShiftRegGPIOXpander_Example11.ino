@@ -0,0 +1,151 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example11.ino
+  * @brief  : Persisted outputs state example of the ShiftRegGPIOXpander_ESP32 library
+  *
+  * The example sets a NVS state store and an OE pin before begin(): after
+  * any reset the outputs latched before it are restored in a single flush,
+  * and the outputs are kept disabled until that flush is latched, so no
+  * intermediate image is shown. A counter is shown in the first shift
+  * register, press the board's reset button (or let the example restart
+  * the MCU) and see it resume from the last value saved.
+  *
+  * The changes are coalesced by the state persisting task, so the NVS is
+  * written once every 2 seconds at most while the counter runs 4 times per
+  * second. Use a SRGXRtcStateStore store, with a 0 coalescing time, to
+  * save every change with no flash wear when restoring after the power
+  * cycles is not needed.
+  *
+  * The OE pin of the 74HC595 chain must be pulled up to Vcc by an external
+  * resistor, so the outputs are disabled while the MCU is in reset.
+  *
+  * No hardware is needed to run the example, the shift registers lines
+  * are driven anyway.
+  *
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url:
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXStateStore.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 5 // Task priority level
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+uint8_t ds{33};
+uint8_t sh_cp{26};
+uint8_t st_cp{25};
+uint8_t oe{27};
+uint8_t srQty{2};
+
+SRGXNvsStateStore stateStore;
+ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   uint8_t initCntnt[2]{0x00, 0x81};   // Used only if the store holds no valid image
+   SRGXVPort counter{srgx.createSRGXVPort(0, 8)};
+
+   Serial.begin(115200);
+
+   srgx.setOEPin(oe);
+   srgx.setStateStore(&stateStore, 2000);
+   if(!srgx.begin(initCntnt))
+      Error_Handler(0x02);
+   Serial.println("Persisted outputs state example");
+   Serial.println("====================================");
+   Serial.println(srgx.isStateRestored()?"Outputs restored from the NVS store":"No valid image stored, outputs set to the initial contents");
+   counter.begin(counter.readPort());   // The port resumes from the restored value
+
+   for(uint16_t stepInc{1}; ; stepInc++){
+      counter.incPort();
+      vTaskDelay(250);
+      if((stepInc % 80) == 0){
+         Serial.println("Counter at " + String(counter.readPort()) + ", NVS writes done: " + String(stateStore.getSavesQty()) + ", restarting...");
+         srgx.end();   // The pending image is saved before restarting
+         ESP.restart();
+      }
+   }
+}
+
+//================================================>> General use functions BEGIN
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  *
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {
+   }
+
+   return;
+ }
+//=========================================>> User Functions Implementations END
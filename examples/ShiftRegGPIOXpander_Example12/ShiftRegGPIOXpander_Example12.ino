@@ -0,0 +1,136 @@
+/**
+  ******************************************************************************
+  * @file	: ShiftRegGPIOXpander_Example12.ino
+  * @brief  : Binary command server example of the ShiftRegGPIOXpander_ESP32 library
+  *
+  * The example serves the SRGXCmdSrvr binary protocol over the Serial port,
+  * so the outputs might be driven and read from a host computer with the
+  * extras/SRGXCmdClient.py script, i.e.:
+  *   python3 SRGXCmdClient.py /dev/ttyUSB0 set 0 9
+  *   python3 SRGXCmdClient.py /dev/ttyUSB0 port 0 8 0xA5
+  *   python3 SRGXCmdClient.py /dev/ttyUSB0 bench --frames 2000
+  *
+  * Each frame is applied under a single Main Buffer mutex taking and
+  * latched by a single flush, no matter how many operations it holds.
+  * The Serial port carries the protocol frames only, so nothing else is
+  * printed to it once the server is running.
+  *
+  * The server is transport agnostic: a connected WiFiClient might be
+  * passed to poll(Stream&) the same way, and any other transport might
+  * feed the bytes received by feed(const uint8_t*, const size_t&) and send
+  * the responses through a setWrtCb(SRGXCmdWrtCb, void*) callback.
+  *
+  * No hardware is needed to run the example, the shift registers lines
+  * are driven anyway.
+  *
+  * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+  * Simulation url:
+  *
+  * Framework: Arduino
+  * Platform: ESP32
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 05/07/2025
+  *       Last update:   05/07/2025 17:30 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXCmdSrvr.h>
+
+//==============================================>> General use definitions BEGIN
+#define MainCtrlTskPrrtyLvl 5 // Task priority level
+
+static BaseType_t xReturned; /*!<Static variable to keep returning result value from Tasks and Timers executions*/
+static BaseType_t errorFlag {pdFALSE};
+
+BaseType_t ssdExecTskCore = xPortGetCoreID();
+BaseType_t ssdExecTskPrrtyCnfg = MainCtrlTskPrrtyLvl;
+
+uint8_t ds{33};
+uint8_t sh_cp{26};
+uint8_t st_cp{25};
+uint8_t srQty{2};
+
+ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+SRGXCmdSrvr cmdSrvr(&srgx);
+//================================================>> General use definitions END
+
+//======================================>> General use function prototypes BEGIN
+void Error_Handler(int8_t errorCode); /*!<Error Handler function prototype, to be implemented by the user*/
+//========================================>> General use function prototypes END
+
+//====================================>> Task Callback function prototypes BEGIN
+void mainCtrlTsk(void *pvParameters);
+//======================================>> Task Callback function prototypes END
+
+//===========================================>> Tasks Handles declarations BEGIN
+TaskHandle_t mainCtrlTskHndl {NULL};
+//=============================================>> Tasks Handles declarations END
+
+void setup() {
+
+   // Create the Main control task for setup and execution of the main code
+    xReturned = xTaskCreatePinnedToCore(
+       mainCtrlTsk,  // Callback function/task to be called
+       "MainControlTask",  // Name of the task
+       4096,   // Stack size (in bytes in ESP32, words in FreeRTOS), the minimum value is in the config file, for this is 768 bytes
+       NULL,  // Pointer to the parameters for the function to work with
+       ssdExecTskPrrtyCnfg, // Priority level given to the task
+       &mainCtrlTskHndl, // Task handle
+       ssdExecTskCore // Run in the App Core if it's a dual core mcu (ESP-FreeRTOS specific)
+    );
+    if(xReturned != pdPASS)
+       Error_Handler(0x01);
+}
+
+void loop() {
+   vTaskDelete(NULL); // Delete this task -the ESP-Arduino LoopTask()- and remove it from the execution list
+}
+
+ //===============================>> User Tasks Implementations BEGIN
+ void mainCtrlTsk(void *pvParameters){
+   delay(10);  //FTPO Part of the WOKWI simulator additions, for simulation startup needs
+
+   Serial.begin(921600);
+   if(!srgx.begin())
+      Error_Handler(0x02);
+
+   for(;;){
+      if(cmdSrvr.poll(Serial) == 0)
+         vTaskDelay(1); // No frame completed, yield until more bytes arrive
+   }
+}
+
+//================================================>> General use functions BEGIN
+//==================================================>> General use functions END
+
+//=======================================>> User Functions Implementations BEGIN
+ /**
+  * @brief Error Handling function
+  *
+  * Placeholder for a Error Handling function, in case of an error the execution
+  * will be trapped in this endless loop
+  */
+ void Error_Handler(int8_t errorCode){
+   Serial.println("Error Handler called with error code: " + String(errorCode));
+   for(;;)
+   {
+   }
+
+   return;
+ }
+//=========================================>> User Functions Implementations END
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""
+SRGXBenchCompare.py - Compares two ShiftRegGPIOXpander_ESP32 benchmark suite runs
+
+Reads two serial port logs of the ShiftRegGPIOXpander_Example09 benchmark suite, keeps the lines
+prefixed with "SRGXBENCH," and compares every (method, srQty, tasks) result of the current run
+against the baseline run:
+- Time per operation increases beyond the tolerance are reported as regressions.
+- Any flushes per operation increase is reported as a regression, as it is not a timing noise but a
+  behaviour change.
+
+Usage:
+   python3 SRGXBenchCompare.py <baseline log> <current log> [--tolerance <percentage>]
+
+The exit code is 1 if any regression was found, so the script might be used as a CI gate.
+
+Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+
+@author Gabriel D. Goldman
+@copyright Copyright (c) 2025  GPL-3.0 license
+"""
+import argparse
+import csv
+import sys
+
+PREFIX = "SRGXBENCH,"
+
+
+def load_results(path):
+   """Returns a dictionary of (method, srQty, tasks) to (ns_per_op, flushes_per_op)."""
+   result = {}
+   with open(path, encoding="utf-8", errors="ignore") as log_file:
+      lines = [line.strip()[len(PREFIX):] for line in log_file if line.strip().startswith(PREFIX)]
+   for row in csv.reader(lines):
+      if len(row) >= 6 and row[0] != "method":  # The logs of the releases printing the gpio_wrts_per_op column are accepted
+         result[(row[0], int(row[1]), int(row[2]))] = (int(row[4]), float(row[5]))
+   return result
+
+
+def main():
+   parser = argparse.ArgumentParser(description="Compares two ShiftRegGPIOXpander_ESP32 benchmark suite runs")
+   parser.add_argument("baseline")
+   parser.add_argument("current")
+   parser.add_argument("--tolerance", type=float, default=10.0, help="time per operation increase tolerated, in percentage (default 10)")
+   args = parser.parse_args()
+
+   baseline = load_results(args.baseline)
+   current = load_results(args.current)
+   regressions = 0
+   for key in sorted(current):
+      if key not in baseline:
+         print("NEW      %-45s srQty %2d tasks %d: %d ns/op" % (key[0], key[1], key[2], current[key][0]))
+         continue
+      base_ns, base_flshs = baseline[key]
+      cur_ns, cur_flshs = current[key]
+      delta = ((cur_ns - base_ns) * 100.0 / base_ns) if base_ns else 0.0
+      status = "ok"
+      if delta > args.tolerance or cur_flshs > base_flshs + 0.001:
+         status = "REGRESS"
+         regressions += 1
+      elif delta < -args.tolerance:
+         status = "improved"
+      print("%-8s %-45s srQty %2d tasks %d: %9d -> %9d ns/op (%+6.1f%%), %.3f -> %.3f flushes/op" % (status, key[0], key[1], key[2], base_ns, cur_ns, delta, base_flshs, cur_flshs))
+   for key in sorted(set(baseline) - set(current)):
+      print("MISSING  %-45s srQty %2d tasks %d" % key)
+   print("%d regressions found" % regressions)
+   return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+   sys.exit(main())
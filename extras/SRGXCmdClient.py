@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+SRGXCmdClient.py - Host client, benchmark and conformance test of the SRGXCmdSrvr binary protocol
+
+Drives a ShiftRegGPIOXpander object served by a SRGXCmdSrvr object (see the
+ShiftRegGPIOXpander_Example12 sketch) through a serial port, or any pseudo-terminal bridged to a TCP
+server, i.e. by socat:
+   socat pty,link=/tmp/srgx,raw,echo=0 tcp:<board address>:<port>
+
+Request frame: [0xA5] [len] [seq] [operations] [CRC16 LE over len, seq and operations]
+Response frame: [0xA5] [len] [seq] [status] [data] [CRC16 LE over len, seq, status and data]
+
+Usage:
+   python3 SRGXCmdClient.py <device> info
+   python3 SRGXCmdClient.py <device> set|reset|toggle <pin> [<pin> ...]
+   python3 SRGXCmdClient.py <device> port <strtPin> <pinsQty> <value>
+   python3 SRGXCmdClient.py <device> stamp <byte> [<byte> ...]
+   python3 SRGXCmdClient.py <device> read|readin
+   python3 SRGXCmdClient.py <device> bench [--frames <n>] [--ops <n>]
+   python3 SRGXCmdClient.py <device> selftest [--frames <n>] [--ops <n>]
+
+The selftest command verifies the protocol, including the server resynchronization after corrupted
+and stalled frames, then runs the benchmark. It expects a server of a chain of 2 output shift
+registers and no inputs, as the one run on a pseudo-terminal by the extras/host
+SRGXCmdSrvrPtyTest, which builds the library's SRGXCmdSrvr class for the host, so the script and
+the server are verified together with no board attached. The exit code is 1 if any request failed,
+so the script might be used as a CI gate.
+
+Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+
+@author Gabriel D. Goldman
+@copyright Copyright (c) 2025  GPL-3.0 license
+"""
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+SOF = 0xA5
+OP_INFO, OP_SET, OP_RESET, OP_TOGGLE, OP_PORT, OP_STAMP, OP_READ, OP_READIN = range(8)
+STATUS_OK, STATUS_INVALID, STATUS_NOT_BEGUN = range(3)
+
+
+def crc16(data, crc=0xFFFF):
+   """Returns the CCITT CRC16 (0x1021 polynomial) of data, as SRGXStateStore::crc16() does."""
+   for byte in data:
+      crc ^= byte << 8
+      for _ in range(8):
+         crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+         crc &= 0xFFFF
+   return crc
+
+
+def build_frame(seq, body):
+   """Returns the frame holding the sequence number and body (operations or status and data)."""
+   payload = bytes([len(body) + 1, seq & 0xFF]) + bytes(body)
+   crc = crc16(payload)
+   return bytes([SOF]) + payload + bytes([crc & 0xFF, crc >> 8])
+
+
+def op_pins(opcode, pins):
+   return bytes([opcode, len(pins)] + list(pins))
+
+
+def op_port(strt_pin, pins_qty, value):
+   return bytes([OP_PORT, strt_pin, pins_qty, value & 0xFF, (value >> 8) & 0xFF])
+
+
+def op_stamp(img):
+   return bytes([OP_STAMP]) + bytes(img)
+
+
+class FrameReader:
+   """Extracts the CRC validated frames from the responses bytes stream."""
+
+   def __init__(self):
+      self.frame = bytearray()
+      self.crc_errors = 0
+
+   def feed(self, data):
+      """Returns the list of (seq, body) of the frames completed by data."""
+      result = []
+      for byte in data:
+         if not self.frame:
+            if byte == SOF:
+               self.frame.append(byte)
+            continue
+         self.frame.append(byte)
+         if len(self.frame) == 2 and byte == 0:
+            self.frame.clear()
+         elif len(self.frame) > 2 and len(self.frame) == 4 + self.frame[1]:
+            if crc16(self.frame[1:-2]) == (self.frame[-2] | (self.frame[-1] << 8)):
+               result.append((self.frame[2], bytes(self.frame[3:-2])))
+            else:
+               self.crc_errors += 1
+            self.frame.clear()
+      return result
+
+
+class SRGXCmdClient:
+   """A client of a SRGXCmdSrvr object over a file descriptor (serial port or pseudo-terminal)."""
+
+   def __init__(self, fd, timeout=1.0):
+      self.fd = fd
+      self.timeout = timeout
+      self.seq = 0
+      self.reader = FrameReader()
+      self.pending = []
+
+   def request(self, ops):
+      """Sends a frame holding the operations, returns the (status, data) of it's response."""
+      self.seq = (self.seq + 1) & 0xFF
+      os.write(self.fd, build_frame(self.seq, ops))
+      deadline = time.monotonic() + self.timeout
+      while True:
+         while self.pending:
+            seq, body = self.pending.pop(0)
+            if seq == self.seq and len(body) >= 1:
+               return body[0], body[1:]
+         remaining = deadline - time.monotonic()
+         if remaining <= 0 or not select.select([self.fd], [], [], remaining)[0]:
+            raise TimeoutError("no response to frame %d" % self.seq)
+         self.pending.extend(self.reader.feed(os.read(self.fd, 4096)))
+
+   def info(self):
+      status, data = self.request(bytes([OP_INFO]))
+      return (status, tuple(data))
+
+   def read(self):
+      return self.request(bytes([OP_READ]))
+
+   def read_in(self):
+      return self.request(bytes([OP_READIN]))
+
+
+def open_port(path, baud):
+   """Opens a serial port or pseudo-terminal in raw mode."""
+   fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+   tty.setraw(fd)
+   speed = getattr(termios, "B%d" % baud, None)
+   if speed is not None:
+      attrs = termios.tcgetattr(fd)
+      attrs[4] = attrs[5] = speed
+      termios.tcsetattr(fd, termios.TCSANOW, attrs)
+   return fd
+
+
+def bench(client, frames, ops_qty, sr_qty):
+   """Sends frames of ops_qty toggle operations each, returns (frames/s, commands/s, failures)."""
+   failures = 0
+   strt = time.perf_counter()
+   for frame_inc in range(frames):
+      ops = b"".join(op_pins(OP_TOGGLE, [(frame_inc + op_inc) % (sr_qty * 8)]) for op_inc in range(ops_qty))
+      if client.request(ops)[0] != STATUS_OK:
+         failures += 1
+   elapsed = time.perf_counter() - strt
+   return frames / elapsed, frames * ops_qty / elapsed, failures
+
+
+def selftest(client, frames, ops_qty):
+   """Verifies the protocol against a server of a 2 shift registers chain with no inputs, returns the failures quantity."""
+   if client.info() != (STATUS_OK, (1, 2, 0)):
+      print("selftest: FAIL the server must serve a chain of 2 output shift registers and no inputs")
+      return 1
+   checks = [
+      (client.request(op_pins(OP_SET, [0, 1, 9]) + op_pins(OP_TOGGLE, [1, 10]) + op_pins(OP_RESET, [0]) + bytes([OP_READ])), (STATUS_OK, bytes([0x00, 0x06]))),
+      (client.request(op_pins(OP_SET, [2]) + op_pins(OP_SET, [16]) + bytes([OP_READ])), (STATUS_INVALID, b"")),
+      (client.request(op_stamp([0xFF, 0x00]) + op_port(4, 8, 0x0F) + bytes([OP_READ])), (STATUS_OK, bytes([0xFF, 0x00]))),
+      (client.request(op_pins(OP_TOGGLE, [15]) + bytes([OP_READ])), (STATUS_OK, bytes([0xFF, 0x80]))),
+      (client.read_in(), (STATUS_INVALID, b"")),
+   ]
+   os.write(client.fd, b"\x00\x11" + bytes([SOF, 0x02, 0x00, 0x06, 0x00, 0x00]))  # Garbage and a CRC mismatch, dropped by the server
+   checks.append((client.read(), (STATUS_OK, bytes([0xFF, 0x80]))))
+   os.write(client.fd, bytes([SOF, 0x03, 0x00, 0x06]))  # A corrupted frame whose span holds the start of the next one, rescanned after the CRC mismatch
+   checks.append((client.request(op_pins(OP_RESET, [15]) + bytes([OP_READ])), (STATUS_OK, bytes([0xFF, 0x00]))))
+   os.write(client.fd, bytes([SOF, 0x40, 0x00, 0x06]))  # A corrupted length stalling the frame, dropped by the server's inter-byte timeout
+   checks.append((client.read(), (STATUS_OK, bytes([0xFF, 0x00]))))
+   failures = 0
+   for check_inc, (got, expected) in enumerate(checks):
+      if got != expected:
+         print("FAIL check %d: got %r, expected %r" % (check_inc, got, expected))
+         failures += 1
+   frms_sec, cmds_sec, bench_failures = bench(client, frames, ops_qty, 2)
+   failures += bench_failures
+   print("selftest: %d checks, %d frames of %d commands, %.0f frames/s, %.0f commands/s, %s" % (len(checks) + 1, frames, ops_qty, frms_sec, cmds_sec, "ok" if not failures else "%d FAILURES" % failures))
+   return failures
+
+
+def main():
+   parser = argparse.ArgumentParser(description="Client of the ShiftRegGPIOXpander_ESP32 SRGXCmdSrvr binary protocol")
+   parser.add_argument("device", nargs="?", help="serial port or pseudo-terminal path")
+   parser.add_argument("command", nargs="?", choices=["info", "set", "reset", "toggle", "port", "stamp", "read", "readin", "bench", "selftest"])
+   parser.add_argument("args", nargs="*", help="pins, port parameters or stamp bytes (decimal or 0x prefixed hexadecimal)")
+   parser.add_argument("--baud", type=int, default=921600, help="serial port speed (default 921600)")
+   parser.add_argument("--frames", type=int, default=1000, help="frames sent by the benchmark (default 1000)")
+   parser.add_argument("--ops", type=int, default=8, help="commands per frame sent by the benchmark (default 8)")
+   args = parser.parse_args()
+
+   if args.device is None or args.command is None:
+      parser.error("the device and command are required")
+
+   values = [int(arg, 0) for arg in args.args]
+   client = SRGXCmdClient(open_port(args.device, args.baud))
+   if args.command == "info":
+      status, data = client.info()
+   elif args.command in ("set", "reset", "toggle"):
+      status, data = client.request(op_pins({"set": OP_SET, "reset": OP_RESET, "toggle": OP_TOGGLE}[args.command], values) + bytes([OP_READ]))
+   elif args.command == "port":
+      if len(values) != 3:
+         parser.error("port needs the strtPin, pinsQty and value arguments")
+      status, data = client.request(op_port(*values) + bytes([OP_READ]))
+   elif args.command == "stamp":
+      status, data = client.request(op_stamp(values) + bytes([OP_READ]))
+   elif args.command == "read":
+      status, data = client.read()
+   elif args.command == "readin":
+      status, data = client.read_in()
+   elif args.command == "selftest":
+      sys.exit(1 if selftest(client, args.frames, args.ops) else 0)
+   else:
+      status, (_, sr_qty, _) = client.info()
+      frms_sec, cmds_sec, failures = bench(client, args.frames, args.ops, sr_qty)
+      print("bench: %d frames of %d commands, %.0f frames/s, %.0f commands/s, %d failures" % (args.frames, args.ops, frms_sec, cmds_sec, failures))
+      sys.exit(1 if failures else 0)
+   print("status %d%s" % (status, (", data " + " ".join("%02X" % byte for byte in data)) if data else ""))
+   sys.exit(0 if status == STATUS_OK else 1)
+
+
+if __name__ == "__main__":
+   main()
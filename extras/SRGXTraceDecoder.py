@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+SRGXTraceDecoder.py - Host side decoder of the ShiftRegGPIOXpander_ESP32 trace recorder dumps
+
+Decodes the binary dump produced by ShiftRegGPIOXpander::dumpTrace(uint8_t*, const uint32_t&), and
+prints every latched frame in chronological order: timestamp, task handle, flush requesting API
+method, the shift registers changed and the complete frame latched.
+
+The dump might be provided as a binary file, or as a text file with the dump bytes in hexadecimal
+(i.e. as printed through the serial port by the ShiftRegGPIOXpander_Example08 sketch).
+
+Usage:
+   python3 SRGXTraceDecoder.py <dump file> [--elf <firmware .elf> [--addr2line <addr2line tool>]]
+
+The version 2 dumps identify the flush requesting API method by it's 1 byte SRGXTrcApi value. The
+version 1 dumps held the 4 bytes requesting code address instead: with --elf the addresses are
+resolved to the function names by the addr2line tool of the toolchain (xtensa-esp32-elf-addr2line
+by default).
+
+Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+
+@author Gabriel D. Goldman
+@copyright Copyright (c) 2025  GPL-3.0 license
+"""
+import argparse
+import string
+import struct
+import subprocess
+import sys
+
+HDR_FMT = "<4sBBHII"
+HDR_SIZE = struct.calcsize(HDR_FMT)  # 16 bytes
+REC_HDR_FMTS = {1: "<IIIB", 2: "<IIBB"}  # Version 1: uint32_t code address, version 2: uint8_t SRGXTrcApi value
+TRC_APIS = ["None", "Async", "Begin", "BeginInput",
+            "ClearPinsRemap", "DigitalReadSgmntSr", "DigitalReadSr", "DigitalToggleSr",
+            "DigitalToggleSrAll", "DigitalToggleSrMask", "DigitalWriteSr", "DigitalWriteSrAllReset",
+            "DigitalWriteSrAllSet", "DigitalWriteSrMaskReset", "DigitalWriteSrMaskSet", "MoveAuxToMain",
+            "MoveSnapshotToMain", "ResetMany", "SetMany", "SetPinsRemap",
+            "StampMaskOverMain", "StampOverMain", "StampSgmntOverMain", "ToggleMany",
+            "UpdateInputs", "WriteMany", "VPortRead", "VPortRmw",
+            "VPortWrite", "CmdSrvr", "MuxScanner", "SeqPlayer",
+            "StepperEng"]  # SRGXTrcApi values, in the enumeration order
+
+
+def load_dump(path):
+   """Returns the dump bytes, from a binary or an hexadecimal text file."""
+   with open(path, "rb") as dump_file:
+      raw = dump_file.read()
+   if raw[:4] != b"SRGT":
+      text = raw.decode("ascii", errors="ignore")
+      hex_digits = "".join(ch for ch in text if ch in string.hexdigits)
+      raw = bytes.fromhex(hex_digits)
+   return raw
+
+
+def resolve_addrs(addrs, elf_path, addr2line):
+   """Returns a dictionary of code addresses to function names."""
+   result = {}
+   if elf_path and addrs:
+      hex_addrs = ["0x%08x" % addr for addr in addrs]
+      out = subprocess.run([addr2line, "-f", "-C", "-e", elf_path] + hex_addrs, capture_output=True, text=True, check=True).stdout.split("\n")
+      for idx, addr in enumerate(addrs):
+         result[addr] = out[2 * idx] if (2 * idx) < len(out) else "??"
+   return result
+
+
+def decode(raw, elf_path=None, addr2line="xtensa-esp32-elf-addr2line"):
+   """Decodes the dump, returns the list of (timestamp, task, API method or address, changes, frame) records."""
+   if len(raw) < HDR_SIZE:
+      raise ValueError("dump too short")
+   sign, version, sr_qty, _, recs_len, lost_qty = struct.unpack_from(HDR_FMT, raw, 0)
+   if sign != b"SRGT" or version not in (1, 2):
+      raise ValueError("not a SRGT version 1 or 2 dump")
+   frame = bytearray(raw[HDR_SIZE:HDR_SIZE + sr_qty])
+   recs = raw[HDR_SIZE + sr_qty:HDR_SIZE + sr_qty + recs_len]
+   rec_hdr_fmt = REC_HDR_FMTS[version]
+   rec_hdr_size = struct.calcsize(rec_hdr_fmt)  # 13 bytes for version 1, 10 bytes for version 2
+   records = []
+   offset = 0
+   while offset + rec_hdr_size <= len(recs):
+      tm_stmp, tsk_hndl, cllr_addr, diffs_qty = struct.unpack_from(rec_hdr_fmt, recs, offset)
+      offset += rec_hdr_size
+      changes = []
+      for _ in range(diffs_qty):
+         sr_idx, diff_bits = recs[offset], recs[offset + 1]
+         offset += 2
+         frame[sr_idx] ^= diff_bits
+         changes.append((sr_idx, diff_bits))
+      records.append((tm_stmp, tsk_hndl, cllr_addr, changes, bytes(frame)))
+   if version == 1:
+      names = resolve_addrs(sorted({rec[2] for rec in records}), elf_path, addr2line)
+   else:
+      names = {api_id: TRC_APIS[api_id] for api_id in {rec[2] for rec in records} if api_id < len(TRC_APIS)}
+   return sr_qty, lost_qty, records, names
+
+
+def main():
+   parser = argparse.ArgumentParser(description="Decodes a ShiftRegGPIOXpander_ESP32 trace recorder dump")
+   parser.add_argument("dump")
+   parser.add_argument("--elf", default=None)
+   parser.add_argument("--addr2line", default="xtensa-esp32-elf-addr2line")
+   args = parser.parse_args()
+
+   sr_qty, lost_qty, records, names = decode(load_dump(args.dump), args.elf, args.addr2line)
+   print("Shift registers: %d, records: %d, records evicted: %d" % (sr_qty, len(records), lost_qty))
+   prev_tm = records[0][0] if records else 0
+   for tm_stmp, tsk_hndl, cllr_addr, changes, frame in records:
+      pins = []
+      for sr_idx, diff_bits in changes:
+         pins += ["%d%s" % (sr_idx * 8 + bit, "+" if (frame[sr_idx] >> bit) & 1 else "-") for bit in range(8) if (diff_bits >> bit) & 1]
+      caller = names.get(cllr_addr, "0x%08x" % cllr_addr)
+      print("%10u us (+%7u) task 0x%08x %-28s frame %s changed %s" % (tm_stmp, (tm_stmp - prev_tm) & 0xFFFFFFFF, tsk_hndl, caller, frame[::-1].hex(), " ".join(pins) if pins else "-"))
+      prev_tm = tm_stmp
+   return 0
+
+
+if __name__ == "__main__":
+   sys.exit(main())
@@ -0,0 +1,114 @@
+/**
+ ******************************************************************************
+ * @file SRGXHostTest.h
+ * @brief Helpers shared by the host (Linux) tests of the ShiftRegGPIOXpander_ESP32 library, see extras/host/Makefile
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _SRGX_HOST_TEST_H_
+#define _SRGX_HOST_TEST_H_
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Fails the test, printing the condition and it's location, if the condition is false.
+ */
+#define SRGX_CHECK(cond) do{ \
+   if(!(cond)){ \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      exit(1); \
+   } \
+}while(0)
+
+/**
+ * @brief Model of a 74HCx595 shift registers chain driven through the GPIO writes of the stubs.
+ *
+ * The SH_CP rising edges shift the DS level into the first register, the bit 7 of each register
+ * feeding the next one, and the ST_CP rising edges latch the shift registers into the outputs.
+ */
+class SRGXHostChain{
+public:
+   static const uint8_t maxSrQty{32};
+   uint8_t ds;
+   uint8_t shCp;
+   uint8_t stCp;
+   uint8_t srQty;
+   uint8_t sr[maxSrQty];
+   uint8_t out[maxSrQty];
+   uint32_t latchesQty;
+   void (*latchHook)(const SRGXHostChain &chain);  // Invoked on every latch, after the outputs are updated, if not nullptr
+
+   /**
+    * @brief Attaches the chain to the GPIO writes, a single chain can be attached at a time.
+    */
+   void attach(const uint8_t &dsPin, const uint8_t &shCpPin, const uint8_t &stCpPin, const uint8_t &chainSrQty){
+      ds = dsPin;
+      shCp = shCpPin;
+      stCp = stCpPin;
+      srQty = chainSrQty;
+      memset(sr, 0x00, sizeof(sr));
+      memset(out, 0x00, sizeof(out));
+      latchesQty = 0;
+      latchHook = nullptr;
+      _dsLvl = 0;
+      _shLvl = 1; // The clock lines idle HIGH, as set by ShiftRegGPIOXpander::begin()
+      _stLvl = 1;
+      _instPtr() = this;
+      srgxHostCntrs().pinWrtHook = _pinWrt;
+
+      return;
+   }
+
+   /**
+    * @brief Returns the level of the srPin output.
+    */
+   uint8_t outLvl(const uint16_t &srPin) const{
+
+      return (out[srPin / 8] >> (srPin % 8)) & 0x01;
+   }
+
+private:
+   uint8_t _dsLvl;
+   uint8_t _shLvl;
+   uint8_t _stLvl;
+
+   static SRGXHostChain*& _instPtr(){
+      static SRGXHostChain* instPtr{nullptr};
+
+      return instPtr;
+   }
+
+   static void _pinWrt(uint8_t pin, uint8_t lvl){
+      SRGXHostChain* chainPtr{_instPtr()};
+
+      if(pin == chainPtr->ds)
+         chainPtr->_dsLvl = lvl;
+      else if(pin == chainPtr->shCp){
+         if(!chainPtr->_shLvl && lvl){
+            for(int srIdx{chainPtr->srQty - 1}; srIdx >= 0; srIdx--)
+               chainPtr->sr[srIdx] = (chainPtr->sr[srIdx] << 1) | ((srIdx > 0)?(chainPtr->sr[srIdx - 1] >> 7):chainPtr->_dsLvl);
+         }
+         chainPtr->_shLvl = lvl;
+      }
+      else if(pin == chainPtr->stCp){
+         if(!chainPtr->_stLvl && lvl){
+            memcpy(chainPtr->out, chainPtr->sr, chainPtr->srQty);
+            chainPtr->latchesQty++;
+            if(chainPtr->latchHook != nullptr)
+               chainPtr->latchHook(*chainPtr);
+         }
+         chainPtr->_stLvl = lvl;
+      }
+
+      return;
+   }
+};
+
+#endif
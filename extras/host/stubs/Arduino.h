@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @file Arduino.h
+ * @brief Host (Linux) stand-in of the Arduino-ESP32 and FreeRTOS APIs used by the ShiftRegGPIOXpander_ESP32 library
+ *
+ * The stubs are single threaded: a task created runs only when notified, from srgxHostRunTsks() or
+ * while the main thread is delayed or waiting for a notification, the mutexes are always available,
+ * and the time is a virtual microseconds clock advanced by the delays. Every GPIO write,
+ * mutex taking and critical section entered is counted in the SRGXHostCntrs object, so the host
+ * tests measure the real work done by each library method, see extras/host/Makefile.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#ifndef _SRGX_HOST_ARDUINO_H_
+#define _SRGX_HOST_ARDUINO_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 1
+#define OUTPUT 3
+#define INPUT_PULLUP 5
+#define GPIO_NUM_NC (-1)
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_NOINIT_ATTR
+#define RTC_DATA_ATTR
+
+/**
+ * @brief Counters of the hardware and RTOS operations performed through the stubs.
+ */
+struct SRGXHostCntrs{
+   uint32_t pinWrtsQty[64]; // GPIO writes per pin
+   uint8_t pinLvl[64];  // Last level written to each pin
+   uint32_t gpioWrtsQty;   // GPIO writes, all pins
+   uint32_t mtxTakesQty;   // Semaphores taken
+   uint32_t crtclQty;   // Critical sections entered
+   uint32_t tsksQty; // Tasks created
+   int64_t clkUs; // Virtual time
+   void (*pinWrtHook)(uint8_t pin, uint8_t lvl);   // Invoked on every GPIO write, i.e. by a SRGXHostChain object
+   int (*pinRdHook)(uint8_t pin);   // Provides the level read from the input pins, 0 if nullptr
+};
+SRGXHostCntrs& srgxHostCntrs();
+void srgxHostRstCntrs();   // Clears the counters, the levels, the clock and the hooks are kept
+
+/*Time*/
+inline int64_t esp_timer_get_time(){ return ++srgxHostCntrs().clkUs; }  // Every reading advances the clock, so polling loops end
+inline void delayMicroseconds(uint32_t us){ srgxHostCntrs().clkUs += us; }
+inline void esp_rom_delay_us(uint32_t us){ delayMicroseconds(us); }
+inline void delay(uint32_t ms){ srgxHostCntrs().clkUs += 1000LL * ms; }
+inline unsigned long micros(){ return static_cast<unsigned long>(srgxHostCntrs().clkUs); }
+inline unsigned long millis(){ return static_cast<unsigned long>(srgxHostCntrs().clkUs / 1000); }
+struct EspClass{
+   uint32_t getCycleCount(){ return static_cast<uint32_t>(srgxHostCntrs().clkUs * 240); }
+   void restart(){}
+};
+extern EspClass ESP;
+
+/*GPIO*/
+inline void pinMode(uint8_t, uint8_t){}
+inline bool digitalPinIsValid(uint8_t pin){ return (pin < 40) && !((0xF1100000ULL >> pin) & 0x01); }  // The ESP32 GPIO 0 to 39, 20, 24 and 28 to 31 not available
+inline void digitalWrite(uint8_t pin, uint8_t lvl){
+   SRGXHostCntrs &cntrs = srgxHostCntrs();
+
+   cntrs.gpioWrtsQty++;
+   if(pin < 64){
+      cntrs.pinWrtsQty[pin]++;
+      cntrs.pinLvl[pin] = lvl;
+   }
+   if(cntrs.pinWrtHook != nullptr)
+      cntrs.pinWrtHook(pin, lvl);
+}
+inline int digitalRead(uint8_t pin){ return (srgxHostCntrs().pinRdHook != nullptr)?srgxHostCntrs().pinRdHook(pin):0; }
+
+/*LEDC*/
+inline double ledcSetup(uint8_t, uint32_t freq, uint8_t){ return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t){}
+inline void ledcDetachPin(uint8_t){}
+inline void ledcWrite(uint8_t, uint32_t){}
+
+/*FreeRTOS*/
+typedef void* SemaphoreHandle_t;
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef struct{ int owner; } portMUX_TYPE;
+#define configMAX_PRIORITIES 25
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFF
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (ms)
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define taskENTER_CRITICAL(muxPtr) ((void)(muxPtr), srgxHostCntrs().crtclQty++)
+#define taskEXIT_CRITICAL(muxPtr) ((void)(muxPtr))
+#define taskENTER_CRITICAL_ISR(muxPtr) taskENTER_CRITICAL(muxPtr)
+#define taskEXIT_CRITICAL_ISR(muxPtr) taskEXIT_CRITICAL(muxPtr)
+#define portENTER_CRITICAL(muxPtr) taskENTER_CRITICAL(muxPtr)
+#define portEXIT_CRITICAL(muxPtr) taskEXIT_CRITICAL(muxPtr)
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex(){ return &srgxHostCntrs(); }  // Any non null handle, the semaphores hold no state
+inline SemaphoreHandle_t xSemaphoreCreateBinary(){ return &srgxHostCntrs(); }
+inline SemaphoreHandle_t xSemaphoreCreateCounting(unsigned, unsigned){ return &srgxHostCntrs(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t){}
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t){ srgxHostCntrs().mtxTakesQty++; return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t){ return pdTRUE; }
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t, BaseType_t*){ return pdTRUE; }
+
+QueueHandle_t xQueueCreate(unsigned depth, unsigned itemSize);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void* itemPtr, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void* itemPtr, TickType_t wait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* itemPtr, BaseType_t*){ return xQueueSend(queue, itemPtr, 0); }
+
+/*Tasks: a task notified runs until it waits for a notification not given yet, or deletes itself.
+It's then abandoned and restarted from it's entry point the next time it's notified, as the library
+tasks keep no state in their stack between notifications.*/
+BaseType_t xTaskCreate(void(*tskFn)(void*), const char* name, uint32_t stck, void* argp, UBaseType_t prrty, TaskHandle_t* tskHndlPtr);
+inline BaseType_t xTaskCreatePinnedToCore(void(*tskFn)(void*), const char* name, uint32_t stck, void* argp, UBaseType_t prrty, TaskHandle_t* tskHndlPtr, BaseType_t){ return xTaskCreate(tskFn, name, stck, argp, prrty, tskHndlPtr); }
+void vTaskDelete(TaskHandle_t tskHndl);
+void vTaskDelay(TickType_t ticks);  // The main thread runs the tasks notified
+inline TickType_t xTaskGetTickCount(){ return static_cast<TickType_t>(srgxHostCntrs().clkUs / 1000); }
+TaskHandle_t xTaskGetCurrentTaskHandle();  // nullptr for the main thread
+uint32_t ulTaskNotifyTake(BaseType_t clrOnExit, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t tskHndl);
+inline void vTaskNotifyGiveFromISR(TaskHandle_t tskHndl, BaseType_t*){ xTaskNotifyGive(tskHndl); }
+uint8_t srgxHostRunTsks();  // Runs every task notified from the main thread, returns the quantity of tasks run
+inline BaseType_t xPortGetCoreID(){ return 0; }
+
+/*Serial*/
+class Stream{
+public:
+   virtual ~Stream(){}
+   virtual int available() = 0;
+   virtual int read() = 0;
+   virtual size_t write(const uint8_t* bffrPtr, size_t len) = 0;
+};
+
+#include <esp_timer.h>
+
+#endif
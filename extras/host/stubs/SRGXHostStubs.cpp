@@ -0,0 +1,214 @@
+/**
+ ******************************************************************************
+ * @file SRGXHostStubs.cpp
+ * @brief Code file of the host (Linux) stand-ins of the Arduino-ESP32 and FreeRTOS APIs, see Arduino.h
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <hal/gpio_ll.h>
+#include <setjmp.h>
+
+EspClass ESP;
+gpio_dev_t GPIO;
+
+SRGXHostCntrs& srgxHostCntrs(){
+   static SRGXHostCntrs cntrs{};
+
+   return cntrs;
+}
+
+void srgxHostRstCntrs(){
+   SRGXHostCntrs &cntrs = srgxHostCntrs();
+
+   memset(cntrs.pinWrtsQty, 0x00, sizeof(cntrs.pinWrtsQty));
+   cntrs.gpioWrtsQty = 0;
+   cntrs.mtxTakesQty = 0;
+   cntrs.crtclQty = 0;
+
+   return;
+}
+
+/*Queues: a ring of depth items, a single thread never blocks on them, a full queue fails the sending
+and an empty one the receiving, whatever the waiting time.*/
+struct SRGXHostQueue{
+   unsigned depth;
+   unsigned itemSize;
+   unsigned qty;
+   unsigned head;
+   uint8_t* itemsPtr;
+};
+
+QueueHandle_t xQueueCreate(unsigned depth, unsigned itemSize){
+   SRGXHostQueue* queuePtr{new SRGXHostQueue{depth, itemSize, 0, 0, nullptr}};
+
+   queuePtr->itemsPtr = new uint8_t[depth * itemSize]{};
+
+   return queuePtr;
+}
+
+void vQueueDelete(QueueHandle_t queue){
+   SRGXHostQueue* queuePtr{static_cast<SRGXHostQueue*>(queue)};
+
+   delete [] queuePtr->itemsPtr;
+   delete queuePtr;
+
+   return;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* itemPtr, TickType_t){
+   SRGXHostQueue* queuePtr{static_cast<SRGXHostQueue*>(queue)};
+   BaseType_t result{pdFALSE};
+
+   if(queuePtr->qty > 0){
+      memcpy(itemPtr, queuePtr->itemsPtr + queuePtr->head * queuePtr->itemSize, queuePtr->itemSize);
+      queuePtr->head = (queuePtr->head + 1) % queuePtr->depth;
+      queuePtr->qty--;
+      result = pdTRUE;
+   }
+
+   return result;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* itemPtr, TickType_t){
+   SRGXHostQueue* queuePtr{static_cast<SRGXHostQueue*>(queue)};
+   BaseType_t result{pdFALSE};
+
+   if(queuePtr->qty < queuePtr->depth){
+      memcpy(queuePtr->itemsPtr + ((queuePtr->head + queuePtr->qty) % queuePtr->depth) * queuePtr->itemSize, itemPtr, queuePtr->itemSize);
+      queuePtr->qty++;
+      result = pdTRUE;
+   }
+
+   return result;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue){
+
+   return static_cast<SRGXHostQueue*>(queue)->qty;
+}
+
+/*Tasks: each run is started under a setjmp(), the task leaves it by a longjmp() when it waits for a
+notification not given yet or deletes itself. The library tasks hold no objects with destructors in
+their frames at those points.*/
+struct SRGXHostTsk{
+   void (*tskFn)(void*);
+   void* argp;
+   uint32_t ntfsQty;
+};
+
+static const uint8_t srgxHostMaxTsksQty{32};
+static SRGXHostTsk srgxHostTsks[srgxHostMaxTsksQty]{};
+static uint8_t srgxHostCurTsk{0};   // Slot of the task running plus 1, 0 for the main thread
+static jmp_buf srgxHostTskJmp;
+
+static SRGXHostTsk* srgxHostTskPtr(TaskHandle_t tskHndl){
+   const uintptr_t slot{reinterpret_cast<uintptr_t>(tskHndl)};
+   SRGXHostTsk* result{nullptr};
+
+   if((slot > 0) && (slot <= srgxHostMaxTsksQty) && (srgxHostTsks[slot - 1].tskFn != nullptr))
+      result = &srgxHostTsks[slot - 1];
+
+   return result;
+}
+
+static void srgxHostRunTsk(const uint8_t &slot){
+   srgxHostCurTsk = slot + 1;
+   if(setjmp(srgxHostTskJmp) == 0)
+      srgxHostTsks[slot].tskFn(srgxHostTsks[slot].argp);
+   srgxHostCurTsk = 0;
+
+   return;
+}
+
+uint8_t srgxHostRunTsks(){
+   uint8_t result{0};
+
+   if(srgxHostCurTsk == 0){   // The tasks are not nested
+      for(uint8_t slot{0}; slot < srgxHostMaxTsksQty; slot++){
+         if((srgxHostTsks[slot].tskFn != nullptr) && (srgxHostTsks[slot].ntfsQty > 0)){
+            srgxHostRunTsk(slot);
+            result++;
+         }
+      }
+   }
+
+   return result;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(){
+
+   return reinterpret_cast<TaskHandle_t>(static_cast<uintptr_t>(srgxHostCurTsk));
+}
+
+BaseType_t xTaskCreate(void(*tskFn)(void*), const char*, uint32_t, void* argp, UBaseType_t, TaskHandle_t* tskHndlPtr){
+   BaseType_t result{pdFALSE};
+
+   for(uint8_t slot{0}; (result == pdFALSE) && (slot < srgxHostMaxTsksQty); slot++){
+      if(srgxHostTsks[slot].tskFn == nullptr){
+         srgxHostTsks[slot] = SRGXHostTsk{tskFn, argp, 0};
+         if(tskHndlPtr != nullptr)
+            *tskHndlPtr = reinterpret_cast<TaskHandle_t>(static_cast<uintptr_t>(slot + 1));
+         srgxHostCntrs().tsksQty++;
+         result = pdPASS;
+      }
+   }
+
+   return result;
+}
+
+void vTaskDelay(TickType_t ticks){
+   srgxHostCntrs().clkUs += 1000LL * ticks;
+   srgxHostRunTsks();
+
+   return;
+}
+
+void vTaskDelete(TaskHandle_t tskHndl){
+   const bool selfDlt{(tskHndl == nullptr) || (reinterpret_cast<uintptr_t>(tskHndl) == srgxHostCurTsk)};
+   SRGXHostTsk* tskPtr{srgxHostTskPtr(selfDlt?xTaskGetCurrentTaskHandle():tskHndl)};
+
+   if(tskPtr != nullptr)
+      *tskPtr = SRGXHostTsk{nullptr, nullptr, 0};
+   if(selfDlt && (srgxHostCurTsk != 0))
+      longjmp(srgxHostTskJmp, 1);
+
+   return;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t tskHndl){
+   SRGXHostTsk* tskPtr{srgxHostTskPtr(tskHndl)};
+
+   if(tskPtr != nullptr)
+      tskPtr->ntfsQty++;
+
+   return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clrOnExit, TickType_t wait){
+   uint32_t result{0};
+
+   if(srgxHostCurTsk == 0){   // The main thread waits for the tasks to run
+      srgxHostCntrs().clkUs += 1000LL * ((wait > 0)?1:0);
+      srgxHostRunTsks();
+   }
+   else{
+      SRGXHostTsk &tsk{srgxHostTsks[srgxHostCurTsk - 1]};
+
+      if(tsk.ntfsQty > 0){
+         result = tsk.ntfsQty;
+         tsk.ntfsQty = clrOnExit?0:(tsk.ntfsQty - 1);
+      }
+      else if(wait == portMAX_DELAY)
+         longjmp(srgxHostTskJmp, 1);   // Blocked until notified, run again from the start then
+      else
+         srgxHostCntrs().clkUs += 1000LL * wait;
+   }
+
+   return result;
+}
@@ -0,0 +1,18 @@
+/**
+ * @file esp_attr.h
+ * @brief Host stand-in of the ESP-IDF memory placement attributes, see extras/host/stubs/Arduino.h
+ */
+#ifndef _SRGX_HOST_ESP_ATTR_H_
+#define _SRGX_HOST_ESP_ATTR_H_
+
+#ifndef IRAM_ATTR
+   #define IRAM_ATTR
+#endif
+#ifndef DRAM_ATTR
+   #define DRAM_ATTR
+#endif
+#ifndef RTC_NOINIT_ATTR
+   #define RTC_NOINIT_ATTR
+#endif
+
+#endif
@@ -0,0 +1,12 @@
+/**
+ * @file esp_rom_gpio.h
+ * @brief Host stand-in of the ESP-IDF GPIO matrix ROM functions, see extras/host/stubs/Arduino.h
+ */
+#ifndef _SRGX_HOST_ESP_ROM_GPIO_H_
+#define _SRGX_HOST_ESP_ROM_GPIO_H_
+
+#include <stdint.h>
+
+inline void esp_rom_gpio_connect_out_signal(uint32_t, uint32_t, bool, bool){}
+
+#endif
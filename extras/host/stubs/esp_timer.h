@@ -0,0 +1,90 @@
+/**
+ * @file esp_timer.h
+ * @brief Host stand-in of the ESP-IDF esp_timer API, see extras/host/stubs/Arduino.h
+ *
+ * The timers never expire by themselves, the host tests fire them through srgxHostFireTmr().
+ */
+#ifndef _SRGX_HOST_ESP_TIMER_H_
+#define _SRGX_HOST_ESP_TIMER_H_
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_INVALID_STATE 0x103
+
+typedef void (*esp_timer_cb_t)(void* arg);
+typedef enum{
+   ESP_TIMER_TASK,
+   ESP_TIMER_ISR
+} esp_timer_dispatch_t;
+typedef struct{
+   esp_timer_cb_t callback;
+   void* arg;
+   esp_timer_dispatch_t dispatch_method;
+   const char* name;
+   bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+struct esp_timer{
+   esp_timer_cb_t callback;
+   void* arg;
+   uint64_t periodUs;
+   bool active;
+};
+typedef struct esp_timer* esp_timer_handle_t;
+
+int64_t esp_timer_get_time();
+
+inline esp_err_t esp_timer_create(const esp_timer_create_args_t* argsPtr, esp_timer_handle_t* hndlPtr){
+   *hndlPtr = new esp_timer{argsPtr->callback, argsPtr->arg, 0, false};
+
+   return ESP_OK;
+}
+inline esp_err_t esp_timer_delete(esp_timer_handle_t hndl){
+   delete hndl;
+
+   return ESP_OK;
+}
+inline bool esp_timer_is_active(esp_timer_handle_t hndl){ return hndl->active; }
+inline esp_err_t esp_timer_start_once(esp_timer_handle_t hndl, uint64_t tmoutUs){
+   hndl->periodUs = tmoutUs;
+   hndl->active = true;
+
+   return ESP_OK;
+}
+inline esp_err_t esp_timer_start_periodic(esp_timer_handle_t hndl, uint64_t periodUs){
+   hndl->periodUs = periodUs;
+   hndl->active = true;
+
+   return ESP_OK;
+}
+inline esp_err_t esp_timer_stop(esp_timer_handle_t hndl){
+   esp_err_t result{ESP_ERR_INVALID_STATE};
+
+   if(hndl->active){
+      hndl->active = false;
+      result = ESP_OK;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Runs the callback of an active timer, as its expiration would.
+ *
+ * @retval true The timer was active and its callback was run.
+ * @retval false The timer is stopped.
+ */
+inline bool srgxHostFireTmr(esp_timer_handle_t hndl){
+   bool result{false};
+
+   if((hndl != nullptr) && hndl->active){
+      hndl->callback(hndl->arg);
+      result = true;
+   }
+
+   return result;
+}
+
+#endif
@@ -0,0 +1,17 @@
+/**
+ * @file gpio_ll.h
+ * @brief Host stand-in of the ESP-IDF GPIO low level HAL, the accesses are counted as digitalWrite()/digitalRead() calls, see extras/host/stubs/Arduino.h
+ */
+#ifndef _SRGX_HOST_GPIO_LL_H_
+#define _SRGX_HOST_GPIO_LL_H_
+
+#include <Arduino.h>
+
+typedef int gpio_num_t;
+typedef struct{ uint32_t out; } gpio_dev_t;
+extern gpio_dev_t GPIO;
+
+inline void gpio_ll_set_level(gpio_dev_t*, gpio_num_t pin, uint32_t lvl){ digitalWrite(pin, lvl); }
+inline int gpio_ll_get_level(gpio_dev_t*, gpio_num_t pin){ return digitalRead(pin); }
+
+#endif
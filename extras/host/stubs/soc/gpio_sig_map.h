@@ -0,0 +1,10 @@
+/**
+ * @file gpio_sig_map.h
+ * @brief Host stand-in of the ESP32 GPIO matrix signals map, see extras/host/stubs/Arduino.h
+ */
+#ifndef _SRGX_HOST_GPIO_SIG_MAP_H_
+#define _SRGX_HOST_GPIO_SIG_MAP_H_
+
+#define SIG_GPIO_OUT_IDX 256
+
+#endif
@@ -0,0 +1,10 @@
+/**
+ * @file gpio_struct.h
+ * @brief Host stand-in of the ESP32 GPIO registers, see extras/host/stubs/hal/gpio_ll.h
+ */
+#ifndef _SRGX_HOST_GPIO_STRUCT_H_
+#define _SRGX_HOST_GPIO_STRUCT_H_
+
+#include <hal/gpio_ll.h>
+
+#endif
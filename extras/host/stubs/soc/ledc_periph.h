@@ -0,0 +1,15 @@
+/**
+ * @file ledc_periph.h
+ * @brief Host stand-in of the ESP32 LEDC peripheral signals table, see extras/host/stubs/Arduino.h
+ */
+#ifndef _SRGX_HOST_LEDC_PERIPH_H_
+#define _SRGX_HOST_LEDC_PERIPH_H_
+
+#include <stdint.h>
+
+typedef struct{
+   uint32_t sig_out0_idx;
+} ledc_signal_conn_t;
+static const ledc_signal_conn_t ledc_periph_signal[2]{{71}, {79}};
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file SRGXBulkWrtsTest.cpp
+ * @brief Host test comparing a digitalWriteSr() loop against a single writeMany() invocation
+ *
+ * The irregular updates of 8, 64 and 256 pins of the ShiftRegGPIOXpander_Example07 example are
+ * applied from the same starting image by a loop of digitalWriteSr() invocations and by a single
+ * writeMany() invocation. For each one the latches, the DS, SH_CP and ST_CP lines writes and the
+ * mutex takings per update are counted through the host stubs, and printed as CSV lines prefixed
+ * with "SRGXHOSTBULK,". Both must latch the same outputs, writeMany() in a single flush.
+ * The time taken is measured on the target by the Example07 example.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXHostTest.h>
+
+const uint8_t ds{33};
+const uint8_t sh_cp{26};
+const uint8_t st_cp{25};
+const uint16_t maxUpdtsQty{256};
+const uint16_t updtsQtys[]{8, 64, maxUpdtsQty};
+const uint8_t srQtys[]{4, 32};
+
+/**
+ * @brief Counters of an updates application.
+ */
+struct BulkCntrs{
+   uint32_t latchesQty;
+   uint32_t gpioWrtsQty;
+   uint32_t mtxTakesQty;
+};
+
+int main(){
+   SRGXHostCntrs &cntrs = srgxHostCntrs();
+   SRGXHostChain chain;
+   SRGXPinValue updts[maxUpdtsQty];
+
+   printf("SRGXHOSTBULK,updates,srQty,method,latches_per_update,gpio_wrts_per_update,mtx_takes_per_update\n");
+   for(uint8_t srQtyIdx{0}; srQtyIdx < sizeof(srQtys); srQtyIdx++){
+      const uint8_t srQty{srQtys[srQtyIdx]};
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      for(uint16_t updtInc{0}; updtInc < maxUpdtsQty; updtInc++){ // Irregular pins sequence, with alternating values, as in the Example07 example
+         updts[updtInc].pin = (updtInc * 13 + 5) % (srgx.getMaxSRGXPin() + 1);
+         updts[updtInc].value = (updtInc % 3)?HIGH:LOW;
+      }
+
+      for(uint8_t qtyIdx{0}; qtyIdx < sizeof(updtsQtys) / sizeof(updtsQtys[0]); qtyIdx++){
+         const uint16_t updtsQty{updtsQtys[qtyIdx]};
+         uint8_t loopOut[SRGXHostChain::maxSrQty];
+         BulkCntrs loopCntrs;
+         BulkCntrs bulkCntrs;
+         uint32_t latchesQty{0};
+
+         SRGX_CHECK(srgx.digitalWriteSrAllReset());
+         latchesQty = chain.latchesQty;
+         srgxHostRstCntrs();
+         for(uint16_t updtInc{0}; updtInc < updtsQty; updtInc++)
+            SRGX_CHECK(srgx.digitalWriteSr(updts[updtInc].pin, updts[updtInc].value));
+         loopCntrs = BulkCntrs{chain.latchesQty - latchesQty, cntrs.pinWrtsQty[ds] + cntrs.pinWrtsQty[sh_cp] + cntrs.pinWrtsQty[st_cp], cntrs.mtxTakesQty};
+         memcpy(loopOut, chain.out, srQty);
+
+         SRGX_CHECK(srgx.digitalWriteSrAllReset());
+         latchesQty = chain.latchesQty;
+         srgxHostRstCntrs();
+         SRGX_CHECK(srgx.writeMany(updts, updtsQty));
+         bulkCntrs = BulkCntrs{chain.latchesQty - latchesQty, cntrs.pinWrtsQty[ds] + cntrs.pinWrtsQty[sh_cp] + cntrs.pinWrtsQty[st_cp], cntrs.mtxTakesQty};
+
+         SRGX_CHECK(memcmp(loopOut, chain.out, srQty) == 0);  // The same outputs are latched
+         SRGX_CHECK(bulkCntrs.latchesQty == 1);
+         SRGX_CHECK(loopCntrs.latchesQty >= bulkCntrs.latchesQty);
+         SRGX_CHECK(loopCntrs.gpioWrtsQty >= bulkCntrs.gpioWrtsQty);
+         SRGX_CHECK(loopCntrs.mtxTakesQty >= bulkCntrs.mtxTakesQty);
+         for(uint16_t srPin{0}; srPin <= srgx.getMaxSRGXPin(); srPin++)   // The outputs latched match the Main Buffer
+            SRGX_CHECK(chain.outLvl(srPin) == srgx.digitalReadSr(srPin));
+         printf("SRGXHOSTBULK,%u,%u,digitalWriteSr loop,%.3f,%.1f,%.3f\n", updtsQty, srQty, (float)loopCntrs.latchesQty / updtsQty, (float)loopCntrs.gpioWrtsQty / updtsQty, (float)loopCntrs.mtxTakesQty / updtsQty);
+         printf("SRGXHOSTBULK,%u,%u,writeMany,%.3f,%.1f,%.3f\n", updtsQty, srQty, (float)bulkCntrs.latchesQty / updtsQty, (float)bulkCntrs.gpioWrtsQty / updtsQty, (float)bulkCntrs.mtxTakesQty / updtsQty);
+      }
+   }
+   printf("SRGXBulkWrtsTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdParserTest.cpp
+ * @brief Host test of the SRGXCmdParser class
+ *
+ * Frames are fed whole, byte by byte and mixed with garbage, corrupted frames and frames stalled by a
+ * corrupted length byte, checking every valid frame is extracted once and in order. The operations
+ * merging is checked against a reference applying each operation in turn.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXCmdParser.h>
+#include <SRGXStateStore.h>
+#include <SRGXHostTest.h>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+/**
+ * @brief Parser recording the frames extracted, and merging their operations for a 2 shift registers chain.
+ */
+class TstParser: public SRGXCmdParser{
+public:
+   std::vector<Bytes> frms;   // Sequence number followed by the operations of each frame
+
+   TstParser(): SRGXCmdParser(2){}
+   void _procFrm(const uint8_t &seq, const uint8_t* opsPtr, const uint8_t &opsLen) override{
+      Bytes frm{seq};
+
+      frm.insert(frm.end(), opsPtr, opsPtr + opsLen);
+      frms.push_back(frm);
+   }
+   bool merge(const Bytes &ops, const uint8_t &inSrQty, uint8_t* imgPtr, uint16_t &rdsLen){
+      uint16_t opsQty{0};
+      const bool result{_mergeOps(ops.data(), ops.size(), inSrQty, rdsLen, opsQty)};
+
+      if(result){
+         for(uint8_t bffrIdx{0}; bffrIdx < _srQty; bffrIdx++)
+            imgPtr[bffrIdx] = ((imgPtr[bffrIdx] & ~_mskPtr[bffrIdx]) | (_valsPtr[bffrIdx] & _mskPtr[bffrIdx])) ^ _tgglPtr[bffrIdx];
+      }
+
+      return result;
+   }
+};
+
+Bytes buildFrm(const uint8_t &seq, const Bytes &ops){
+   Bytes result{0xA5, static_cast<uint8_t>(ops.size() + 1), seq};
+
+   result.insert(result.end(), ops.begin(), ops.end());
+   const uint16_t crc{SRGXStateStore::crc16(result.data() + 1, result.size() - 1)};
+   result.push_back(crc & 0xFF);
+   result.push_back(crc >> 8);
+
+   return result;
+}
+
+uint16_t feed(TstParser &parser, const Bytes &data, const uint32_t &nowMs){
+
+   return parser.parse(data.data(), data.size(), nowMs);
+}
+
+Bytes cat(std::initializer_list<Bytes> parts){
+   Bytes result;
+
+   for(const Bytes &part: parts)
+      result.insert(result.end(), part.begin(), part.end());
+
+   return result;
+}
+
+int main(){
+   const Bytes frmA{buildFrm(1, {0x01, 0x02, 0x00, 0x09})};
+   const Bytes frmB{buildFrm(2, {0x06})};
+   const Bytes frmC{buildFrm(3, {0xA5, 0xA5, 0x05})};   // Start of frame values inside the frame
+
+   /*Whole frames, byte by byte, and garbage between them*/
+   {
+      TstParser parser;
+
+      SRGX_CHECK(feed(parser, cat({frmA, frmB}), 0) == 2);
+      for(uint8_t dataByte: cat({{0x00, 0x11, 0x5A}, frmC, {0xFF}, frmA}))
+         feed(parser, {dataByte}, 0);
+      SRGX_CHECK(parser.frms.size() == 4);
+      SRGX_CHECK((parser.frms[0] == Bytes{1, 0x01, 0x02, 0x00, 0x09}) && (parser.frms[1] == Bytes{2, 0x06}));
+      SRGX_CHECK((parser.frms[2] == Bytes{3, 0xA5, 0xA5, 0x05}) && (parser.frms[3][0] == 1));
+      SRGX_CHECK((parser.getFramesQty() == 4) && (parser.getCrcErrsQty() == 0));
+      SRGX_CHECK(feed(parser, {0xA5, 0x00}, 0) == 0);  // A zero length is not a frame
+      SRGX_CHECK(feed(parser, frmB, 0) == 1);
+   }
+
+   /*A CRC mismatch drops the start of frame byte only, a frame starting inside the corrupted one is extracted*/
+   {
+      TstParser parser;
+      Bytes bad{frmA};
+
+      bad[bad.size() - 1] ^= 0x01;
+      SRGX_CHECK(feed(parser, cat({bad, frmB}), 0) == 1);
+      SRGX_CHECK((parser.getCrcErrsQty() == 1) && (parser.frms.size() == 1) && (parser.frms[0][0] == 2));
+
+      Bytes trnc(frmA.begin(), frmA.begin() + 4);   // Truncated frame, the next frame completes it's length and fails the CRC
+      SRGX_CHECK(feed(parser, cat({trnc, frmC, frmB}), 0) == 2);
+      SRGX_CHECK((parser.frms.size() == 3) && (parser.frms[1][0] == 3) && (parser.frms[2][0] == 2));
+      SRGX_CHECK(parser.getCrcErrsQty() == 2);
+   }
+
+   /*A corrupted length byte stalls the frame until the inter-byte timeout, the frames buffered after it are then extracted*/
+   {
+      TstParser parser;
+      const Bytes stall{0xA5, 0xF0, 0x07, 0x01};
+
+      SRGX_CHECK(feed(parser, cat({stall, frmB, frmC}), 1000) == 0);
+      SRGX_CHECK(parser.chkRxTmout(1100) == 0);  // Not yet expired
+      SRGX_CHECK(parser.chkRxTmout(1101) == 2);
+      SRGX_CHECK((parser.frms.size() == 2) && (parser.frms[0][0] == 2) && (parser.frms[1][0] == 3));
+      SRGX_CHECK(parser.getRxTmoutsQty() == 1);
+      SRGX_CHECK((feed(parser, frmA, 1102) == 1) && (parser.frms.back()[0] == 1));
+
+      SRGX_CHECK(feed(parser, cat({stall, frmB}), 2000) == 0);   // Expired when the next bytes arrive
+      SRGX_CHECK(feed(parser, frmC, 2500) == 2);
+      SRGX_CHECK((parser.frms.size() == 5) && (parser.frms[3][0] == 2) && (parser.frms[4][0] == 3));
+
+      Bytes part(frmA.begin(), frmA.begin() + 5);  // The bytes of a partial frame, stalled and completed later, are dropped
+      SRGX_CHECK(feed(parser, part, 3000) == 0);
+      SRGX_CHECK(feed(parser, Bytes(frmA.begin() + 5, frmA.end()), 3200) == 0);
+      SRGX_CHECK(feed(parser, frmB, 3201) == 1);
+      SRGX_CHECK(parser.getRxTmoutsQty() == 3);
+
+      parser.setRxTmout(0);   // Disabled
+      SRGX_CHECK(feed(parser, part, 4000) == 0);
+      SRGX_CHECK(feed(parser, Bytes(frmA.begin() + 5, frmA.end()), 90000) == 1);
+   }
+
+   /*Operations merging*/
+   {
+      TstParser parser;
+      uint8_t img[2]{0x0F, 0xF0};
+      uint16_t rdsLen{0};
+
+      SRGX_CHECK(parser.merge({0x01, 0x02, 0x04, 0x08, 0x03, 0x02, 0x04, 0x00, 0x02, 0x01, 0x0F}, 0, img, rdsLen));  // Set 4, 8, toggle 4, 0, reset 15
+      SRGX_CHECK((img[0] == 0x0E) && (img[1] == 0x71) && (rdsLen == 0));
+      SRGX_CHECK(parser.merge({0x03, 0x01, 0x09, 0x01, 0x01, 0x09}, 0, img, rdsLen));   // A set after a toggle overrides it
+      SRGX_CHECK(img[1] == 0x73);
+      SRGX_CHECK(parser.merge({0x04, 0x06, 0x04, 0x3C, 0x00, 0x06, 0x00}, 2, img, rdsLen));   // Port of pins 6 to 9 set to 0b1100, reads
+      SRGX_CHECK((img[0] == 0x0E) && (img[1] == 0x73) && (rdsLen == 5));
+      SRGX_CHECK(parser.merge({0x03, 0x01, 0x00, 0x05, 0x12, 0x34, 0x03, 0x01, 0x0C, 0x07}, 2, img, rdsLen));   // A stamp replaces the preceding writes
+      SRGX_CHECK((img[0] == 0x12) && (img[1] == 0x24) && (rdsLen == 2));
+
+      img[0] = 0x55;
+      SRGX_CHECK(!parser.merge({0x01, 0x01, 0x10}, 0, img, rdsLen));  // Pin out of range
+      SRGX_CHECK(!parser.merge({0x01, 0x00}, 0, img, rdsLen));   // Empty pins list
+      SRGX_CHECK(!parser.merge({0x01, 0x03, 0x00}, 0, img, rdsLen));   // Truncated pins list
+      SRGX_CHECK(!parser.merge({0x04, 0x0F, 0x02, 0x00}, 0, img, rdsLen));   // Truncated port
+      SRGX_CHECK(!parser.merge({0x04, 0x0F, 0x02, 0x00, 0x00}, 0, img, rdsLen));   // Port out of range
+      SRGX_CHECK(!parser.merge({0x04, 0x00, 0x11, 0x00, 0x00}, 0, img, rdsLen));   // Port too wide
+      SRGX_CHECK(!parser.merge({0x05, 0x00}, 0, img, rdsLen));   // Truncated stamp
+      SRGX_CHECK(!parser.merge({0x07}, 0, img, rdsLen));  // No inputs
+      SRGX_CHECK(!parser.merge({0x08}, 0, img, rdsLen));  // Unknown opcode
+      SRGX_CHECK(parser.merge(Bytes(126, 0x06), 0, img, rdsLen) && (rdsLen == 252));
+      SRGX_CHECK(!parser.merge(Bytes(127, 0x06), 0, img, rdsLen));   // The data read does not fit a response frame
+      SRGX_CHECK((img[0] == 0x55) && (img[1] == 0x24));
+   }
+   printf("SRGXCmdParserTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdSrvrPtyTest.cpp
+ * @brief Host test of the SRGXCmdSrvr class against the extras/SRGXCmdClient.py client
+ *
+ * A SRGXCmdSrvr object serving a 2 shift registers ShiftRegGPIOXpander object is run on the master
+ * side of a pseudo-terminal, and the client's selftest command on the slave side, so the protocol,
+ * the resynchronization and the frames batching are verified on the real server code. The clock of
+ * the stubs follows the real time, so the inter-byte timeout is exercised too.
+ *
+ * The test must be run from the extras/host directory, as done by the Makefile.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXCmdSrvr.h>
+#include <SRGXHostTest.h>
+#include <chrono>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+size_t wrtRsp(const uint8_t* dataPtr, const size_t &dataLen, void* argp){
+   const int mstrFd{*static_cast<int*>(argp)};
+
+   return write(mstrFd, dataPtr, dataLen);
+}
+
+/**
+ * @brief Moves the stubs clock to the real time elapsed, never backwards.
+ */
+void syncClk(const std::chrono::steady_clock::time_point &strtTm){
+   const int64_t realUs{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - strtTm).count()};
+
+   if(realUs > srgxHostCntrs().clkUs)
+      srgxHostCntrs().clkUs = realUs;
+
+   return;
+}
+
+int main(){
+   const std::chrono::steady_clock::time_point strtTm{std::chrono::steady_clock::now()};
+   SRGXHostChain chain;
+   ShiftRegGPIOXpander srgx(1, 2, 3, 2);
+   SRGXCmdSrvr srvr(&srgx);
+   int mstrFd{posix_openpt(O_RDWR | O_NOCTTY)};
+
+   SRGX_CHECK(mstrFd >= 0);
+   SRGX_CHECK((grantpt(mstrFd) == 0) && (unlockpt(mstrFd) == 0));
+   chain.attach(1, 2, 3, 2);
+   SRGX_CHECK(srgx.begin());
+   srvr.setWrtCb(wrtRsp, &mstrFd);
+
+   const pid_t clntPid{fork()};
+   SRGX_CHECK(clntPid >= 0);
+   if(clntPid == 0){
+      execlp("python3", "python3", "../SRGXCmdClient.py", ptsname(mstrFd), "selftest", "--frames", "300", "--ops", "8", static_cast<char*>(nullptr));
+      _exit(127);
+   }
+
+   int clntSt{0};
+   bool clntRnng{true};
+   while(clntRnng){
+      struct pollfd pollFd{mstrFd, POLLIN, 0};
+      uint8_t rxBffr[256];
+
+      if((poll(&pollFd, 1, 5) > 0) && (pollFd.revents & POLLIN)){
+         const ssize_t rxQty{read(mstrFd, rxBffr, sizeof(rxBffr))};
+
+         syncClk(strtTm);
+         if(rxQty > 0)
+            srvr.feed(rxBffr, rxQty);
+      }
+      syncClk(strtTm);
+      srvr.chkRxTmout(millis());
+      clntRnng = (waitpid(clntPid, &clntSt, WNOHANG) == 0);
+   }
+   SRGX_CHECK(WIFEXITED(clntSt) && (WEXITSTATUS(clntSt) == 0));
+   SRGX_CHECK((srvr.getCrcErrsQty() >= 2) && (srvr.getRxTmoutsQty() >= 1));
+   SRGX_CHECK(srvr.getFramesQty() >= 300);
+   for(uint8_t srPin{0}; srPin <= srgx.getMaxSRGXPin(); srPin++)   // The outputs latched match the Main Buffer
+      SRGX_CHECK(chain.outLvl(srPin) == srgx.digitalReadSr(srPin));
+   close(mstrFd);
+   printf("SRGXCmdSrvrPtyTest ok: %lu frames, %lu operations, %lu CRC errors, %lu inter-byte timeouts\n", (unsigned long)srvr.getFramesQty(), (unsigned long)srvr.getOpsQty(), (unsigned long)srvr.getCrcErrsQty(), (unsigned long)srvr.getRxTmoutsQty());
+
+   return 0;
+}
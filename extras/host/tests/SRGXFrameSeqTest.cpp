@@ -0,0 +1,139 @@
+/**
+ ******************************************************************************
+ * @file SRGXFrameSeqTest.cpp
+ * @brief Host test of the SRGXFrameSeq class
+ *
+ * Pseudo random full frames sequences are delta-encoded, then walked forwards and backwards in both
+ * formats, checking every frame rebuilt from the deltas against the full frame. The consistency
+ * checks are exercised with corrupted and truncated tables.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXFrameSeq.h>
+#include <SRGXHostTest.h>
+
+const uint16_t maxFramesQty{24};
+const uint8_t maxFrameLen{8};
+
+uint32_t rndSeed{0x2545F491};
+
+uint8_t rndByte(){
+   rndSeed = rndSeed * 1664525 + 1013904223;
+
+   return rndSeed >> 24;
+}
+
+/**
+ * @brief Walks the whole sequence forwards then backwards, checking each frame against the full frames.
+ */
+void chkWalk(SRGXFrameSeq &frameSeq, const uint8_t* framesPtr, const uint16_t &framesQty, const uint8_t &frameLen){
+   uint8_t img[maxFrameLen];
+   const uint8_t* pairsPtr{nullptr};
+   uint8_t pairsQty{0};
+
+   frameSeq.rewind();
+   SRGX_CHECK(frameSeq.getCurFrame() == 0);
+   SRGX_CHECK(frameSeq.getCurFramePtr() != nullptr);
+   memcpy(img, frameSeq.getCurFramePtr(), frameLen);
+   SRGX_CHECK(memcmp(img, framesPtr, frameLen) == 0);
+   SRGX_CHECK(!frameSeq.stepBwd(pairsPtr, pairsQty) && (pairsPtr == nullptr) && (pairsQty == 0));
+   for(uint16_t frameInc{1}; frameInc < framesQty; frameInc++){
+      SRGX_CHECK(frameSeq.stepFwd(pairsPtr, pairsQty));
+      SRGX_CHECK(frameSeq.getCurFrame() == frameInc);
+      if(frameSeq.isDeltaEnc()){
+         SRGX_CHECK(frameSeq.getCurFramePtr() == nullptr);   // Only the key frame is stored in full
+         SRGXFrameSeq::applyDelta(img, pairsPtr, pairsQty);
+      }
+      else
+         memcpy(img, frameSeq.getCurFramePtr(), frameLen);
+      SRGX_CHECK(memcmp(img, framesPtr + frameInc * frameLen, frameLen) == 0);
+   }
+   SRGX_CHECK(!frameSeq.stepFwd(pairsPtr, pairsQty) && (frameSeq.getCurFrame() == framesQty - 1));
+   for(uint16_t frameInc{static_cast<uint16_t>(framesQty - 1)}; frameInc > 0; frameInc--){
+      SRGX_CHECK(frameSeq.stepBwd(pairsPtr, pairsQty));
+      SRGX_CHECK(frameSeq.getCurFrame() == frameInc - 1);
+      if(frameSeq.isDeltaEnc())
+         SRGXFrameSeq::applyDelta(img, pairsPtr, pairsQty);
+      else
+         memcpy(img, frameSeq.getCurFramePtr(), frameLen);
+      SRGX_CHECK(memcmp(img, framesPtr + (frameInc - 1) * frameLen, frameLen) == 0);
+   }
+   SRGX_CHECK(!frameSeq.stepBwd(pairsPtr, pairsQty) && (frameSeq.getCurFrame() == 0));
+
+   return;
+}
+
+int main(){
+   uint8_t frames[maxFramesQty * maxFrameLen];
+   uint8_t enc[maxFramesQty * (2 * maxFrameLen + 2) + maxFrameLen];
+   SRGXFrameSeq emptySeq;
+
+   SRGX_CHECK(!emptySeq.isValid() && (emptySeq.getCurFramePtr() == nullptr));
+   SRGX_CHECK(SRGXFrameSeq::encodeDelta(nullptr, 1, 1, enc, sizeof(enc)) == 0);
+   SRGX_CHECK(SRGXFrameSeq::encodeDelta(frames, 0, 1, enc, sizeof(enc)) == 0);
+   SRGX_CHECK(SRGXFrameSeq::encodeDelta(frames, 1, 0, enc, sizeof(enc)) == 0);
+
+   for(uint16_t seqInc{0}; seqInc < 500; seqInc++){
+      const uint16_t framesQty{static_cast<uint16_t>(1 + rndByte() % maxFramesQty)};
+      const uint8_t frameLen{static_cast<uint8_t>(1 + rndByte() % maxFrameLen)};
+      const uint8_t chgRate{rndByte()}; // Probability of each byte changing from the previous frame
+
+      for(uint8_t byteInc{0}; byteInc < frameLen; byteInc++)
+         frames[byteInc] = rndByte();
+      for(uint16_t frameInc{1}; frameInc < framesQty; frameInc++){
+         for(uint8_t byteInc{0}; byteInc < frameLen; byteInc++)
+            frames[frameInc * frameLen + byteInc] = (rndByte() < chgRate)?rndByte():frames[(frameInc - 1) * frameLen + byteInc];
+      }
+
+      SRGXFrameSeq fullSeq(frames, framesQty, frameLen, false, framesQty * static_cast<uint32_t>(frameLen));
+      SRGX_CHECK(fullSeq.isValid() && !fullSeq.isDeltaEnc());
+      SRGX_CHECK((fullSeq.getFramesQty() == framesQty) && (fullSeq.getFrameLen() == frameLen));
+      SRGX_CHECK(!SRGXFrameSeq(frames, framesQty, frameLen, false, framesQty * static_cast<uint32_t>(frameLen) - 1).isValid());
+      chkWalk(fullSeq, frames, framesQty, frameLen);
+
+      const uint32_t encLen{SRGXFrameSeq::encodeDelta(frames, framesQty, frameLen, nullptr, 0)};
+      SRGX_CHECK((encLen >= frameLen + 2 * static_cast<uint32_t>(framesQty - 1)) && (encLen <= sizeof(enc)));
+      SRGX_CHECK(SRGXFrameSeq::encodeDelta(frames, framesQty, frameLen, enc, encLen - 1) == 0);  // Not fitting
+      SRGX_CHECK(SRGXFrameSeq::encodeDelta(frames, framesQty, frameLen, enc, encLen) == encLen);
+
+      SRGXFrameSeq deltaSeq(enc, framesQty, frameLen, true, encLen);
+      SRGX_CHECK(deltaSeq.isValid() && deltaSeq.isDeltaEnc());
+      chkWalk(deltaSeq, frames, framesQty, frameLen);
+      chkWalk(deltaSeq, frames, framesQty, frameLen);   // Rewinding restores the cursor
+      SRGX_CHECK(!SRGXFrameSeq(enc, framesQty, frameLen, true, encLen - 1).isValid());   // Truncated table
+      SRGX_CHECK(!SRGXFrameSeq(enc, framesQty, frameLen, true, encLen + 1).isValid());   // Bytes left after the last record
+
+      if(framesQty > 1){
+         const uint8_t chgQty{enc[frameLen]};
+
+         enc[frameLen + 1 + 2 * chgQty]++;   // Trailing count not matching the leading one
+         SRGX_CHECK(!SRGXFrameSeq(enc, framesQty, frameLen, true, encLen).isValid());
+         enc[frameLen + 1 + 2 * chgQty]--;
+
+         uint8_t* encCpy = new uint8_t[encLen];  // Exact size, so reading beyond the table end is reported by the sanitizer
+         const uint8_t lastChgQty{enc[encLen - 1]};
+
+         memcpy(encCpy, enc, encLen);
+         encCpy[encLen - 2 - 2 * lastChgQty]++;  // Last record leading count running it beyond the table end
+         SRGX_CHECK(!SRGXFrameSeq(encCpy, framesQty, frameLen, true, encLen).isValid());
+         delete [] encCpy;
+         if(chgQty > 0){
+            const uint8_t bffrIdx{enc[frameLen + 1]};
+
+            enc[frameLen + 1] = frameLen;   // Changing byte out of the frame
+            SRGX_CHECK(!SRGXFrameSeq(enc, framesQty, frameLen, true, encLen).isValid());
+            enc[frameLen + 1] = bffrIdx;
+         }
+         SRGX_CHECK(SRGXFrameSeq(enc, framesQty, frameLen, true, encLen).isValid());
+      }
+   }
+   printf("SRGXFrameSeqTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @file SRGXGpioWrtsTest.cpp
+ * @brief Host test counting the shift registers lines GPIO writes of each public API method
+ *
+ * The operations are the ones benchmarked by the ShiftRegGPIOXpander_Example09 example, run by a
+ * single task over chains of 1 to 32 shift registers. For each one the flushes, the DS, SH_CP and
+ * ST_CP lines writes and the mutex takings are counted through the host stubs, and printed as CSV
+ * lines prefixed with "SRGXHOSTGPIO,", the outputs latched are checked against the Main Buffer after
+ * every operation.
+ * The writeAsync+wait and SRGXVPort::writePortAsync+wait operations are left out: their writes are
+ * flushed by the asynchronous writes task, see SRGXLinearizabilityTest.cpp.
+ * No time per operation nor contention is measured, the stubs are single threaded: the nanoseconds
+ * per operation of 1 to 8 concurrent tasks are measured on the target by the Example09 example.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXHostTest.h>
+
+const uint8_t ds{33};
+const uint8_t sh_cp{26};
+const uint8_t st_cp{25};
+const uint32_t opsQty{64};
+
+/**
+ * @brief Objects and data used by the measured operations, as in the ShiftRegGPIOXpander_Example09 example.
+ */
+struct BenchObjs{
+   ShiftRegGPIOXpander* srgxPtr;
+   SRGXVPort* portPtr;  // Pins 0 to 3, shared
+   SRGXVPort* exclPortPtr; // Pins 4 to 7, reserved for it's exclusive use
+   uint8_t msk[32];
+   uint8_t vals[32];
+   SRGXPinValue items[8];
+   uint8_t pins[8];
+};
+
+/**
+ * @brief A measured operation, rdOnly operations must not write the shift registers lines.
+ */
+struct BenchOp{
+   const char* name;
+   void (*opFn)(BenchObjs &objs, const uint32_t &opIdx);
+   bool rdOnly;
+};
+
+uint8_t benchPin(BenchObjs &objs, const uint32_t &opIdx){
+   uint8_t pin = (opIdx * 5) % (objs.srgxPtr->getMaxSRGXPin() + 1);
+
+   if((pin >= 4) && (pin < 8))
+      pin -= 4;
+
+   return pin;
+}
+
+const BenchOp benchOps[]{
+   {"digitalWriteSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSr(benchPin(o, i), i & 0x01);}, false},
+   {"digitalWriteSr(SRGXPinDsc)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSr(SRGXPin<1, 3>(), i & 0x01);}, false},
+   {"digitalToggleSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSr(benchPin(o, i));}, false},
+   {"digitalReadSr", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalReadSr(benchPin(o, i));}, true},
+   {"digitalReadSgmntSr", [](BenchObjs &o, const uint32_t &i){uint16_t sgmnt{0}; o.srgxPtr->digitalReadSgmntSr(0, 8, sgmnt);}, true},
+   {"setBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->setBit(benchPin(o, i));}, false},
+   {"resetBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->resetBit(benchPin(o, i));}, false},
+   {"flipBit", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->flipBit(benchPin(o, i));}, false},
+   {"digitalWriteSrAllSet", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrAllSet();}, false},
+   {"digitalWriteSrAllReset", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrAllReset();}, false},
+   {"digitalToggleSrAll", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSrAll();}, false},
+   {"digitalWriteSrMaskSet", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrMaskSet(o.msk);}, false},
+   {"digitalWriteSrMaskReset", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrMaskReset(o.msk);}, false},
+   {"digitalToggleSrMask", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalToggleSrMask(o.msk);}, false},
+   {"stampOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampOverMain(o.vals);}, false},
+   {"stampMaskOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampMaskOverMain(o.msk, o.vals);}, false},
+   {"stampSgmntOverMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->stampSgmntOverMain(o.vals, 0, 4);}, false},
+   {"digitalWriteSrToAux+moveAuxToMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrToAux(benchPin(o, i), HIGH); o.srgxPtr->moveAuxToMain();}, false},
+   {"copyMainToAux+discardAux", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->copyMainToAux(); o.srgxPtr->discardAux();}, true},
+   {"writeMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->writeMany(o.items, 8);}, false},
+   {"setMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->setMany(o.pins, 8);}, false},
+   {"resetMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->resetMany(o.pins, 8);}, false},
+   {"toggleMany(8)", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->toggleMany(o.pins, 8);}, false},
+   {"digitalWriteSrToSnapshot+moveSnapshotToMain", [](BenchObjs &o, const uint32_t &i){o.srgxPtr->digitalWriteSrToSnapshot(0, benchPin(o, i), HIGH); o.srgxPtr->moveSnapshotToMain(0);}, false},
+   {"SRGXVPort::writePort", [](BenchObjs &o, const uint32_t &i){o.portPtr->writePort(i & 0x0F);}, false},
+   {"SRGXVPort::readPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->readPort();}, true},
+   {"SRGXVPort::digitalWriteSr", [](BenchObjs &o, const uint32_t &i){o.portPtr->digitalWriteSr(i % 4, i & 0x01);}, false},
+   {"SRGXVPort::setBit", [](BenchObjs &o, const uint32_t &i){o.portPtr->setBit(i % 4);}, false},
+   {"SRGXVPort::incPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->incPort();}, false},
+   {"SRGXVPort::xorPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->xorPort(0x05);}, false},
+   {"SRGXVPort::cmpXchgPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->cmpXchgPort(o.portPtr->readPort(), i & 0x0F);}, false},
+   {"SRGXVPort::rotLPort", [](BenchObjs &o, const uint32_t &i){o.portPtr->rotLPort();}, false},
+   {"SRGXVPort::writePort(exclusive)", [](BenchObjs &o, const uint32_t &i){o.exclPortPtr->writePort(i & 0x0F);}, false},
+};
+const uint8_t benchOpsQty{sizeof(benchOps) / sizeof(benchOps[0])};
+
+const uint8_t srQtys[]{1, 2, 4, 8, 16, 32};
+
+int main(){
+   SRGXHostCntrs &cntrs = srgxHostCntrs();
+   SRGXHostChain chain;
+   BenchObjs benchObjs;
+
+   printf("SRGXHOSTGPIO,method,srQty,ops,flushes_per_op,gpio_wrts_per_op,mtx_takes_per_op\n");
+   for(uint8_t srQtyIdx{0}; srQtyIdx < sizeof(srQtys); srQtyIdx++){
+      const uint8_t srQty{srQtys[srQtyIdx]};
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      SRGX_CHECK(srgx.beginSnapshots(1));
+      SRGXVPort port{srgx.createSRGXVPort(0, 4)};
+      SRGXVPort exclPort{srgx.createSRGXVPort(4, 4)};
+      SRGX_CHECK(port.begin(0));
+      SRGX_CHECK(exclPort.begin(0));
+      SRGX_CHECK(exclPort.reservePins());
+      SRGX_CHECK(srgx.setBit(SRGXPin<32, 255>()) == (srQty == 32));   // A descriptor built for a longer chain is rejected, not written beyond the buffers
+      SRGX_CHECK(srgx.resetBit(SRGXPin<32, 255>()) == (srQty == 32));
+      SRGX_CHECK(srgx.isValid(SRGXPin<32, 255>()) == (srQty == 32));
+
+      benchObjs.srgxPtr = &srgx;
+      benchObjs.portPtr = &port;
+      benchObjs.exclPortPtr = &exclPort;
+      for(uint8_t idx{0}; idx < 32; idx++){
+         benchObjs.msk[idx] = (idx == 0)?0x0F:0x5A;   // The exclusive port pins are left out of the masks
+         benchObjs.vals[idx] = 0xA5 ^ idx;
+      }
+      for(uint8_t idx{0}; idx < 8; idx++){
+         benchObjs.pins[idx] = benchPin(benchObjs, idx * 7 + 1);
+         benchObjs.items[idx] = SRGXPinValue{benchObjs.pins[idx], static_cast<uint8_t>(idx & 0x01)};
+      }
+
+      for(uint8_t opIdx{0}; opIdx < benchOpsQty; opIdx++){
+         uint32_t flshsQty{0};
+         uint32_t gpioWrtsQty{0};
+         uint32_t mtxTakesQty{0};
+
+         for(uint32_t opInc{0}; opInc < opsQty; opInc++){
+            const uint32_t latchesQty{chain.latchesQty};
+
+            srgxHostRstCntrs();
+            benchOps[opIdx].opFn(benchObjs, opInc);
+            flshsQty += chain.latchesQty - latchesQty;
+            gpioWrtsQty += cntrs.pinWrtsQty[ds] + cntrs.pinWrtsQty[sh_cp] + cntrs.pinWrtsQty[st_cp];
+            mtxTakesQty += cntrs.mtxTakesQty;
+            for(uint16_t srPin{0}; srPin <= srgx.getMaxSRGXPin(); srPin++)   // The outputs latched match the Main Buffer
+               SRGX_CHECK(chain.outLvl(srPin) == srgx.digitalReadSr(srPin));
+         }
+
+         if(benchOps[opIdx].rdOnly)
+            SRGX_CHECK(gpioWrtsQty == 0);
+         printf("SRGXHOSTGPIO,%s,%u,%lu,%.3f,%.1f,%.3f\n", benchOps[opIdx].name, srQty, (unsigned long)opsQty, (float)flshsQty / opsQty, (float)gpioWrtsQty / opsQty, (float)mtxTakesQty / opsQty);
+      }
+      SRGX_CHECK(exclPort.releasePins());
+   }
+   printf("SRGXHOSTGPIO,done\n");
+
+   return 0;
+}
@@ -0,0 +1,488 @@
+/**
+ ******************************************************************************
+ * @file SRGXLinearizabilityTest.cpp
+ * @brief Host linearizability harness of the ShiftRegGPIOXpander_ESP32 mutators
+ *
+ * The harness runs the operations mix of the ShiftRegGPIOXpander_Example10 example -every mutator
+ * that writes the pins of a single shift register, including the Auxiliary Buffer and the
+ * asynchronous ones, and the snapshot slots sequences- from several simulated tasks over a single
+ * object, each task owning one shift register and keeping a sequential model of it.
+ * A snapshot commit writes the whole chain: the slot image is modeled from every task's model when
+ * staged, and the commit sets every task's model to it, but for the pins reserved by the odd tasks'
+ * exclusive SRGXVPort objects.
+ * The library methods are serialized by the Main Buffer mutex, the lost updates happen between the
+ * calls of the multi-call sequences: an Auxiliary Buffer or a snapshot slot staged and moved later,
+ * an asynchronous write queued and applied later by the flushing task. So the steps of the tasks
+ * -every library call and every read back- and the runs of the library's asynchronous flushing task
+ * are interleaved by a seeded random scheduler, every seed being a different interleaving,
+ * reproduced by it's number.
+ * For every interleaving:
+ * - The task's register read back after each operation must hold the value of it's model.
+ * - The frames latched by the chain, projected over each task's register, must be a subsequence of
+ * the values the task's model took, in order.
+ * - The last frame latched must hold the final value of every task, and every asynchronous write
+ * handle must be completed.
+ * The checker is verified to fail on a lost update by a run injecting a stale image, see staleRun.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXHostTest.h>
+#include <vector>
+
+const uint8_t ds{33};
+const uint8_t sh_cp{26};
+const uint8_t st_cp{25};
+const uint8_t tsksQty{4};  // One shift register each
+const uint16_t opsPerTsk{200};
+const uint16_t seedsQty{1000};
+const uint8_t opsMixQty{33};
+
+/**
+ * @brief State of each simulated task for the current interleaving.
+ */
+struct LinTsk{
+   SRGXVPort* portPtr;  // Pins 4 to 7 of the task's shift register, exclusive for the odd tasks
+   uint32_t rndSeed;
+   uint32_t opRnd;   // Random value of the operation in progress
+   uint8_t opCode;
+   uint8_t opStep;   // Next step of the operation in progress, 0xFF for it's read back
+   uint16_t opsDone;
+   uint8_t model;   // Value the task's shift register must hold
+   std::vector<uint8_t> hist;   // Values taken by the model, hist[0] is the value at the start
+   uint32_t lostUpdtsQty;  // Main Buffer read backs not matching the model
+   SRGXAsyncHndl asyncHndl;   // Last asynchronous write
+   uint8_t slotImg[tsksQty];  // Image the task's snapshot slot must hold, the slot index is the task's index
+};
+
+SRGXHostChain chain;
+std::vector<std::vector<uint8_t>> frames;
+
+/**
+ * @brief Marsaglia's xorshift32 pseudo random numbers generator.
+ */
+uint32_t xorShift(uint32_t &seed){
+   seed ^= seed << 13;
+   seed ^= seed >> 17;
+   seed ^= seed << 5;
+
+   return seed;
+}
+
+void latchHook(const SRGXHostChain &latchChain){
+   frames.emplace_back(latchChain.out, latchChain.out + tsksQty);
+
+   return;
+}
+
+uint8_t mskdVal(const uint8_t &curVal, const uint8_t &msk, const uint8_t &vals){
+
+   return (curVal & ~msk) | (vals & msk);
+}
+
+/**
+ * @brief Models the staging of the task's empty snapshot slot from the Main Buffer, that must hold every task's model.
+ */
+void stageSlot(LinTsk* tsksPtr, const uint8_t &tskIdx){
+   for(uint8_t regIdx{0}; regIdx < tsksQty; regIdx++)
+      tsksPtr[tskIdx].slotImg[regIdx] = tsksPtr[regIdx].model;
+
+   return;
+}
+
+/**
+ * @brief Models the commit of the task's snapshot slot, setting every task's model to it's slot register but the reserved pins.
+ */
+void commitSlot(LinTsk* tsksPtr, const uint8_t &tskIdx){
+   for(uint8_t regIdx{0}; regIdx < tsksQty; regIdx++){
+      LinTsk &regTsk{tsksPtr[regIdx]};
+
+      regTsk.model = mskdVal(regTsk.model, (regIdx % 2)?0x0F:0xFF, tsksPtr[tskIdx].slotImg[regIdx]);  // The odd tasks' pins 4 to 7 are reserved by their exclusive SRGXVPort
+      if((regIdx != tskIdx) && (regTsk.hist.back() != regTsk.model))
+         regTsk.hist.push_back(regTsk.model);
+   }
+
+   return;
+}
+
+/**
+ * @brief Executes the next step of the task's operation, updating the task's model.
+ *
+ * @retval true The operation is complete.
+ * @retval false The operation has steps left, other tasks might run before them.
+ */
+bool stepOp(ShiftRegGPIOXpander &srgx, LinTsk* tsksPtr, const uint8_t &tskIdx){
+   LinTsk &tsk{tsksPtr[tskIdx]};
+   const uint8_t basePin{static_cast<uint8_t>(tskIdx * 8)};
+   const uint32_t rnd{tsk.opRnd};
+   const uint8_t pin{static_cast<uint8_t>(rnd & 0x03)};   // Pins 0 to 3, through the ShiftRegGPIOXpander methods
+   const uint8_t val{static_cast<uint8_t>((rnd >> 2) & 0x0F)};
+   const uint8_t pinMsk{static_cast<uint8_t>(0x01 << pin)};
+   const uint8_t port{static_cast<uint8_t>(tsk.model >> 4)};
+   uint8_t msk[tsksQty]{};
+   uint8_t vals[tsksQty]{};
+   bool result{true};
+
+   msk[tskIdx] = (rnd >> 6) & 0x0F;
+   vals[tskIdx] = (rnd >> 10) & 0x0F;
+   switch(tsk.opCode){
+      case 0:
+         srgx.digitalWriteSr(basePin + pin, val & 0x01);
+         tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+         break;
+      case 1:
+         srgx.digitalToggleSr(basePin + pin);
+         tsk.model ^= pinMsk;
+         break;
+      case 2:
+         srgx.setBit(basePin + pin);
+         tsk.model |= pinMsk;
+         break;
+      case 3:
+         srgx.resetBit(basePin + pin);
+         tsk.model &= ~pinMsk;
+         break;
+      case 4:
+         srgx.flipBit(basePin + pin);
+         tsk.model ^= pinMsk;
+         break;
+      case 5:
+         srgx.digitalWriteSrMaskSet(msk);
+         tsk.model |= msk[tskIdx];
+         break;
+      case 6:
+         srgx.digitalWriteSrMaskReset(msk);
+         tsk.model &= ~msk[tskIdx];
+         break;
+      case 7:
+         srgx.digitalToggleSrMask(msk);
+         tsk.model ^= msk[tskIdx];
+         break;
+      case 8:
+         srgx.stampMaskOverMain(msk, vals);
+         tsk.model = mskdVal(tsk.model, msk[tskIdx], vals[tskIdx]);
+         break;
+      case 9:{
+         uint8_t sgmnt[2]{val, 0x00};
+
+         srgx.stampSgmntOverMain(sgmnt, basePin, 4);
+         tsk.model = mskdVal(tsk.model, 0x0F, val);
+         break;
+      }
+      case 10:{
+         const uint8_t pin2{static_cast<uint8_t>((pin + 1) & 0x03)};
+         const SRGXPinValue items[2]{{static_cast<uint8_t>(basePin + pin), static_cast<uint8_t>(val & 0x01)}, {static_cast<uint8_t>(basePin + pin2), static_cast<uint8_t>(val & 0x02)}};
+
+         srgx.writeMany(items, 2);
+         tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+         tsk.model = mskdVal(tsk.model, 0x01 << pin2, (val & 0x02)?0xFF:0x00);
+         break;
+      }
+      case 11:{
+         const uint8_t pins[2]{static_cast<uint8_t>(basePin + pin), static_cast<uint8_t>(basePin + ((pin + 2) & 0x03))};
+
+         srgx.toggleMany(pins, 2);
+         tsk.model ^= pinMsk | (0x01 << ((pin + 2) & 0x03));
+         break;
+      }
+      case 12:{
+         const uint8_t pins[2]{static_cast<uint8_t>(basePin + pin), static_cast<uint8_t>(basePin + ((pin + 1) & 0x03))};
+
+         srgx.setMany(pins, 2);
+         tsk.model |= pinMsk | (0x01 << ((pin + 1) & 0x03));
+         break;
+      }
+      case 13:{
+         const uint8_t pins[2]{static_cast<uint8_t>(basePin + pin), static_cast<uint8_t>(basePin + ((pin + 3) & 0x03))};
+
+         srgx.resetMany(pins, 2);
+         tsk.model &= ~(pinMsk | (0x01 << ((pin + 3) & 0x03)));
+         break;
+      }
+      case 14:
+         tsk.asyncHndl = srgx.writeAsync(basePin + pin, val & 0x01);
+         SRGX_CHECK(tsk.asyncHndl.isValid());
+         tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+         break;
+      case 15:
+         tsk.asyncHndl = srgx.stampAsync(msk, vals);
+         SRGX_CHECK(tsk.asyncHndl.isValid());
+         tsk.model = mskdVal(tsk.model, msk[tskIdx], vals[tskIdx]);
+         break;
+      case 16:
+         srgx.digitalWriteSr(SRGXPinDsc{tskIdx, pinMsk, tsksQty}, val & 0x01);
+         tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+         break;
+      case 17:
+         tsk.portPtr->writePort(val);
+         tsk.model = mskdVal(tsk.model, 0xF0, val << 4);
+         break;
+      case 18:
+         tsk.portPtr->xorPort(val);
+         tsk.model ^= val << 4;
+         break;
+      case 19:
+         tsk.portPtr->incPort();
+         tsk.model = mskdVal(tsk.model, 0xF0, (port + 1) << 4);
+         break;
+      case 20:
+         tsk.portPtr->orPort(val);
+         tsk.model |= val << 4;
+         break;
+      case 21:
+         tsk.portPtr->andPort(val);
+         tsk.model &= 0x0F | (val << 4);
+         break;
+      case 22:
+         tsk.portPtr->decPort();
+         tsk.model = mskdVal(tsk.model, 0xF0, (port - 1) << 4);
+         break;
+      case 23:
+         tsk.portPtr->rotLPort();
+         tsk.model = mskdVal(tsk.model, 0xF0, ((port << 1) | (port >> 3)) << 4);
+         break;
+      case 24:
+         tsk.portPtr->shftRPort();
+         tsk.model = mskdVal(tsk.model, 0xF0, (port >> 1) << 4);
+         break;
+      case 25:
+         if(tsk.portPtr->cmpXchgPort(port, val) == port)   // The port value is modeled, the exchange fails only after a lost update
+            tsk.model = mskdVal(tsk.model, 0xF0, val << 4);
+         else
+            tsk.lostUpdtsQty++;
+         break;
+      case 26:
+         tsk.portPtr->flipBit(pin);
+         tsk.model ^= pinMsk << 4;
+         break;
+      case 27:
+         tsk.asyncHndl = tsk.portPtr->writePortAsync(val);
+         SRGX_CHECK(tsk.asyncHndl.isValid());
+         tsk.model = mskdVal(tsk.model, 0xF0, val << 4);
+         break;
+      case 28:   // Staged in the Auxiliary Buffer and moved, by the task or by any other task's operation
+         if(tsk.opStep == 0){
+            srgx.digitalWriteSrToAux(basePin + pin, val & 0x01);
+            tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+            result = false;
+         }
+         else
+            srgx.moveAuxToMain();
+         break;
+      case 29:   // The .print() and .println() like sequence, the last write moves the Auxiliary Buffer
+         if(tsk.opStep == 0){
+            srgx.digitalToggleSrToAux(basePin + pin);
+            tsk.model ^= pinMsk;
+            result = false;
+         }
+         else{
+            srgx.digitalWriteSr(basePin + ((pin + 1) & 0x03), val & 0x01);
+            tsk.model = mskdVal(tsk.model, 0x01 << ((pin + 1) & 0x03), (val & 0x01)?0xFF:0x00);
+         }
+         break;
+      case 30:   // The Auxiliary Buffer, created if no other task's exists, is moved by the read
+         if(tsk.opStep == 0){
+            srgx.copyMainToAux(false);
+            result = false;
+         }
+         else if(tsk.opStep == 1){
+            srgx.digitalWriteSrToAux(basePin + pin, val & 0x01);
+            tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+            result = false;
+         }
+         else if(srgx.digitalReadSr(basePin + pin) != ((tsk.model >> pin) & 0x01))   // Other task's snapshot commit might have been interleaved
+            tsk.lostUpdtsQty++;
+         break;
+      case 31:   // An empty snapshot slot staged by the pin write, the asynchronous write queued after the staging is superseded by the commit
+         if(tsk.opStep == 0){
+            SRGX_CHECK(srgx.digitalWriteSrToSnapshot(tskIdx, basePin + pin, val & 0x01));
+            stageSlot(tsksPtr, tskIdx);
+            tsk.slotImg[tskIdx] = mskdVal(tsk.slotImg[tskIdx], pinMsk, (val & 0x01)?0xFF:0x00);
+            result = false;
+         }
+         else if(tsk.opStep == 1){
+            tsk.asyncHndl = srgx.writeAsync(basePin + pin, !(val & 0x01));
+            SRGX_CHECK(tsk.asyncHndl.isValid());
+            tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0x00:0xFF);
+            result = false;
+         }
+         else{
+            SRGX_CHECK(srgx.moveSnapshotToMain(tskIdx));
+            commitSlot(tsksPtr, tskIdx);
+         }
+         break;
+      case 32:   // The asynchronous write queued before the slot is copied is included in the copy
+         if(tsk.opStep == 0){
+            tsk.asyncHndl = srgx.writeAsync(basePin + pin, val & 0x01);
+            SRGX_CHECK(tsk.asyncHndl.isValid());
+            tsk.model = mskdVal(tsk.model, pinMsk, (val & 0x01)?0xFF:0x00);
+            result = false;
+         }
+         else if(tsk.opStep == 1){
+            SRGX_CHECK(srgx.copyMainToSnapshot(tskIdx));
+            stageSlot(tsksPtr, tskIdx);
+            result = false;
+         }
+         else if(tsk.opStep == 2){
+            SRGX_CHECK(srgx.stampMaskOverSnapshot(tskIdx, msk, vals));
+            tsk.slotImg[tskIdx] = mskdVal(tsk.slotImg[tskIdx], msk[tskIdx], vals[tskIdx]);
+            result = false;
+         }
+         else if(tsk.opStep == 3){
+            SRGX_CHECK(srgx.moveSnapshotToMain(tskIdx, val & 0x08));
+            commitSlot(tsksPtr, tskIdx);
+            result = !(val & 0x08);
+         }
+         else
+            SRGX_CHECK(srgx.discardSnapshot(tskIdx));   // The slot kept is emptied, every sequence starts with an empty slot
+         break;
+   }
+   if(tsk.hist.back() != tsk.model)
+      tsk.hist.push_back(tsk.model);
+   tsk.opStep++;
+
+   return result;
+}
+
+/**
+ * @brief Replays the frames latched, checking them against the tasks' models histories.
+ *
+ * @return The quantity of violations found.
+ */
+uint32_t checkFrames(const LinTsk* tsksPtr){
+   size_t matchIdx[tsksQty]{};
+   uint32_t result{0};
+
+   for(const std::vector<uint8_t> &frame: frames){
+      for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++){   // The latched value must be the current or a later value of the task's model
+         const std::vector<uint8_t> &hist{tsksPtr[tskIdx].hist};
+         size_t histIdx{matchIdx[tskIdx]};
+
+         while((histIdx < hist.size()) && (hist[histIdx] != frame[tskIdx]))
+            histIdx++;
+         if(histIdx == hist.size())
+            result++;
+         else
+            matchIdx[tskIdx] = histIdx;
+      }
+   }
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++){  // The last frame holds the final value of every task
+      if(frames.empty() || (frames.back()[tskIdx] != tsksPtr[tskIdx].model))
+         result++;
+   }
+
+   return result;
+}
+
+/**
+ * @brief Runs an interleaving of the tasks' operations.
+ *
+ * @param seed Number of the interleaving.
+ * @param staleRun If true a stale image -the outputs latched early in the run- is stamped over the Main Buffer later in it, as a lost update the checker must report.
+ *
+ * @return The quantity of lost updates and frame violations found.
+ */
+uint32_t runSeed(const uint32_t &seed, const bool &staleRun){
+   ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, tsksQty);
+   LinTsk tsks[tsksQty]{};
+   uint32_t schdSeed{static_cast<uint32_t>(seed * 2654435761UL + 1)};
+   uint32_t stepsQty{0};
+   uint8_t staleImg[tsksQty]{};
+   uint8_t actvTsksQty{tsksQty};
+   uint32_t result{0};
+
+   chain.attach(ds, sh_cp, st_cp, tsksQty);
+   SRGX_CHECK(srgx.begin());
+   SRGX_CHECK(srgx.beginSnapshots(tsksQty));
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++){
+      LinTsk &tsk{tsks[tskIdx]};
+
+      tsk.portPtr = new SRGXVPort(srgx.createSRGXVPort(tskIdx * 8 + 4, 4));
+      SRGX_CHECK(tsk.portPtr->begin(0));
+      if(tskIdx % 2)
+         SRGX_CHECK(tsk.portPtr->reservePins());   // Lock-free writes
+      tsk.rndSeed = (seed * tsksQty + tskIdx) * 2654435761UL + 1;
+      tsk.hist.push_back(0x00);
+   }
+   frames.clear();
+   chain.latchHook = latchHook;
+
+   while(actvTsksQty > 0){
+      const uint32_t rnd{xorShift(schdSeed)};
+
+      if((rnd % (tsksQty + 1)) == tsksQty)
+         srgxHostRunTsks();   // The asynchronous flushing task, if notified
+      else{
+         const uint8_t tskIdx{static_cast<uint8_t>(rnd % (tsksQty + 1))};
+         LinTsk &tsk{tsks[tskIdx]};
+
+         if(tsk.opsDone < opsPerTsk){
+            if(tsk.opStep == 0xFF){ // Read back, a step of it's own so the queued writes and the staged Auxiliary Buffers are interleaved with other tasks
+               uint16_t rdBack{0};
+
+               SRGX_CHECK(srgx.digitalReadSgmntSr(tskIdx * 8, 8, rdBack));
+               if(static_cast<uint8_t>(rdBack) != tsk.model){
+                  tsk.lostUpdtsQty++;
+                  tsk.model = static_cast<uint8_t>(rdBack); // Resynchronized, so a single lost update is not counted again by every following operation
+                  tsk.hist.push_back(tsk.model);
+               }
+               tsk.opStep = 0;
+               if(++tsk.opsDone == opsPerTsk)
+                  actvTsksQty--;
+            }
+            else{
+               if(tsk.opStep == 0){
+                  tsk.opRnd = xorShift(tsk.rndSeed);
+                  tsk.opCode = (tsk.opRnd >> 16) % opsMixQty;
+               }
+               if(stepOp(srgx, tsks, tskIdx))
+                  tsk.opStep = 0xFF;
+            }
+            stepsQty++;
+            if(staleRun && (stepsQty == (tsksQty * opsPerTsk) / 2))
+               memcpy(staleImg, chain.out, tsksQty);
+            if(staleRun && (stepsQty == tsksQty * opsPerTsk))
+               srgx.stampOverMain(staleImg);
+         }
+      }
+   }
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++)
+      SRGX_CHECK(srgx.digitalWriteSr(tskIdx * 8, tsks[tskIdx].model & 0x01));  // A synchronous flush after any asynchronous write of the run
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++){
+      if(tsks[tskIdx].asyncHndl.isValid())
+         SRGX_CHECK(tsks[tskIdx].asyncHndl.isDone());
+      result += tsks[tskIdx].lostUpdtsQty;
+   }
+   result += checkFrames(tsks);
+   chain.latchHook = nullptr;
+   for(uint8_t tskIdx{0}; tskIdx < tsksQty; tskIdx++)
+      delete tsks[tskIdx].portPtr;
+
+   return result;
+}
+
+int main(){
+   uint32_t staleDtctdQty{0};
+
+   for(uint32_t seed{0}; seed < seedsQty; seed++){
+      const uint32_t violsQty{runSeed(seed, false)};
+
+      if(violsQty != 0)
+         printf("seed %lu: %lu lost updates and frame violations\n", (unsigned long)seed, (unsigned long)violsQty);
+      SRGX_CHECK(violsQty == 0);
+   }
+   for(uint32_t seed{0}; seed < 16; seed++){
+      if(runSeed(seed, true) > 0)
+         staleDtctdQty++;
+   }
+   SRGX_CHECK(staleDtctdQty == 16);
+   printf("SRGXLinearizabilityTest ok: %u interleavings of %u tasks x %u operations, %lu stale images detected\n", seedsQty, tsksQty, opsPerTsk, (unsigned long)staleDtctdQty);
+
+   return 0;
+}
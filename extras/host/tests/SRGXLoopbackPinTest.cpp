@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file SRGXLoopbackPinTest.cpp
+ * @brief Host test of the QH' loop-back pin validation of setLoopbackCheck() and calibrateBitDelay()
+ *
+ * The chain lines (DS, SH_CP, ST_CP, OE and the 74HCx165 QH and SH/LD lines) and the pins that are
+ * not valid GPIOs must be rejected, leaving the check and the bit time delay unmodified.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXHostTest.h>
+
+const uint8_t ds{33};
+const uint8_t sh_cp{26};
+const uint8_t st_cp{25};
+const uint8_t oe{27};
+const uint8_t qh{34};
+const uint8_t sh_ld{32};
+const uint8_t lpbk{35};
+const uint8_t srQty{2};
+
+SRGXHostChain chain;
+
+int main(){
+   ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+   chain.attach(ds, sh_cp, st_cp, srQty);
+   SRGX_CHECK(srgx.setOEPin(oe));
+   SRGX_CHECK(!srgx.setLoopbackCheck(ds));   // Not begun yet, the pins are validated as well
+   SRGX_CHECK(srgx.setLoopbackCheck(lpbk, 0));
+   SRGX_CHECK(srgx.begin());
+   SRGX_CHECK(srgx.beginInput(qh, sh_ld, 1));
+
+   const uint8_t chainPins[]{ds, sh_cp, st_cp, oe, qh, sh_ld};
+   const uint8_t invldPins[]{20, 24, 28, 31, 40, 0xFF};
+   const uint32_t bitDlyUs{srgx.getBitDelay()};
+
+   for(uint8_t pinIdx{0}; pinIdx < sizeof(chainPins); pinIdx++){
+      SRGX_CHECK(!srgx.setLoopbackCheck(chainPins[pinIdx]));
+      SRGX_CHECK(!srgx.calibrateBitDelay(chainPins[pinIdx]));
+   }
+   for(uint8_t pinIdx{0}; pinIdx < sizeof(invldPins); pinIdx++){
+      SRGX_CHECK(!srgx.setLoopbackCheck(invldPins[pinIdx]));
+      SRGX_CHECK(!srgx.calibrateBitDelay(invldPins[pinIdx]));
+   }
+   SRGX_CHECK(srgx.getBitDelay() == bitDlyUs);
+   SRGX_CHECK(srgx.digitalWriteSr(3, HIGH));   // The check was left stopped
+   SRGX_CHECK(srgx.getLoopbackErrsQty() == 0);
+   SRGX_CHECK(chain.outLvl(3) == HIGH);
+   SRGX_CHECK(srgx.setLoopbackCheck(lpbk, 0));
+   printf("SRGXLoopbackPinTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ ******************************************************************************
+ * @file SRGXSnapshotsTest.cpp
+ * @brief Host test of the snapshot slots ordering against the Auxiliary Buffer and the asynchronous writes
+ *
+ * A snapshot committed by moveSnapshotToMain() must supersede a pending Auxiliary Buffer, so no
+ * later method moves the older Auxiliary copy over the committed image, while the Main Buffer
+ * copied to a slot must include it, as the reading methods see it. The asynchronous writes queued
+ * must be applied before the Main Buffer is committed over, copied or flushed with a new remapping.
+ * The outputs latched are checked after every operation.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXHostTest.h>
+
+const uint8_t ds{33};
+const uint8_t sh_cp{26};
+const uint8_t st_cp{25};
+const uint8_t srQty{2};
+
+SRGXHostChain chain;
+
+int main(){
+   /*A commit discards the pending Auxiliary Buffer*/
+   {
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      SRGX_CHECK(srgx.beginSnapshots(2));
+      SRGX_CHECK(srgx.digitalWriteSrToSnapshot(0, 10, HIGH));
+      SRGX_CHECK(srgx.digitalWriteSrToAux(3, HIGH));
+      SRGX_CHECK(srgx.moveSnapshotToMain(0));
+      SRGX_CHECK(chain.outLvl(10) == HIGH);
+      SRGX_CHECK(chain.outLvl(3) == LOW);
+      SRGX_CHECK(srgx.digitalReadSr(10) == HIGH);
+      SRGX_CHECK(srgx.digitalWriteSr(1, HIGH));
+      SRGX_CHECK((chain.outLvl(10) == HIGH) && (chain.outLvl(1) == HIGH) && (chain.outLvl(3) == LOW));
+      SRGX_CHECK(!srgx.moveAuxToMain());  // Nothing left to move
+   }
+
+   /*An empty slot commit leaves the pending Auxiliary Buffer*/
+   {
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      SRGX_CHECK(srgx.beginSnapshots(2));
+      SRGX_CHECK(srgx.digitalWriteSrToAux(3, HIGH));
+      SRGX_CHECK(!srgx.moveSnapshotToMain(1));
+      SRGX_CHECK(srgx.moveAuxToMain());
+      SRGX_CHECK(chain.outLvl(3) == HIGH);
+   }
+
+   /*The Main Buffer is copied and staged including the pending Auxiliary Buffer*/
+   {
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      SRGX_CHECK(srgx.beginSnapshots(2));
+      SRGX_CHECK(srgx.digitalWriteSrToAux(3, HIGH));
+      SRGX_CHECK(srgx.copyMainToSnapshot(0));
+      SRGX_CHECK(chain.outLvl(3) == HIGH);   // The Auxiliary Buffer was moved and flushed
+      SRGX_CHECK(srgx.cmpSnapshotToMain(0) == 0);
+      SRGX_CHECK(srgx.digitalWriteSrToAux(5, HIGH));
+      SRGX_CHECK(srgx.digitalWriteSrToSnapshot(1, 12, HIGH));
+      SRGX_CHECK(srgx.moveSnapshotToMain(1));
+      SRGX_CHECK((chain.outLvl(3) == HIGH) && (chain.outLvl(5) == HIGH) && (chain.outLvl(12) == HIGH));
+      SRGX_CHECK(srgx.digitalWriteSr(3, LOW));
+      SRGX_CHECK(srgx.moveSnapshotToMain(0));
+      SRGX_CHECK((chain.outLvl(3) == HIGH) && (chain.outLvl(5) == LOW) && (chain.outLvl(12) == LOW));
+   }
+
+   /*The writes queued are applied before the Main Buffer is committed over, copied or flushed*/
+   {
+      ShiftRegGPIOXpander srgx(ds, sh_cp, st_cp, srQty);
+      SRGXAsyncHndl asyncHndl{};
+
+      chain.attach(ds, sh_cp, st_cp, srQty);
+      SRGX_CHECK(srgx.begin());
+      SRGX_CHECK(srgx.beginSnapshots(2));
+      SRGX_CHECK(srgx.digitalWriteSrToSnapshot(0, 0, LOW));
+      asyncHndl = srgx.writeAsync(0, HIGH);
+      SRGX_CHECK(asyncHndl.isValid() && !asyncHndl.isDone());
+      SRGX_CHECK(srgx.moveSnapshotToMain(0));   // The earlier write does not land after the commit
+      srgxHostRunTsks();
+      SRGX_CHECK(asyncHndl.isDone());
+      SRGX_CHECK((chain.outLvl(0) == LOW) && (srgx.digitalReadSr(0) == LOW));
+      asyncHndl = srgx.writeAsync(0, HIGH);
+      SRGX_CHECK(srgx.copyMainToSnapshot(1));   // The write is included in the copy
+      SRGX_CHECK(srgx.moveSnapshotToMain(1));
+      srgxHostRunTsks();
+      SRGX_CHECK(asyncHndl.isDone());
+      SRGX_CHECK((chain.outLvl(0) == HIGH) && (srgx.digitalReadSr(0) == HIGH));
+      asyncHndl = srgx.writeAsync(1, HIGH);
+      SRGX_CHECK(srgx.setPinsRemap(nullptr, true));   // The flush with the new wiring includes the write
+      SRGX_CHECK((chain.outLvl(7) == HIGH) && (chain.outLvl(6) == HIGH));
+      asyncHndl = srgx.writeAsync(2, HIGH);
+      SRGX_CHECK(srgx.clearPinsRemap());
+      SRGX_CHECK((chain.outLvl(0) == HIGH) && (chain.outLvl(1) == HIGH) && (chain.outLvl(2) == HIGH));
+      srgxHostRunTsks();
+   }
+   printf("SRGXSnapshotsTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * @file SRGXStateStoreTest.cpp
+ * @brief Host test of the SRGXStateStore records and the SRGXFileStateStore class
+ *
+ * The records are saved to a temporary file and loaded back, then the file is torn (truncated,
+ * or partially overwritten as by a reset while written), corrupted, or read for a chain of a
+ * different length, checking none of those records is loaded and the image is left untouched.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * @author Gabriel D. Goldman
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXStateStore.h>
+#include <SRGXHostTest.h>
+#include <unistd.h>
+
+char path[]{"/tmp/SRGXStateStoreTest-XXXXXX"};
+const uint8_t untouched{0x5C};
+
+/**
+ * @brief Replaces the file contents.
+ */
+void wrtFile(const uint8_t* dataPtr, const size_t &dataLen){
+   FILE* filePtr{fopen(path, "wb")};
+
+   SRGX_CHECK(filePtr != nullptr);
+   SRGX_CHECK(fwrite(dataPtr, 1, dataLen, filePtr) == dataLen);
+   SRGX_CHECK(fclose(filePtr) == 0);
+
+   return;
+}
+
+/**
+ * @brief Checks the store loads nothing for a chain of srQty shift registers, and the image is not modified.
+ */
+void chkNotLoaded(SRGXFileStateStore &store, const uint8_t &srQty){
+   uint8_t img[255];
+
+   memset(img, untouched, sizeof(img));
+   SRGX_CHECK(!store.load(img, srQty));
+   for(uint16_t byteInc{0}; byteInc < sizeof(img); byteInc++)
+      SRGX_CHECK(img[byteInc] == untouched);
+
+   return;
+}
+
+int main(){
+   const int fileDsc{mkstemp(path)};
+   SRGX_CHECK(fileDsc >= 0);
+   close(fileDsc);
+
+   SRGXFileStateStore store(path);
+   uint8_t img[255];
+   uint8_t rec[8 + 255];
+   uint8_t oldRec[8 + 255];
+
+   /*Records encoding and decoding*/
+   for(uint16_t byteInc{0}; byteInc < sizeof(img); byteInc++)
+      img[byteInc] = byteInc * 37 + 11;
+   SRGX_CHECK(SRGXStateStore::getRecLen(4) == 12);
+   SRGX_CHECK(SRGXStateStore::encodeRec(img, 4, rec, 11) == 0);
+   SRGX_CHECK(SRGXStateStore::encodeRec(img, 0, rec, sizeof(rec)) == 0);
+   SRGX_CHECK(SRGXStateStore::encodeRec(nullptr, 4, rec, sizeof(rec)) == 0);
+   SRGX_CHECK(SRGXStateStore::encodeRec(img, 4, rec, sizeof(rec)) == 12);
+   SRGX_CHECK((memcmp(rec, "SRGS", 4) == 0) && (rec[4] == 1) && (rec[5] == 4) && (memcmp(rec + 8, img, 4) == 0));
+   {
+      uint8_t outImg[4]{};
+
+      SRGX_CHECK(SRGXStateStore::decodeRec(rec, 12, outImg, 4) && (memcmp(outImg, img, 4) == 0));
+      SRGX_CHECK(!SRGXStateStore::decodeRec(rec, 11, outImg, 4));
+      SRGX_CHECK(!SRGXStateStore::decodeRec(rec, 12, outImg, 3));
+      SRGX_CHECK(!SRGXStateStore::decodeRec(rec, 13, outImg, 5));
+      SRGX_CHECK(!SRGXStateStore::decodeRec(nullptr, 12, outImg, 4));
+      for(uint8_t byteInc{0}; byteInc < 12; byteInc++){   // Every single bit flip is caught, in the header, CRC and image bytes
+         for(uint8_t bitInc{0}; bitInc < 8; bitInc++){
+            rec[byteInc] ^= (0x01 << bitInc);
+            SRGX_CHECK(!SRGXStateStore::decodeRec(rec, 12, outImg, 4));
+            rec[byteInc] ^= (0x01 << bitInc);
+         }
+      }
+   }
+
+   /*An empty or missing file holds no record*/
+   remove(path);
+   chkNotLoaded(store, 4);
+   wrtFile(rec, 0);
+   chkNotLoaded(store, 4);
+
+   for(uint16_t srQty{1}; srQty <= 255; srQty += (srQty < 8)?1:31){
+      const uint16_t recLen{SRGXStateStore::getRecLen(srQty)};
+      uint8_t outImg[255];
+
+      /*Saved and loaded back*/
+      for(uint16_t byteInc{0}; byteInc < srQty; byteInc++)
+         img[byteInc] = (byteInc * 37 + srQty) ^ 0xA5;
+      const uint32_t savesQty{store.getSavesQty()};
+      SRGX_CHECK(store.save(img, srQty) && (store.getSavesQty() == savesQty + 1));
+      memset(outImg, 0x00, sizeof(outImg));
+      SRGX_CHECK(store.load(outImg, srQty) && (memcmp(outImg, img, srQty) == 0));
+      SRGX_CHECK(SRGXStateStore::encodeRec(img, srQty, rec, sizeof(rec)) == recLen);
+
+      /*Wrong chain length: the record is for a different chain*/
+      chkNotLoaded(store, srQty + 1);
+      if(srQty > 1)
+         chkNotLoaded(store, srQty - 1);
+      memcpy(oldRec, rec, recLen);
+      oldRec[recLen] = 0x00;
+      wrtFile(oldRec, recLen + 1);  // A valid record followed by a stray byte
+      chkNotLoaded(store, srQty);
+      rec[5] = srQty + 1;  // The length byte not matching the record length
+      wrtFile(rec, recLen);
+      chkNotLoaded(store, srQty);
+      chkNotLoaded(store, srQty + 1);
+      rec[5] = srQty;
+
+      /*Torn records: the writing interrupted at every byte*/
+      for(uint16_t tornLen{0}; tornLen < recLen; tornLen++){
+         wrtFile(rec, tornLen);
+         chkNotLoaded(store, srQty);
+      }
+      for(uint16_t byteInc{0}; byteInc < srQty; byteInc++)
+         outImg[byteInc] = img[byteInc] ^ 0xFF;
+      SRGX_CHECK(SRGXStateStore::encodeRec(outImg, srQty, oldRec, sizeof(oldRec)) == recLen);
+      for(uint16_t tornLen{1}; tornLen < recLen; tornLen++){  // The new record overwriting the old one in place
+         uint8_t mixRec[8 + 255];
+
+         memcpy(mixRec, rec, tornLen);
+         memcpy(mixRec + tornLen, oldRec + tornLen, recLen - tornLen);
+         wrtFile(mixRec, recLen);
+         if(memcmp(mixRec, oldRec, recLen) == 0){   // Interrupted before the first differing byte, the old record is still whole
+            uint8_t ldImg[255];
+
+            SRGX_CHECK(store.load(ldImg, srQty) && (memcmp(ldImg, outImg, srQty) == 0));
+         }
+         else
+            chkNotLoaded(store, srQty);
+      }
+
+      /*Wrong signature or version*/
+      rec[0] = 'X';
+      wrtFile(rec, recLen);
+      chkNotLoaded(store, srQty);
+      rec[0] = 'S';
+      rec[4] = 2;
+      wrtFile(rec, recLen);
+      chkNotLoaded(store, srQty);
+      rec[4] = 1;
+      wrtFile(rec, recLen);
+      SRGX_CHECK(store.load(outImg, srQty) && (memcmp(outImg, img, srQty) == 0));
+   }
+
+   remove(path);
+   printf("SRGXStateStoreTest ok\n");
+
+   return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ ******************************************************************************
+ * @file SRGXBus.cpp
+ * @brief Code file for the SRGXBus class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXBus.h>
+
+SRGXBus::SRGXBus()
+{
+   _busMtx = xSemaphoreCreateMutex();
+}
+
+SRGXBus::~SRGXBus(){
+   while(_SRGXQty > 0)
+      removeSRGX(_SRGXPtrs[_SRGXQty - 1]);
+   if(_busMtx != nullptr){
+      vSemaphoreDelete(_busMtx);
+      _busMtx = nullptr;
+   }
+}
+
+bool SRGXBus::addSRGX(ShiftRegGPIOXpander* SRGXPtr){
+   bool result{false};
+
+   if((SRGXPtr != nullptr) && (_busMtx != nullptr) && (SRGXPtr->_SRGXMnBffrMtx != nullptr) && (_SRGXQty < _maxSRGXQty)){
+      if(xSemaphoreTake(SRGXPtr->_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){ // No flushing of the object is in progress while it's registered
+         if(xSemaphoreTake(_busMtx, portMAX_DELAY) == pdTRUE){
+            bool validSRGX{SRGXPtr->_busPtr == nullptr};
+
+            for(uint8_t srgxInc{0}; validSRGX && (srgxInc < _SRGXQty); srgxInc++){
+               if((_SRGXPtrs[srgxInc]->_ds != SRGXPtr->_ds) || (_SRGXPtrs[srgxInc]->_sh_cp != SRGXPtr->_sh_cp) || (_SRGXPtrs[srgxInc]->_st_cp == SRGXPtr->_st_cp))
+                  validSRGX = false;
+            }
+            if(validSRGX){
+               SRGXPtr->_busFlshPndng = false;
+               SRGXPtr->_busPtr = this;
+               _SRGXPtrs[_SRGXQty++] = SRGXPtr;
+               result = true;
+            }
+            xSemaphoreGive(_busMtx);
+         }
+         xSemaphoreGive(SRGXPtr->_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool SRGX_IRAM_ATTR SRGXBus::_flush(ShiftRegGPIOXpander* SRGXPtr){
+   bool result{false};
+
+   __atomic_store_n(&SRGXPtr->_busFlshPndng, true, __ATOMIC_RELEASE);
+   if(xSemaphoreTake(_busMtx, portMAX_DELAY) == pdTRUE){
+      for(uint8_t srgxInc{0}; srgxInc < _SRGXQty; srgxInc++){  // Shift and latch every object pending, the ones not owning the bus are blocked holding their Main Buffer mutex
+         ShiftRegGPIOXpander* pndngSRGXPtr{_SRGXPtrs[srgxInc]};
+
+         if(__atomic_exchange_n(&pndngSRGXPtr->_busFlshPndng, false, __ATOMIC_ACQ_REL)){
+            pndngSRGXPtr->_sendChainCntnt();
+            if(pndngSRGXPtr != SRGXPtr)
+               _coalescedQty++;
+         }
+      }
+      xSemaphoreGive(_busMtx);
+      result = true;
+   }
+
+   return result;
+}
+
+uint32_t SRGXBus::getCoalescedQty(){
+
+   return _coalescedQty;
+}
+
+uint8_t SRGXBus::getSRGXQty(){
+
+   return _SRGXQty;
+}
+
+bool SRGXBus::removeSRGX(ShiftRegGPIOXpander* SRGXPtr){
+   bool result{false};
+
+   if((SRGXPtr != nullptr) && (SRGXPtr->_busPtr == this)){
+      if(xSemaphoreTake(SRGXPtr->_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_busMtx, portMAX_DELAY) == pdTRUE){
+            for(uint8_t srgxInc{0}; srgxInc < _SRGXQty; srgxInc++){
+               if(_SRGXPtrs[srgxInc] == SRGXPtr){
+                  for(uint8_t mvInc{srgxInc}; mvInc < (_SRGXQty - 1); mvInc++)
+                     _SRGXPtrs[mvInc] = _SRGXPtrs[mvInc + 1];
+                  _SRGXPtrs[--_SRGXQty] = nullptr;
+                  break;
+               }
+            }
+            SRGXPtr->_busPtr = nullptr;
+            xSemaphoreGive(_busMtx);
+            result = true;
+         }
+         xSemaphoreGive(SRGXPtr->_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
@@ -0,0 +1,111 @@
+/**
+ ******************************************************************************
+ * @file SRGXBus.h
+ * @brief Header file for the SRGXBus class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class provides the arbitration of the flushing of several ShiftRegGPIOXpander objects sharing the DS and SH_CP lines, each one with it's own ST_CP latch line.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXBUS_H_
+#define _SRGXBUS_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+/**
+ * @brief A class that models a data and clock bus shared by several ShiftRegGPIOXpander objects.
+ *
+ * Several 74HCx595 chains might share the DS and SH_CP lines, each chain having it's own ST_CP line: the bits shifted get into every chain, but only the latched chain updates it's outputs. Each ShiftRegGPIOXpander object assumes it owns the lines, so the flushes of objects used from different tasks would corrupt each other's bit trains.
+ *
+ * The ShiftRegGPIOXpander objects registered with a SRGXBus object flush through it: the flushing object marks itself as pending and takes the bus mutex. The bus mutex owner shifts the Main Buffer contents and fires the latch of every registered object pending a flush -back-to-back, in a single bus acquisition- so the objects that were waiting for the bus find their flush already done when they take it. The flushes are never lost nor repeated, and the objects pending a flush are kept blocked -holding their Main Buffer mutex- until their contents are latched, so their Main Buffers are stable while shifted.
+ *
+ * @note The bus mutex is always taken after the Main Buffer mutex of the flushing object, and the Main Buffer mutexes of the other objects are never taken by the bus, so no deadlocks are possible.
+ *
+ * @class SRGXBus
+ */
+class SRGXBus{
+   /*Allows the ShiftRegGPIOXpander class to flush it's Main Buffer through the bus.*/
+   friend class ShiftRegGPIOXpander;
+
+private:
+   static const uint8_t _maxSRGXQty{8};
+   ShiftRegGPIOXpander* _SRGXPtrs[_maxSRGXQty]{};
+   uint8_t _SRGXQty{0};
+   SemaphoreHandle_t _busMtx{nullptr};   // Mutex arbitrating the access to the shared DS and SH_CP lines
+   uint32_t _coalescedQty{0};
+
+   bool _flush(ShiftRegGPIOXpander* SRGXPtr);
+
+public:
+   /**
+    * @brief Class constructor
+    */
+   SRGXBus();
+   /**
+    * @brief Copy constructor, deleted.
+    *
+    * The ShiftRegGPIOXpander objects registered keep a pointer to the bus, a copy would not be referenced by them.
+    */
+   SRGXBus(const SRGXBus&) = delete;
+   /**
+    * @brief Class destructor
+    *
+    * Every ShiftRegGPIOXpander object registered is removed from the bus, returning to flush it's contents directly.
+    */
+   ~SRGXBus();
+   /**
+    * @brief Copy assignment operator, deleted.
+    */
+   SRGXBus& operator=(const SRGXBus&) = delete;
+   /**
+    * @brief Registers a ShiftRegGPIOXpander object with the bus.
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object. The object must be begun, and must share the DS and SH_CP lines with the objects already registered, with a different ST_CP line.
+    *
+    * @retval true The object was registered, it's next flushes will be done through the bus.
+    * @retval false The object was not begun, was already registered with this or another bus, the lines did not match, or the maximum of 8 objects was reached.
+    */
+   bool addSRGX(ShiftRegGPIOXpander* SRGXPtr);
+   /**
+    * @brief Returns the quantity of flushes coalesced.
+    *
+    * @return The number of flushes done on behalf of registered objects pending a flush while another object owned the bus, flushes those objects did not need to do after getting the bus.
+    */
+   uint32_t getCoalescedQty();
+   /**
+    * @brief Returns the quantity of ShiftRegGPIOXpander objects registered with the bus.
+    */
+   uint8_t getSRGXQty();
+   /**
+    * @brief Removes a ShiftRegGPIOXpander object from the bus.
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object.
+    *
+    * @retval true The object was removed, it's next flushes will be done directly.
+    * @retval false The object was not registered with this bus.
+    *
+    * @note The method is invoked by ShiftRegGPIOXpander::end(), so the objects destroyed are removed from the bus automatically.
+    */
+   bool removeSRGX(ShiftRegGPIOXpander* SRGXPtr);
+};
+
+#endif //_SRGXBUS_H_
@@ -0,0 +1,249 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdParser.cpp
+ * @brief Code file for the SRGXCmdParser class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <SRGXCmdParser.h>
+#include <SRGXStateStore.h>
+#include <string.h>
+
+SRGXCmdParser::SRGXCmdParser(const uint8_t &srQty)
+:_srQty{srQty}
+{
+   if(_srQty > 0){
+      _mskPtr = new uint8_t [_srQty]{};
+      _valsPtr = new uint8_t [_srQty]{};
+      _tgglPtr = new uint8_t [_srQty]{};
+   }
+}
+
+SRGXCmdParser::~SRGXCmdParser(){
+   if(_mskPtr !=nullptr){
+      delete [] _mskPtr;
+      _mskPtr = nullptr;
+   }
+   if(_valsPtr !=nullptr){
+      delete [] _valsPtr;
+      _valsPtr = nullptr;
+   }
+   if(_tgglPtr !=nullptr){
+      delete [] _tgglPtr;
+      _tgglPtr = nullptr;
+   }
+}
+
+uint16_t SRGXCmdParser::chkRxTmout(const uint32_t &nowMs){
+   uint16_t result{0};
+
+   if((_rxTmoutMs > 0) && (_rxLen > 0) && ((nowMs - _rxLastMs) > _rxTmoutMs)){
+      _rxTmoutsQty++;
+      result = _scan(true);
+   }
+
+   return result;
+}
+
+uint32_t SRGXCmdParser::getCrcErrsQty(){
+
+   return _crcErrsQty;
+}
+
+uint32_t SRGXCmdParser::getFramesQty(){
+
+   return _frmsQty;
+}
+
+uint32_t SRGXCmdParser::getRxTmoutsQty(){
+
+   return _rxTmoutsQty;
+}
+
+bool SRGXCmdParser::_mergeOps(const uint8_t* opsPtr, const uint8_t &opsLen, const uint8_t &inSrQty, uint16_t &rdsLen, uint16_t &opsQty){
+   const uint16_t maxPin{static_cast<uint16_t>(_srQty * 8 - 1)};
+   uint16_t opIdx{0};
+   bool result{_srQty > 0};
+
+   if(result){
+      memset(_mskPtr, 0x00, _srQty);
+      memset(_valsPtr, 0x00, _srQty);
+      memset(_tgglPtr, 0x00, _srQty);
+   }
+   rdsLen = 0;
+   opsQty = 0;
+   while(result && (opIdx < opsLen)){
+      const uint8_t opCode{*(opsPtr + opIdx)};
+      const uint16_t argsLen{static_cast<uint16_t>(opsLen - opIdx - 1)};
+      const uint8_t* argsPtr{opsPtr + opIdx + 1};
+
+      result = false;
+      if(opCode == 0x00){  // Info
+         rdsLen += 3;
+         opIdx += 1;
+         result = true;
+      }
+      else if((opCode >= 0x01) && (opCode <= 0x03)){  // Set, reset or toggle a pins list
+         if((argsLen >= 1) && (*argsPtr >= 1) && (argsLen >= (1 + *argsPtr))){
+            result = true;
+            for(uint8_t pinInc{0}; result && (pinInc < *argsPtr); pinInc++){
+               const uint8_t srPin{*(argsPtr + 1 + pinInc)};
+               const uint8_t pinMsk = 0x01 << (srPin % 8);
+
+               if(srPin > maxPin)
+                  result = false;
+               else if(opCode != 0x03)
+                  _mergePin(srPin, opCode == 0x01);
+               else if(*(_mskPtr + srPin / 8) & pinMsk)  // A pin already written is toggled by inverting it's value
+                  *(_valsPtr + srPin / 8) ^= pinMsk;
+               else
+                  *(_tgglPtr + srPin / 8) ^= pinMsk;
+            }
+            opIdx += 2 + *argsPtr;
+         }
+      }
+      else if(opCode == 0x04){   // Contiguous virtual port write
+         if(argsLen >= 4){
+            const uint8_t strtPin{*argsPtr};
+            const uint8_t pinsQty{*(argsPtr + 1)};
+            const uint16_t portVal{static_cast<uint16_t>(*(argsPtr + 2) | (*(argsPtr + 3) << 8))};
+
+            if((pinsQty >= 1) && (pinsQty <= 16) && ((strtPin + pinsQty - 1) <= maxPin)){
+               for(uint8_t pinInc{0}; pinInc < pinsQty; pinInc++)
+                  _mergePin(strtPin + pinInc, (portVal >> pinInc) & 0x01);
+               result = true;
+            }
+            opIdx += 5;
+         }
+      }
+      else if(opCode == 0x05){   // Whole image stamp
+         if(argsLen >= _srQty){
+            memset(_mskPtr, 0xFF, _srQty);
+            memcpy(_valsPtr, argsPtr, _srQty);
+            memset(_tgglPtr, 0x00, _srQty);
+            opIdx += 1 + _srQty;
+            result = true;
+         }
+      }
+      else if(opCode == 0x06){   // Outputs read
+         rdsLen += _srQty;
+         opIdx += 1;
+         result = true;
+      }
+      else if(opCode == 0x07){   // Inputs read
+         if(inSrQty > 0){
+            rdsLen += inSrQty;
+            opIdx += 1;
+            result = true;
+         }
+      }
+      if(rdsLen > 253)  // The data read must fit in a response frame
+         result = false;
+      opsQty++;
+   }
+
+   return result;
+}
+
+void SRGXCmdParser::_mergePin(const uint8_t &srPin, const bool &level){
+   const uint8_t pinMsk = 0x01 << (srPin % 8);
+
+   *(_mskPtr + srPin / 8) |= pinMsk;
+   *(_tgglPtr + srPin / 8) &= ~pinMsk;  // The level set overrides the toggles preceding it
+   if(level)
+      *(_valsPtr + srPin / 8) |= pinMsk;
+   else
+      *(_valsPtr + srPin / 8) &= ~pinMsk;
+
+   return;
+}
+
+uint16_t SRGXCmdParser::parse(const uint8_t* dataPtr, const size_t &dataLen, const uint32_t &nowMs){
+   uint16_t result{chkRxTmout(nowMs)};
+
+   if(dataPtr != nullptr){
+      for(size_t byteInc{0}; byteInc < dataLen; byteInc++){
+         const uint8_t dataByte{*(dataPtr + byteInc)};
+
+         if((_rxLen > 0) || (dataByte == _sof)){  // Hunting the start of frame, the bytes between frames are discarded
+            _rxFrm[_rxLen++] = dataByte;
+            result += _scan(false);
+         }
+      }
+      if(dataLen > 0)
+         _rxLastMs = nowMs;
+   }
+
+   return result;
+}
+
+uint16_t SRGXCmdParser::_scan(const bool &rxTmout){
+   uint16_t frmStrt{0};
+   bool scanning{true};
+   uint16_t result{0};
+
+   while(scanning){
+      while((frmStrt < _rxLen) && (_rxFrm[frmStrt] != _sof))
+         frmStrt++;
+
+      const uint16_t avlblLen{static_cast<uint16_t>(_rxLen - frmStrt)};
+
+      if(avlblLen < 2){
+         if(rxTmout)
+            frmStrt = _rxLen;
+         scanning = false;
+      }
+      else if(_rxFrm[frmStrt + 1] == 0)  // A frame holds at least the sequence number
+         frmStrt++;
+      else if(avlblLen < (4 + _rxFrm[frmStrt + 1])){
+         if(rxTmout)
+            frmStrt++;  // The frame will not be completed, the bytes following it's start of frame byte are scanned again
+         else
+            scanning = false;
+      }
+      else{
+         const uint8_t* frmPtr{_rxFrm + frmStrt};
+         const uint16_t frmLen{static_cast<uint16_t>(4 + frmPtr[1])};
+         const uint16_t frmCrc{static_cast<uint16_t>(frmPtr[frmLen - 2] | (frmPtr[frmLen - 1] << 8))};
+
+         if(SRGXStateStore::crc16(frmPtr + 1, 1 + frmPtr[1]) == frmCrc){
+            _frmsQty++;
+            _procFrm(frmPtr[2], frmPtr + 3, frmPtr[1] - 1);
+            result++;
+            frmStrt += frmLen;
+         }
+         else{
+            _crcErrsQty++;
+            frmStrt++;  // Only the start of frame byte is dropped, the next frame might start inside the corrupted one
+         }
+      }
+   }
+   if(frmStrt > 0){
+      _rxLen -= frmStrt;
+      if(_rxLen > 0)
+         memmove(_rxFrm, _rxFrm + frmStrt, _rxLen);
+   }
+
+   return result;
+}
+
+void SRGXCmdParser::setRxTmout(const uint32_t &rxTmoutMs){
+   _rxTmoutMs = rxTmoutMs;
+
+   return;
+}
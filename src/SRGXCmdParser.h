@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdParser.h
+ * @brief Header file for the SRGXCmdParser class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class models the frames parser and the operations merger of the SRGXCmdSrvr binary protocol. The class has no dependencies on the Arduino framework nor the FreeRTOS kernel, so the frames extraction, resynchronization and merging might be verified on a host computer.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXCMDPARSER_H_
+#define _SRGXCMDPARSER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief An abstract class that models the frames parser and the operations merger of the SRGXCmdSrvr binary protocol, see SRGXCmdSrvr for the frames format.
+ *
+ * The bytes received are buffered until they hold a complete frame, every frame with a valid CRC is handed to the derived class through _procFrm(const uint8_t&, const uint8_t*, const uint8_t&), which might merge it's operations with _mergeOps(const uint8_t*, const uint8_t&, const uint8_t&, uint16_t&, uint16_t&).
+ *
+ * The parser resynchronizes after any corruption of the bytes stream: when a frame fails the CRC check only it's start of frame byte is dropped, and the bytes buffered after it are scanned again for the next 0xA5 start of frame byte, so a valid frame received inside the span of a corrupted one is not lost. A frame whose bytes stop arriving for longer than the inter-byte timeout (see setRxTmout(const uint32_t&)) is treated the same way, so a corrupted length byte can't stall the parser waiting for bytes that will never come.
+ *
+ * @class SRGXCmdParser
+ */
+class SRGXCmdParser{
+protected:
+   static const uint8_t _sof{0xA5};
+   static const uint16_t _maxFrmLen{2 + 255 + 2};
+   uint8_t _srQty{0};
+   uint8_t* _mskPtr{nullptr};  // Merged writing operations, one masked write per shift register
+   uint8_t* _valsPtr{nullptr};
+   uint8_t* _tgglPtr{nullptr};
+   uint8_t _rxFrm[_maxFrmLen]{};
+   uint16_t _rxLen{0}; // Bytes buffered, starting at the start of frame byte of the frame being received
+   uint32_t _rxLastMs{0};  // Time the last byte was received
+   uint32_t _rxTmoutMs{100};
+   uint32_t _frmsQty{0};
+   uint32_t _crcErrsQty{0};
+   uint32_t _rxTmoutsQty{0};
+
+   /**
+    * @brief Validates the operations of a frame and merges the writing ones.
+    *
+    * @param opsPtr Pointer to the operations.
+    * @param opsLen Length of the operations.
+    * @param inSrQty Quantity of input shift registers that might be read.
+    * @param rdsLen Variable where the length of the data read by the operations is stored.
+    * @param opsQty Variable where the quantity of operations is stored.
+    *
+    * @retval true The operations are valid, the writing ones were merged into the masked writes.
+    * @retval false The operations were not valid.
+    */
+   bool _mergeOps(const uint8_t* opsPtr, const uint8_t &opsLen, const uint8_t &inSrQty, uint16_t &rdsLen, uint16_t &opsQty);
+   /**
+    * @brief Merges a pin level setting into the masked writes.
+    */
+   void _mergePin(const uint8_t &srPin, const bool &level);
+   /**
+    * @brief Processes a frame received with a valid CRC.
+    *
+    * @param seq Sequence number of the frame.
+    * @param opsPtr Pointer to the operations of the frame, valid only until the method returns.
+    * @param opsLen Length of the operations.
+    */
+   virtual void _procFrm(const uint8_t &seq, const uint8_t* opsPtr, const uint8_t &opsLen) = 0;
+   /**
+    * @brief Extracts the frames completed by the bytes buffered.
+    *
+    * @param rxTmout The bytes buffered timed out, an incomplete frame is dropped instead of waiting for it's remaining bytes.
+    *
+    * @return The quantity of frames extracted and processed.
+    */
+   uint16_t _scan(const bool &rxTmout);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param srQty Quantity of shift registers of the chain the operations are merged for.
+    */
+   SRGXCmdParser(const uint8_t &srQty);
+   /**
+    * @brief Copy constructor, deleted.
+    *
+    * The object owns the masked writes buffers, a copy would share them with the original object, leading to their double release when both objects are destructed.
+    */
+   SRGXCmdParser(const SRGXCmdParser&) = delete;
+   /**
+    * @brief Class destructor
+    */
+   virtual ~SRGXCmdParser();
+   /**
+    * @brief Copy assignment operator, deleted.
+    */
+   SRGXCmdParser& operator=(const SRGXCmdParser&) = delete;
+   /**
+    * @brief Drops the frame being received if it's bytes stopped arriving for longer than the inter-byte timeout.
+    *
+    * The bytes buffered after the dropped frame's start of frame byte are scanned again, and the frames completed among them are processed.
+    *
+    * @param nowMs Current time in milliseconds.
+    *
+    * @return The quantity of frames processed.
+    *
+    * @note The method is invoked by parse(const uint8_t*, const size_t&, const uint32_t&) before parsing the bytes received, it should also be invoked periodically while no bytes are received so a frame stalled by a corrupted length byte does not delay the following one.
+    */
+   uint16_t chkRxTmout(const uint32_t &nowMs);
+   /**
+    * @brief Returns the quantity of frames dropped for a CRC mismatch.
+    */
+   uint32_t getCrcErrsQty();
+   /**
+    * @brief Returns the quantity of valid frames received, applied or not.
+    */
+   uint32_t getFramesQty();
+   /**
+    * @brief Returns the quantity of frames dropped for an inter-byte timeout, see setRxTmout(const uint32_t&).
+    */
+   uint32_t getRxTmoutsQty();
+   /**
+    * @brief Parses the bytes received from the transport.
+    *
+    * The frames completed are processed, partial frames are kept until completed by the following bytes.
+    *
+    * @param dataPtr Pointer to the bytes received.
+    * @param dataLen Quantity of bytes received.
+    * @param nowMs Current time in milliseconds, the time the bytes were received.
+    *
+    * @return The quantity of frames processed.
+    */
+   uint16_t parse(const uint8_t* dataPtr, const size_t &dataLen, const uint32_t &nowMs);
+   /**
+    * @brief Sets the inter-byte timeout.
+    *
+    * @param rxTmoutMs Longest time between two bytes of the same frame, in milliseconds, 0 disables the timeout. The default value is 100 ms.
+    */
+   void setRxTmout(const uint32_t &rxTmoutMs);
+};
+
+#endif //_SRGXCMDPARSER_H_
@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdSrvr.cpp
+ * @brief Code file for the SRGXCmdSrvr class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXCmdSrvr.h>
+#include <SRGXStateStore.h>
+
+SRGXCmdSrvr::SRGXCmdSrvr(ShiftRegGPIOXpander* SRGXPtr)
+:SRGXCmdParser((SRGXPtr != nullptr)?SRGXPtr->getSrQty():0), _SRGXPtr{SRGXPtr}
+{
+}
+
+uint16_t SRGXCmdSrvr::feed(const uint8_t* dataPtr, const size_t &dataLen){
+
+   return parse(dataPtr, dataLen, millis());
+}
+
+uint32_t SRGXCmdSrvr::getOpsQty(){
+
+   return _opsQty;
+}
+
+uint16_t SRGXCmdSrvr::poll(Stream &strm){
+   uint8_t rxBffr[64];
+   int rxQty{strm.available()};
+
+   _rspStrmPtr = &strm;
+   uint16_t result{chkRxTmout(millis())};
+   while(rxQty > 0){
+      size_t rdQty{0};
+
+      while((rdQty < sizeof(rxBffr)) && (rxQty > 0)){
+         const int rxByte{strm.read()};
+
+         if(rxByte < 0)
+            rxQty = 0;
+         else{
+            rxBffr[rdQty++] = static_cast<uint8_t>(rxByte);
+            rxQty--;
+         }
+      }
+      result += feed(rxBffr, rdQty);
+      if(rxQty == 0)
+         rxQty = strm.available();
+   }
+   _rspStrmPtr = nullptr;
+
+   return result;
+}
+
+void SRGXCmdSrvr::_procFrm(const uint8_t &seq, const uint8_t* opsPtr, const uint8_t &opsLen){
+   uint16_t rdsLen{0};
+   uint16_t opsQty{0};
+   uint8_t status{0x01};
+
+   if(_SRGXPtr == nullptr)
+      status = 0x02;
+   else if(_mergeOps(opsPtr, opsLen, _SRGXPtr->getInSrQty(), rdsLen, opsQty)){
+      status = 0x02;
+      if((_SRGXPtr->_SRGXMnBffrMtx != nullptr) && _SRGXPtr->_takeMainBffr(trcApiCmdSrvr)){
+         uint8_t* dataPtr{_rspFrm + 4};
+         bool wrtFound{false};
+         uint16_t opIdx{0};
+
+         for(uint8_t bffrIdx{0}; bffrIdx < _srQty; bffrIdx++){
+            if((*(_mskPtr + bffrIdx) | *(_tgglPtr + bffrIdx)) != 0x00){
+               _SRGXPtr->_mainUnrsrvdWrt(bffrIdx, *(_mskPtr + bffrIdx), *(_valsPtr + bffrIdx), *(_tgglPtr + bffrIdx));
+               wrtFound = true;
+            }
+         }
+         while(opIdx < opsLen){  // The data read is gathered in the operations order
+            const uint8_t opCode{*(opsPtr + opIdx)};
+
+            if(opCode == 0x00){
+               *dataPtr++ = 1;   // Protocol version
+               *dataPtr++ = _srQty;
+               *dataPtr++ = _SRGXPtr->getInSrQty();
+               opIdx += 1;
+            }
+            else if(opCode <= 0x03)
+               opIdx += 2 + *(opsPtr + opIdx + 1);
+            else if(opCode == 0x04)
+               opIdx += 5;
+            else if(opCode == 0x05)
+               opIdx += 1 + _srQty;
+            else{
+               if(opCode == 0x06){
+                  for(uint8_t bffrIdx{0}; bffrIdx < _srQty; bffrIdx++)
+                     *dataPtr++ = __atomic_load_n(_SRGXPtr->_mainBuffrArryPtr + bffrIdx, __ATOMIC_RELAXED);
+               }
+               else{
+                  _SRGXPtr->readInImg(dataPtr);
+                  dataPtr += _SRGXPtr->getInSrQty();
+               }
+               opIdx += 1;
+            }
+         }
+         _SRGXPtr->_giveMainBffr(wrtFound, trcApiCmdSrvr);  // A single flush latches every writing operation of the frame
+         _opsQty += opsQty;
+         status = 0x00;
+      }
+   }
+   _sendRsp(seq, status, (status == 0x00)?rdsLen:0);
+
+   return;
+}
+
+void SRGXCmdSrvr::_sendRsp(const uint8_t &seq, const uint8_t &status, const uint8_t &dataLen){
+   _rspFrm[0] = _sof;
+   _rspFrm[1] = 2 + dataLen;
+   _rspFrm[2] = seq;
+   _rspFrm[3] = status;
+
+   const uint16_t rspCrc{SRGXStateStore::crc16(_rspFrm + 1, 3 + dataLen)};
+   _rspFrm[4 + dataLen] = rspCrc & 0xFF;
+   _rspFrm[5 + dataLen] = rspCrc >> 8;
+   if(_rspStrmPtr != nullptr)
+      _rspStrmPtr->write(_rspFrm, 6 + dataLen);
+   else if(_wrtCb != nullptr)
+      _wrtCb(_rspFrm, 6 + dataLen, _wrtCbArgp);
+
+   return;
+}
+
+void SRGXCmdSrvr::setWrtCb(SRGXCmdWrtCb wrtCb, void* argp){
+   _wrtCb = wrtCb;
+   _wrtCbArgp = argp;
+
+   return;
+}
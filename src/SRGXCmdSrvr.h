@@ -0,0 +1,122 @@
+/**
+ ******************************************************************************
+ * @file SRGXCmdSrvr.h
+ * @brief Header file for the SRGXCmdSrvr class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class serves a compact binary framed protocol over any byte stream (UART, TCP socket, USB CDC), mapping each frame to a batch of operations over a ShiftRegGPIOXpander object applied under a single Main Buffer mutex taking and a single flush. The frames parsing and the operations merging are done by the SRGXCmdParser base class. The extras/SRGXCmdClient.py script is the host side client and benchmark of the protocol, verified against this class built for the host by extras/host.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXCMDSRVR_H_
+#define _SRGXCMDSRVR_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXCmdParser.h>
+
+/*SRGXCmdWrtCb: Transport writing callback, sends the response frames built by a SRGXCmdSrvr object.*/
+typedef size_t (*SRGXCmdWrtCb)(const uint8_t* dataPtr, const size_t &dataLen, void* argp);
+
+/**
+ * @brief A class that models a binary command protocol server for a ShiftRegGPIOXpander object.
+ *
+ * The server is transport agnostic: the bytes received are fed by feed(const uint8_t*, const size_t&) and the responses are sent through a writing callback, or both are done by poll(Stream&) for the Arduino streams (HardwareSerial, WiFiClient, USB CDC).
+ *
+ * Request frame: [0xA5] [len] [seq] [operations] [CRC16], where len is the quantity of bytes of seq and the operations (1 to 255), and the CRC16 (CCITT, 0xFFFF initial value, little endian, see SRGXStateStore::crc16()) covers len, seq and the operations. The operations are a sequence of an opcode followed by it's arguments:
+ * - 0x00 Info: no arguments. Reads the protocol version (1), the output and the input shift registers quantities (3 bytes).
+ * - 0x01 Set, 0x02 Reset, 0x03 Toggle: [n] [pin 1] .. [pin n], 1 <= n. Modifies a list of pins.
+ * - 0x04 Port write: [strtPin] [pinsQty] [value LSB] [value MSB], 1 <= pinsQty <= 16. Writes the pins of a contiguous virtual port, as SRGXVPort::writePort(uint16_t) does.
+ * - 0x05 Stamp: [srQty bytes]. Replaces the whole image.
+ * - 0x06 Read outputs: no arguments. Reads the whole image (srQty bytes).
+ * - 0x07 Read inputs: no arguments. Reads the Input Image (inSrQty bytes), see ShiftRegGPIOXpander::beginInput(const uint8_t&, const uint8_t&, const uint8_t&).
+ *
+ * Response frame: [0xA5] [len] [seq] [status] [data] [CRC16], where seq is the request's one and data holds the bytes read by the operations, in the operations order. Status 0x00: the frame was applied. Status 0x01: the operations were not valid (unknown opcode, truncated arguments, pin out of range or more than 253 bytes to read), nothing was applied. Status 0x02: the ShiftRegGPIOXpander object was not begun, nothing was applied.
+ *
+ * The whole frame is validated before applying it. The writing operations are then merged in order into a single masked write per shift register, applied under a single Main Buffer mutex taking and latched by a single flush, so a frame is atomic for the outputs. The reading operations return the image after every writing operation of the frame was applied, no matter their position in the frame.
+ *
+ * Frames with a CRC mismatch, or whose bytes stop arriving for longer than the inter-byte timeout, are dropped with no response and the bytes following their start of frame byte are scanned again for the next frame, see SRGXCmdParser. The client should resend the frames not responded after a timeout.
+ *
+ * @class SRGXCmdSrvr
+ */
+class SRGXCmdSrvr: public SRGXCmdParser{
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   uint8_t _rspFrm[_maxFrmLen]{};
+   SRGXCmdWrtCb _wrtCb{nullptr};
+   void* _wrtCbArgp{nullptr};
+   Stream* _rspStrmPtr{nullptr};   // Stream the responses are written to while polling
+   uint32_t _opsQty{0};
+
+   /**
+    * @brief Applies the frame received and sends it's response.
+    */
+   void _procFrm(const uint8_t &seq, const uint8_t* opsPtr, const uint8_t &opsLen) override;
+   /**
+    * @brief Builds and sends a response frame.
+    *
+    * @param seq Sequence number of the request.
+    * @param status Status of the request.
+    * @param dataLen Length of the data read, already placed in the response frame.
+    */
+   void _sendRsp(const uint8_t &seq, const uint8_t &status, const uint8_t &dataLen);
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object served, it must be begun before feeding the frames.
+    */
+   SRGXCmdSrvr(ShiftRegGPIOXpander* SRGXPtr);
+   /**
+    * @brief Feeds the bytes received from the transport.
+    *
+    * The frames completed are applied and their responses sent through the writing callback, see setWrtCb(SRGXCmdWrtCb, void*). Partial frames are kept until completed by the following bytes, or dropped by the inter-byte timeout, see SRGXCmdParser::setRxTmout(const uint32_t&).
+    *
+    * @param dataPtr Pointer to the bytes received.
+    * @param dataLen Quantity of bytes received.
+    *
+    * @return The quantity of frames completed and applied.
+    */
+   uint16_t feed(const uint8_t* dataPtr, const size_t &dataLen);
+   /**
+    * @brief Returns the quantity of operations of the frames applied.
+    */
+   uint32_t getOpsQty();
+   /**
+    * @brief Reads the bytes available in a stream, applies the frames completed and writes their responses to the same stream.
+    *
+    * @param strm Stream to serve, i.e. Serial or a connected WiFiClient.
+    *
+    * @return The quantity of frames completed and applied.
+    *
+    * @note The method does not block, it must be invoked periodically, i.e. from the loop() or a dedicated task. It also checks the inter-byte timeout of the frame being received, see SRGXCmdParser::chkRxTmout(const uint32_t&).
+    */
+   uint16_t poll(Stream &strm);
+   /**
+    * @brief Sets the callback that sends the response frames when the bytes are fed by feed(const uint8_t*, const size_t&).
+    *
+    * @param wrtCb Callback to invoke, nullptr to drop the responses.
+    * @param argp Optional parameter. Argument passed to the callback, i.e. the transport object (default nullptr).
+    */
+   void setWrtCb(SRGXCmdWrtCb wrtCb, void* argp = nullptr);
+};
+
+#endif //_SRGXCMDSRVR_H_
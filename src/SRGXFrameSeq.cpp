@@ -0,0 +1,198 @@
+/**
+ ******************************************************************************
+ * @file SRGXFrameSeq.cpp
+ * @brief Code file for the SRGXFrameSeq class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <SRGXFrameSeq.h>
+
+SRGXFrameSeq::SRGXFrameSeq()
+{
+}
+
+SRGXFrameSeq::SRGXFrameSeq(const uint8_t* seqPtr, const uint16_t &framesQty, const uint8_t &frameLen, const bool &deltaEnc, const uint32_t &seqSize)
+:_seqPtr{seqPtr}, _framesQty{framesQty}, _frameLen{frameLen}, _deltaEnc{deltaEnc}, _seqSize{seqSize}
+{
+   rewind();
+}
+
+void SRGXFrameSeq::applyDelta(uint8_t* imgPtr, const uint8_t* pairsPtr, const uint8_t &pairsQty){
+   if((imgPtr != nullptr) && (pairsPtr != nullptr)){
+      for(uint8_t pairInc{0}; pairInc < pairsQty; pairInc++)
+         *(imgPtr + *(pairsPtr + (2 * pairInc))) ^= *(pairsPtr + (2 * pairInc) + 1);
+   }
+
+   return;
+}
+
+uint32_t SRGXFrameSeq::encodeDelta(const uint8_t* framesPtr, const uint16_t &framesQty, const uint8_t &frameLen, uint8_t* outPtr, const uint32_t &outSize){
+   uint32_t encLen{0};
+   uint8_t chgQty{0};
+
+   if((framesPtr == nullptr) || (framesQty == 0) || (frameLen == 0))
+      return 0;
+
+   encLen = frameLen;   // The key frame is stored in full
+   if(outPtr != nullptr){
+      if(encLen > outSize)
+         return 0;
+      for(uint8_t byteInc{0}; byteInc < frameLen; byteInc++)
+         *(outPtr + byteInc) = *(framesPtr + byteInc);
+   }
+
+   for(uint16_t frameInc{1}; frameInc < framesQty; frameInc++){
+      const uint8_t* prvFramePtr = framesPtr + ((frameInc - 1) * static_cast<uint32_t>(frameLen));
+      const uint8_t* curFramePtr = prvFramePtr + frameLen;
+
+      chgQty = 0;
+      for(uint8_t byteInc{0}; byteInc < frameLen; byteInc++){
+         if(*(prvFramePtr + byteInc) != *(curFramePtr + byteInc))
+            chgQty++;
+      }
+      if((outPtr != nullptr) && ((encLen + (2 * static_cast<uint32_t>(chgQty)) + 2) > outSize))
+         return 0;
+      if(outPtr != nullptr){
+         *(outPtr + encLen) = chgQty;
+         for(uint8_t byteInc{0}, pairInc{0}; byteInc < frameLen; byteInc++){
+            if(*(prvFramePtr + byteInc) != *(curFramePtr + byteInc)){
+               *(outPtr + encLen + 1 + (2 * pairInc)) = byteInc;
+               *(outPtr + encLen + 2 + (2 * pairInc)) = *(prvFramePtr + byteInc) ^ *(curFramePtr + byteInc);
+               pairInc++;
+            }
+         }
+         *(outPtr + encLen + 1 + (2 * chgQty)) = chgQty;
+      }
+      encLen += (2 * static_cast<uint32_t>(chgQty)) + 2;
+   }
+
+   return encLen;
+}
+
+uint16_t SRGXFrameSeq::getCurFrame(){
+
+   return _curFrame;
+}
+
+const uint8_t* SRGXFrameSeq::getCurFramePtr(){
+   const uint8_t* result{nullptr};
+
+   if(_seqPtr != nullptr){
+      if(!_deltaEnc)
+         result = _seqPtr + (_curFrame * static_cast<uint32_t>(_frameLen));
+      else if(_curFrame == 0)
+         result = _seqPtr;
+   }
+
+   return result;
+}
+
+uint8_t SRGXFrameSeq::getFrameLen(){
+
+   return _frameLen;
+}
+
+uint16_t SRGXFrameSeq::getFramesQty(){
+
+   return _framesQty;
+}
+
+bool SRGXFrameSeq::isDeltaEnc(){
+
+   return _deltaEnc;
+}
+
+bool SRGXFrameSeq::isValid(){
+   bool result{(_seqPtr != nullptr) && (_framesQty > 0) && (_frameLen > 0)};
+
+   if(result){
+      if(!_deltaEnc){
+         result = (_seqSize == (_framesQty * static_cast<uint32_t>(_frameLen)));
+      }
+      else{
+         uint32_t recOffset{_frameLen};
+
+         result = (recOffset <= _seqSize);   // The key frame
+         for(uint16_t frameInc{1}; result && (frameInc < _framesQty); frameInc++){
+            if(recOffset >= _seqSize){ // No room left for the leading count
+               result = false;
+            }
+            else{
+               const uint8_t chgQty = *(_seqPtr + recOffset);
+
+               if((recOffset + (2 * static_cast<uint32_t>(chgQty)) + 2) > _seqSize)  // The record would end beyond the table
+                  result = false;
+               else if(*(_seqPtr + recOffset + 1 + (2 * chgQty)) != chgQty)
+                  result = false;
+               for(uint8_t pairInc{0}; result && (pairInc < chgQty); pairInc++){
+                  if(*(_seqPtr + recOffset + 1 + (2 * pairInc)) >= _frameLen)
+                     result = false;
+               }
+               recOffset += (2 * static_cast<uint32_t>(chgQty)) + 2;
+            }
+         }
+         if(result && (recOffset != _seqSize))  // The last record must end exactly at the table end
+            result = false;
+      }
+   }
+
+   return result;
+}
+
+void SRGXFrameSeq::rewind(){
+   _curFrame = 0;
+   _curOffset = _frameLen;
+
+   return;
+}
+
+bool SRGXFrameSeq::stepBwd(const uint8_t* &pairsPtr, uint8_t &pairsQty){
+   bool result{false};
+
+   pairsPtr = nullptr;
+   pairsQty = 0;
+   if((_seqPtr != nullptr) && (_curFrame > 0)){
+      if(_deltaEnc){
+         pairsQty = *(_seqPtr + _curOffset - 1); // The trailing count of the record leading to the current frame
+         _curOffset -= (2 * static_cast<uint32_t>(pairsQty)) + 2;
+         pairsPtr = _seqPtr + _curOffset + 1;
+      }
+      _curFrame--;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXFrameSeq::stepFwd(const uint8_t* &pairsPtr, uint8_t &pairsQty){
+   bool result{false};
+
+   pairsPtr = nullptr;
+   pairsQty = 0;
+   if((_seqPtr != nullptr) && ((_curFrame + 1) < _framesQty)){
+      if(_deltaEnc){
+         pairsQty = *(_seqPtr + _curOffset);
+         pairsPtr = _seqPtr + _curOffset + 1;
+         _curOffset += (2 * static_cast<uint32_t>(pairsQty)) + 2;
+      }
+      _curFrame++;
+      result = true;
+   }
+
+   return result;
+}
@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @file SRGXFrameSeq.h
+ * @brief Header file for the SRGXFrameSeq class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class models a read-only sequence of full-chain frames (images of the Main Buffer of a ShiftRegGPIOXpander object) stored in a const table, as needed by the SRGXSeqPlayer class. The frames might be stored in full, or delta-encoded to reduce the table footprint. The class has no dependencies on the Arduino framework nor the FreeRTOS kernel, so the encoding and decoding might be done and verified on a host computer.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXFRAMESEQ_H_
+#define _SRGXFRAMESEQ_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief A class that models a read-only sequence of ShiftRegGPIOXpander frames stored in a const table.
+ *
+ * Two storage formats are supported:
+ * - **Full frames**: framesQty consecutive frames of frameLen bytes each, as would be passed to ShiftRegGPIOXpander::stampOverMain(uint8_t*).
+ * - **Delta-encoded frames**: the first frame (the **key frame**) stored in full, followed by one record for each following frame holding only the bytes that change from the previous frame. Each record is formatted as [chgQty] [bffrIdx, xorVal] x chgQty [chgQty], where bffrIdx is the changing byte index and xorVal is the XOR between the previous and the new byte value. The XOR values and the trailing chgQty make the records walkable and applicable in both directions, so a delta-encoded sequence might be played backwards.
+ *
+ * The tables are never copied, the class only keeps a cursor over them. In the ESP32 platform const tables are kept in flash memory.
+ *
+ * @class SRGXFrameSeq
+ */
+class SRGXFrameSeq{
+private:
+   const uint8_t* _seqPtr{nullptr};
+   uint16_t _framesQty{0};
+   uint8_t _frameLen{0};
+   bool _deltaEnc{false};
+   uint32_t _seqSize{0};
+
+   uint16_t _curFrame{0};
+   uint32_t _curOffset{0};   // Delta-encoded sequences: offset of the record leading from _curFrame to _curFrame + 1
+
+public:
+   /**
+    * @brief Default constructor, builds an empty sequence.
+    */
+   SRGXFrameSeq();
+   /**
+    * @brief Class constructor
+    *
+    * @param seqPtr Pointer to the const table holding the sequence.
+    * @param framesQty Number of frames in the sequence, including the key frame for delta-encoded sequences.
+    * @param frameLen Length of each frame, equal to the number of shift registers of the ShiftRegGPIOXpander that will show the sequence.
+    * @param deltaEnc Indicates if the table is delta-encoded (true) or holds full frames (false).
+    * @param seqSize Size in bytes of the table: framesQty * frameLen for full frames sequences, the value returned by encodeDelta() for delta-encoded sequences. No byte beyond it is ever read, see isValid().
+    */
+   SRGXFrameSeq(const uint8_t* seqPtr, const uint16_t &framesQty, const uint8_t &frameLen, const bool &deltaEnc, const uint32_t &seqSize);
+   /**
+    * @brief Applies a list of delta pairs over a frame image.
+    *
+    * Each pair is formatted as [bffrIdx, xorVal], the frame image byte at bffrIdx is XORed with xorVal. The same list transforms the previous frame into the next one and the next one into the previous one.
+    *
+    * @param imgPtr Pointer to the frame image to modify.
+    * @param pairsPtr Pointer to the first pair of the list.
+    * @param pairsQty Number of pairs in the list.
+    */
+   static void applyDelta(uint8_t* imgPtr, const uint8_t* pairsPtr, const uint8_t &pairsQty);
+   /**
+    * @brief Delta-encodes a full frames sequence.
+    *
+    * Builds the delta-encoded table for a full frames sequence, see the class description for the format. The method is meant to be used at build time -i.e. on a host computer- to generate the const tables to be included in the firmware.
+    *
+    * @param framesPtr Pointer to the full frames sequence.
+    * @param framesQty Number of frames in the sequence.
+    * @param frameLen Length of each frame.
+    * @param outPtr Pointer to the memory area where the encoded table will be written, or nullptr to just calculate the encoded table length.
+    * @param outSize Size of the memory area pointed by outPtr.
+    *
+    * @return The length of the encoded table, or 0 if the parameters were not valid or the encoded table does not fit in outSize bytes.
+    */
+   static uint32_t encodeDelta(const uint8_t* framesPtr, const uint16_t &framesQty, const uint8_t &frameLen, uint8_t* outPtr, const uint32_t &outSize);
+   /**
+    * @brief Returns the index of the current frame of the cursor.
+    */
+   uint16_t getCurFrame();
+   /**
+    * @brief Returns a pointer to the current frame in the table.
+    *
+    * @return The pointer to the current frame for full frames sequences, or the pointer to the key frame for delta-encoded sequences if the cursor is at frame 0. nullptr otherwise.
+    */
+   const uint8_t* getCurFramePtr();
+   /**
+    * @brief Returns the length of each frame.
+    */
+   uint8_t getFrameLen();
+   /**
+    * @brief Returns the number of frames in the sequence.
+    */
+   uint16_t getFramesQty();
+   /**
+    * @brief Returns the storage format of the sequence.
+    *
+    * @retval true The sequence is delta-encoded.
+    * @retval false The sequence holds full frames.
+    */
+   bool isDeltaEnc();
+   /**
+    * @brief Checks the sequence parameters and table consistency.
+    *
+    * For full frames sequences the table size must be framesQty * frameLen. For delta-encoded sequences the whole table is walked, checking every record ends inside the table size before it's read, every record leading count matches it's trailing count, every bffrIdx is in the frame range, and the last record ends exactly at the table size.
+    *
+    * @retval true The sequence is usable.
+    * @retval false The sequence is empty or inconsistent.
+    */
+   bool isValid();
+   /**
+    * @brief Sets the cursor to the first frame of the sequence.
+    */
+   void rewind();
+   /**
+    * @brief Moves the cursor one frame backwards.
+    *
+    * @param pairsPtr For delta-encoded sequences, set to the first delta pair transforming the current frame into the previous one, see applyDelta().
+    * @param pairsQty For delta-encoded sequences, set to the number of delta pairs.
+    *
+    * @retval true The cursor was moved.
+    * @retval false The cursor was at the first frame, and was not moved.
+    */
+   bool stepBwd(const uint8_t* &pairsPtr, uint8_t &pairsQty);
+   /**
+    * @brief Moves the cursor one frame forward.
+    *
+    * @param pairsPtr For delta-encoded sequences, set to the first delta pair transforming the current frame into the next one, see applyDelta().
+    * @param pairsQty For delta-encoded sequences, set to the number of delta pairs.
+    *
+    * @retval true The cursor was moved.
+    * @retval false The cursor was at the last frame, and was not moved.
+    */
+   bool stepFwd(const uint8_t* &pairsPtr, uint8_t &pairsQty);
+};
+
+#endif //_SRGXFRAMESEQ_H_
@@ -0,0 +1,331 @@
+/**
+ ******************************************************************************
+ * @file SRGXMuxScanner.cpp
+ * @brief Code file for the SRGXMuxScanner class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXMuxScanner.h>
+
+SRGXMuxScanner::SRGXMuxScanner()
+{
+}
+
+SRGXMuxScanner::SRGXMuxScanner(ShiftRegGPIOXpander* SRGXPtr, const uint8_t &rowsStrtPin, const uint8_t &rowsQty, const uint8_t &colsStrtPin, const uint8_t &colsQty, const bool &rowActvHigh, const bool &colActvHigh)
+:_SRGXPtr{SRGXPtr}, _rowsStrtPin{rowsStrtPin}, _rowsQty{rowsQty}, _colsStrtPin{colsStrtPin}, _colsQty{colsQty}, _rowActvHigh{rowActvHigh}, _colActvHigh{colActvHigh}
+{
+   bool validSgmnts{(_SRGXPtr != nullptr) && (_rowsQty > 0) && (_rowsQty <= _maxSgmntPinsQty) && (_colsQty > 0) && (_colsQty <= _maxSgmntPinsQty)};
+
+   if(validSgmnts){
+      if(((_rowsStrtPin + _rowsQty - 1) > _SRGXPtr->getMaxSRGXPin()) || ((_colsStrtPin + _colsQty - 1) > _SRGXPtr->getMaxSRGXPin()))
+         validSgmnts = false;
+      else if(!(((_rowsStrtPin + _rowsQty) <= _colsStrtPin) || ((_colsStrtPin + _colsQty) <= _rowsStrtPin)))  // The segments overlap
+         validSgmnts = false;
+   }
+   if(!validSgmnts){
+      _SRGXPtr = nullptr;
+      _rowsQty = 0;
+      _colsQty = 0;
+   }
+   else{
+      const uint8_t lastPin = ((_rowsStrtPin + _rowsQty) > (_colsStrtPin + _colsQty))?(_rowsStrtPin + _rowsQty - 1):(_colsStrtPin + _colsQty - 1);
+
+      _bffrFrstIdx = ((_rowsStrtPin < _colsStrtPin)?_rowsStrtPin:_colsStrtPin) / 8;
+      _bffrsQty = (lastPin / 8) - _bffrFrstIdx + 1;
+
+      _scnMskPtr = new uint8_t[_SRGXPtr->getSrQty()];
+      memset(_scnMskPtr, 0x00, _SRGXPtr->getSrQty());
+      _blnkImgPtr = new uint8_t[_bffrsQty];
+      memset(_blnkImgPtr, 0x00, _bffrsQty);
+      for(uint8_t pinInc{0}; pinInc < _rowsQty; pinInc++){
+         *(_scnMskPtr + ((_rowsStrtPin + pinInc) / 8)) |= (1 << ((_rowsStrtPin + pinInc) % 8));
+         _setImgPin(_blnkImgPtr, _rowsStrtPin + pinInc, !_rowActvHigh);
+      }
+      for(uint8_t pinInc{0}; pinInc < _colsQty; pinInc++){
+         *(_scnMskPtr + ((_colsStrtPin + pinInc) / 8)) |= (1 << ((_colsStrtPin + pinInc) % 8));
+         _setImgPin(_blnkImgPtr, _colsStrtPin + pinInc, !_colActvHigh);
+      }
+      _rowImgsPtr = new uint8_t[_rowsQty * _bffrsQty];
+      _scnImgPtr = new uint8_t[_bffrsQty];
+      _frameBffrPtr = new uint16_t[_rowsQty];
+      memset(_frameBffrPtr, 0x00, _rowsQty * sizeof(uint16_t));
+      for(uint8_t rowInc{0}; rowInc < _rowsQty; rowInc++)
+         _buildRowImg(rowInc);
+   }
+}
+
+SRGXMuxScanner::~SRGXMuxScanner(){
+   end();
+   delete [] _scnMskPtr;
+   delete [] _blnkImgPtr;
+   delete [] _rowImgsPtr;
+   delete [] _scnImgPtr;
+   delete [] _frameBffrPtr;
+}
+
+bool SRGXMuxScanner::begin(const uint32_t &rowTmUs){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && !_scanning && (rowTmUs > 0)){
+      if(_SRGXPtr->_reservePins(_scnMskPtr)){
+         _minRowTmUs = _msrRowTm();
+         if(rowTmUs >= _minRowTmUs){
+            const esp_timer_create_args_t rowTmrArgs{
+               .callback = &SRGXMuxScanner::_rowTmrCb,
+               .arg = this,
+               .dispatch_method = ESP_TIMER_TASK,
+               .name = "SRGXMuxScanTmr",
+               .skip_unhandled_events = true
+            };
+
+            _rowTmUs = rowTmUs;
+            _curRow = 0;
+            if(xTaskCreate(_scanTsk, "SRGXMuxScanTsk", 2048, this, _scanTskPrrty, &_scanTskHndl) == pdPASS){
+               if(esp_timer_create(&rowTmrArgs, &_rowTmrHndl) == ESP_OK){
+                  if(esp_timer_start_periodic(_rowTmrHndl, _rowTmUs) == ESP_OK){
+                     _scanning = true;
+                     result = true;
+                  }
+               }
+            }
+            else
+               _scanTskHndl = nullptr;
+         }
+         if(!result){
+            _releaseScanRsrcs();
+            _SRGXPtr->_releasePins(_scnMskPtr);
+         }
+      }
+   }
+
+   return result;
+}
+
+void SRGXMuxScanner::_buildRowImg(const uint8_t &row){
+   uint8_t* rowImgPtr = _rowImgsPtr + (row * _bffrsQty);
+   const uint16_t colsVal = *(_frameBffrPtr + row);
+
+   taskENTER_CRITICAL(&_rowImgsMux);
+   memcpy(rowImgPtr, _blnkImgPtr, _bffrsQty);
+   _setImgPin(rowImgPtr, _rowsStrtPin + row, _rowActvHigh);
+   for(uint8_t colInc{0}; colInc < _colsQty; colInc++)
+      _setImgPin(rowImgPtr, _colsStrtPin + colInc, ((colsVal >> colInc) & 0x01) == _colActvHigh);
+   taskEXIT_CRITICAL(&_rowImgsMux);
+
+   return;
+}
+
+bool SRGXMuxScanner::clear(){
+   bool result{false};
+
+   if(_SRGXPtr != nullptr){
+      for(uint8_t rowInc{0}; rowInc < _rowsQty; rowInc++){
+         *(_frameBffrPtr + rowInc) = 0x0000;
+         _buildRowImg(rowInc);
+      }
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXMuxScanner::end(){
+   bool result{false};
+
+   if(_scanning){
+      _releaseScanRsrcs();
+      if(_SRGXPtr->_takeMainBffr(trcApiMuxScanner)){   // Leave the display dark
+         for(uint8_t bffrInc{0}; bffrInc < _bffrsQty; bffrInc++)
+            _SRGXPtr->_mainMskdWrt(_bffrFrstIdx + bffrInc, *(_scnMskPtr + _bffrFrstIdx + bffrInc), *(_blnkImgPtr + bffrInc));
+         _SRGXPtr->_giveMainBffr(true, trcApiMuxScanner);
+      }
+      _SRGXPtr->_releasePins(_scnMskPtr);
+      result = true;
+   }
+
+   return result;
+}
+
+void SRGXMuxScanner::_flshRowImg(const uint8_t* rowImgPtr){
+   if(_SRGXPtr->_takeMainBffr(trcApiMuxScanner)){
+      const bool oeBlnk{_blanking && (_SRGXPtr->_oe != 0xFF) && !_SRGXPtr->_oeBlnkFlsh};  // With the flushes OE blanking set the flush blanks the outputs by itself
+
+      if(_blanking && (_SRGXPtr->_oe == 0xFF)){ // No OE line, the blanking takes an extra flush
+         for(uint8_t bffrInc{0}; bffrInc < _bffrsQty; bffrInc++)
+            _SRGXPtr->_mainMskdWrt(_bffrFrstIdx + bffrInc, *(_scnMskPtr + _bffrFrstIdx + bffrInc), *(_blnkImgPtr + bffrInc));
+         _SRGXPtr->_sendAllSRCntnt(trcApiMuxScanner);
+      }
+      for(uint8_t bffrInc{0}; bffrInc < _bffrsQty; bffrInc++)
+         _SRGXPtr->_mainMskdWrt(_bffrFrstIdx + bffrInc, *(_scnMskPtr + _bffrFrstIdx + bffrInc), *(rowImgPtr + bffrInc));
+      if(oeBlnk)
+         _SRGXPtr->_blankOE(true);
+      _SRGXPtr->_sendAllSRCntnt(trcApiMuxScanner);
+      if(oeBlnk)
+         _SRGXPtr->_blankOE(false);
+      _SRGXPtr->_giveMainBffr(false, trcApiMuxScanner);
+   }
+
+   return;
+}
+
+uint8_t SRGXMuxScanner::getColsQty(){
+
+   return _colsQty;
+}
+
+uint32_t SRGXMuxScanner::getMinRowTm(){
+
+   return _minRowTmUs;
+}
+
+uint8_t SRGXMuxScanner::getRowsQty(){
+
+   return _rowsQty;
+}
+
+bool SRGXMuxScanner::isScanning(){
+
+   return _scanning;
+}
+
+uint32_t SRGXMuxScanner::_msrRowTm(){
+   uint32_t result{0};
+
+   for(uint8_t msrInc{0}; msrInc < _rowTmMsrsQty; msrInc++){  // The shortest refresh measured is kept, the longer ones were preempted
+      const int64_t strtTm{esp_timer_get_time()};
+
+      _flshRowImg(_blnkImgPtr);
+      const uint32_t msrdTmUs{static_cast<uint32_t>(esp_timer_get_time() - strtTm)};
+      if((msrInc == 0) || (msrdTmUs < result))
+         result = msrdTmUs;
+   }
+
+   return result;
+}
+
+uint16_t SRGXMuxScanner::readRow(const uint8_t &row){
+   uint16_t result{0};
+
+   if((_SRGXPtr != nullptr) && (row < _rowsQty))
+      result = *(_frameBffrPtr + row);
+
+   return result;
+}
+
+void SRGXMuxScanner::_releaseScanRsrcs(){
+   _scanning = false;
+   if(_rowTmrHndl != nullptr){
+      esp_timer_stop(_rowTmrHndl);
+      esp_timer_delete(_rowTmrHndl);
+      _rowTmrHndl = nullptr;
+   }
+   if(_scanTskHndl != nullptr){
+      xTaskNotifyGive(_scanTskHndl);   // Wake the scanning task so it ends itself
+      while(_scanTskHndl != nullptr)
+         vTaskDelay(1);
+   }
+
+   return;
+}
+
+void SRGXMuxScanner::_rowTmrCb(void* argp){
+   SRGXMuxScanner* scannerPtr = static_cast<SRGXMuxScanner*>(argp);
+
+   if(scannerPtr->_scanTskHndl != nullptr)
+      xTaskNotifyGive(scannerPtr->_scanTskHndl);
+
+   return;
+}
+
+void SRGXMuxScanner::_scanNextRow(){
+   taskENTER_CRITICAL(&_rowImgsMux);
+   memcpy(_scnImgPtr, _rowImgsPtr + (_curRow * _bffrsQty), _bffrsQty);
+   taskEXIT_CRITICAL(&_rowImgsMux);
+
+   _flshRowImg(_scnImgPtr);
+   _curRow = (_curRow + 1) % _rowsQty;
+
+   return;
+}
+
+void SRGXMuxScanner::_scanTsk(void* argp){
+   SRGXMuxScanner* scannerPtr = static_cast<SRGXMuxScanner*>(argp);
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      if(scannerPtr->_rowTmrHndl == nullptr)   // The scanning is being stopped, the task is not blocked at a Main Buffer operation so it's safe to end it here
+         break;
+      scannerPtr->_scanNextRow();
+   }
+   scannerPtr->_scanTskHndl = nullptr;
+   vTaskDelete(NULL);
+}
+
+void SRGXMuxScanner::setBlanking(const bool &blanking){
+   _blanking = blanking;
+
+   return;
+}
+
+void SRGXMuxScanner::_setImgPin(uint8_t* imgPtr, const uint8_t &srPin, const bool &pinVal){
+   if(pinVal)
+      *(imgPtr + (srPin / 8) - _bffrFrstIdx) |= (1 << (srPin % 8));
+   else
+      *(imgPtr + (srPin / 8) - _bffrFrstIdx) &= ~(1 << (srPin % 8));
+
+   return;
+}
+
+bool SRGXMuxScanner::setPixel(const uint8_t &row, const uint8_t &col, const bool &pixelVal){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && (row < _rowsQty) && (col < _colsQty)){
+      if(pixelVal)
+         *(_frameBffrPtr + row) |= (1 << col);
+      else
+         *(_frameBffrPtr + row) &= ~(1 << col);
+      _buildRowImg(row);
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXMuxScanner::setScanTskPrrty(const BaseType_t &scanTskPrrty){
+   bool result{false};
+
+   if((scanTskPrrty > 0) && (scanTskPrrty < configMAX_PRIORITIES)){
+      _scanTskPrrty = scanTskPrrty;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXMuxScanner::writeRow(const uint8_t &row, const uint16_t &colsVal){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && (row < _rowsQty)){
+      *(_frameBffrPtr + row) = colsVal & static_cast<uint16_t>((1UL << _colsQty) - 1);
+      _buildRowImg(row);
+      result = true;
+   }
+
+   return result;
+}
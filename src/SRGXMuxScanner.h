@@ -0,0 +1,224 @@
+/**
+ ******************************************************************************
+ * @file SRGXMuxScanner.h
+ * @brief Header file for the SRGXMuxScanner class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class provides a multiplexed displays scanning driver -LED matrices, multi-digit 7-segment displays- for ShiftRegGPIOXpander objects. The driver keeps a framebuffer, precomputes the chain image of each row, and refreshes the rows at a fixed row time driven by a hardware based timer.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXMUXSCANNER_H_
+#define _SRGXMUXSCANNER_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <esp_timer.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+/**
+ * @brief A class that models a multiplexed display scanning driver over a ShiftRegGPIOXpander object.
+ *
+ * The display is described by two disjoint segments of consecutive pins: the **rows** segment -the common lines, one row is active at a time- and the **columns** segment -the data lines for the active row-. For a 7-segment display each digit common line is a row and the segments are the columns.
+ *
+ * The driver keeps a framebuffer of one columns value per row. Each framebuffer modification rebuilds the chain image of the modified row, so the refresh just stamps the precomputed image of the next row over the Main Buffer and flushes it. No memory is allocated and no image is calculated while scanning.
+ *
+ * When blanking is enabled -the default- the outputs are kept dark while the rows are switched, avoiding the ghosting produced by the new columns data being shown on the previous row while the row drivers switch. If the ShiftRegGPIOXpander has an OE pin set (see ShiftRegGPIOXpander::setOEPin(const uint8_t&)) the outputs are disabled through the OE line while the new row image is flushed, so each row takes a single flush. Without an OE line each row change takes two flushes: first all rows and columns are set inactive, then the new row image is set.
+ *
+ * The row time is driven by an esp_timer periodic timer (hardware timer based), whose callback wakes a dedicated scanning task that refreshes the row. The refresh frequency of the whole display is 1 / (rowTmUs * rowsQty).
+ *
+ * Each row refresh is a full bit-banged flush of the chain, so the row time is bounded by the flush time. With the default 10 us bit time (see ShiftRegGPIOXpander::setBitDelay(const uint32_t&)) each shift register adds about 85 us to a flush: a 2 registers chain flushes in about 175 us, refreshing 8 rows at about 700 Hz with the OE blanking, or 350 Hz with the blanking flush. Calibrating the bit time (see ShiftRegGPIOXpander::calibrateBitDelay(const uint8_t&, const uint32_t&, const uint8_t&)) shortens the flush several times. begin(const uint32_t&) measures the row refresh and rejects shorter row times, see getMinRowTm().
+ *
+ * The rows and columns pins are reserved for the driver while scanning -see SRGXVPort::reservePins()- so they are not overwritten by exclusive SRGXVPort objects nor by Auxiliary Buffer moves.
+ *
+ * @class SRGXMuxScanner
+ */
+class SRGXMuxScanner{
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   uint8_t _rowsStrtPin{0};
+   uint8_t _rowsQty{0};
+   uint8_t _colsStrtPin{0};
+   uint8_t _colsQty{0};
+   bool _rowActvHigh{true};
+   bool _colActvHigh{true};
+   bool _blanking{true};
+   const uint8_t _maxSgmntPinsQty{16};
+
+   uint8_t _bffrFrstIdx{0};   // Index of the first Main Buffer byte holding a rows or columns pin
+   uint8_t _bffrsQty{0};   // Number of Main Buffer bytes from _bffrFrstIdx to the last byte holding a rows or columns pin
+   uint8_t* _scnMskPtr{nullptr}; // Main Buffer sized mask of the rows and columns pins
+   uint8_t* _blnkImgPtr{nullptr};   // Image with every row and column inactive, _bffrsQty bytes long
+   uint8_t* _rowImgsPtr{nullptr};   // Precomputed rows images, _rowsQty x _bffrsQty bytes
+   uint8_t* _scnImgPtr{nullptr}; // Working copy of the row image being refreshed, used by the scanning task only
+   uint16_t* _frameBffrPtr{nullptr};   // Columns values for each row
+   portMUX_TYPE _rowImgsMux = portMUX_INITIALIZER_UNLOCKED;   // Spinlock protecting the rows images while rebuilt or copied
+
+   bool _scanning{false};
+   uint8_t _curRow{0};
+   uint32_t _rowTmUs{0};
+   uint32_t _minRowTmUs{0};   // Shortest row refresh measured by begin()
+   static const uint8_t _rowTmMsrsQty{4};
+   esp_timer_handle_t _rowTmrHndl{nullptr};
+   TaskHandle_t _scanTskHndl{nullptr};
+   BaseType_t _scanTskPrrty{configMAX_PRIORITIES - 2};
+
+   void _buildRowImg(const uint8_t &row);
+   void _flshRowImg(const uint8_t* rowImgPtr);
+   uint32_t _msrRowTm();
+   void _releaseScanRsrcs();
+   static void _rowTmrCb(void* argp);
+   void _scanNextRow();
+   static void _scanTsk(void* argp);
+   void _setImgPin(uint8_t* imgPtr, const uint8_t &srPin, const bool &pinVal);
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   SRGXMuxScanner();
+   /**
+    * @brief Class constructor
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object whose pins drive the display.
+    * @param rowsStrtPin First pin of the rows segment.
+    * @param rowsQty Number of rows. The valid range is 1 <= rowsQty <= 16.
+    * @param colsStrtPin First pin of the columns segment.
+    * @param colsQty Number of columns. The valid range is 1 <= colsQty <= 16.
+    * @param rowActvHigh Optional parameter. Level that activates a row, HIGH (true, default) or LOW (false).
+    * @param colActvHigh Optional parameter. Level that lights a column of the active row, HIGH (true, default) or LOW (false).
+    *
+    * @note The framebuffer and the rows images are allocated by the constructor, with every pixel off. If the segments are out of the ShiftRegGPIOXpander pins range or overlap each other, the object is built as an invalid object, and every other method will fail.
+    */
+   SRGXMuxScanner(ShiftRegGPIOXpander* SRGXPtr, const uint8_t &rowsStrtPin, const uint8_t &rowsQty, const uint8_t &colsStrtPin, const uint8_t &colsQty, const bool &rowActvHigh = true, const bool &colActvHigh = true);
+   /**
+    * @brief Copy constructor, deleted.
+    *
+    * The object owns the timer, the scanning task and the images memory, a copy would share them with the original object.
+    */
+   SRGXMuxScanner(const SRGXMuxScanner&) = delete;
+   /**
+    * @brief Class destructor
+    *
+    * Stops the scanning, releasing the timer, the scanning task, the reserved pins and the memory.
+    */
+   ~SRGXMuxScanner();
+   /**
+    * @brief Copy assignment operator, deleted.
+    */
+   SRGXMuxScanner& operator=(const SRGXMuxScanner&) = delete;
+   /**
+    * @brief Starts the display scanning.
+    *
+    * Reserves the rows and columns pins, measures the row refresh time -flushing the display dark- and starts the row timer. The framebuffer contents are kept, so it might be filled before the scanning is started.
+    *
+    * @param rowTmUs Time each row is kept active, in microseconds. The valid range is rowTmUs >= getMinRowTm(), the row refresh time measured: the flush time -that depends on the quantity of shift registers and the bit time- doubled if the blanking is done without an OE line.
+    *
+    * @retval true The scanning started.
+    * @retval false The object is not valid, the scanning was already started, the pins were already reserved, the row time was shorter than the row refresh measured, or the timer or the scanning task could not be created.
+    */
+   bool begin(const uint32_t &rowTmUs);
+   /**
+    * @brief Clears the framebuffer, all the columns of all the rows are set inactive.
+    *
+    * @retval true The framebuffer was cleared.
+    * @retval false The object is not valid.
+    */
+   bool clear();
+   /**
+    * @brief Stops the display scanning.
+    *
+    * Stops the row timer and the scanning task, sets every row and column inactive and releases the reserved pins. The framebuffer is kept so the scanning can be restarted with begin().
+    *
+    * @retval true The scanning was stopped.
+    * @retval false The scanning was not started.
+    */
+   bool end();
+   /**
+    * @brief Returns the number of columns of the display.
+    */
+   uint8_t getColsQty();
+   /**
+    * @brief Returns the row refresh time measured by the last begin(const uint32_t&) invoked.
+    *
+    * @return The shortest row time accepted by begin(const uint32_t&), in microseconds, or 0 if begin() was not invoked. Rejected row times might be retried with this value or a longer one.
+    */
+   uint32_t getMinRowTm();
+   /**
+    * @brief Returns the number of rows of the display.
+    */
+   uint8_t getRowsQty();
+   /**
+    * @brief Returns the scanning condition of the driver.
+    *
+    * @retval true The display is being scanned.
+    * @retval false The display is not being scanned.
+    */
+   bool isScanning();
+   /**
+    * @brief Returns the framebuffer value of a row.
+    *
+    * @param row Row to read. The valid range is 0 <= row < getRowsQty().
+    *
+    * @return The columns value of the row, bit 0 being the first column, or 0 if the row is out of range or the object is not valid.
+    */
+   uint16_t readRow(const uint8_t &row);
+   /**
+    * @brief Sets the ghosting prevention blanking of the display.
+    *
+    * @param blanking If true the outputs are kept dark while the rows are switched -through the OE line if set, or by a flush with all rows and columns inactive otherwise-, if false the new row image is directly flushed, at the price of possible ghosting.
+    *
+    * @note Set it before begin(const uint32_t&), as the row time is validated by it against the row refresh with the blanking set.
+    */
+   void setBlanking(const bool &blanking);
+   /**
+    * @brief Sets a single pixel -a column of a row- of the framebuffer.
+    *
+    * @param row Row of the pixel. The valid range is 0 <= row < getRowsQty().
+    * @param col Column of the pixel. The valid range is 0 <= col < getColsQty().
+    * @param pixelVal true to light the pixel, false to turn it off.
+    *
+    * @retval true The pixel was set.
+    * @retval false The parameters were out of range, or the object is not valid.
+    */
+   bool setPixel(const uint8_t &row, const uint8_t &col, const bool &pixelVal);
+   /**
+    * @brief Sets the priority of the scanning task.
+    *
+    * @param scanTskPrrty The priority of the task created to refresh the rows. The default value is (configMAX_PRIORITIES - 2).
+    *
+    * @retval true The priority was set, it will take effect the next time begin() is invoked.
+    * @retval false The priority was out of the valid range.
+    */
+   bool setScanTskPrrty(const BaseType_t &scanTskPrrty);
+   /**
+    * @brief Sets the framebuffer value of a row.
+    *
+    * The row image is rebuilt, the new value will be shown the next time the row is refreshed.
+    *
+    * @param row Row to write. The valid range is 0 <= row < getRowsQty().
+    * @param colsVal Columns value, bit 0 being the first column. Bits beyond the columns quantity are ignored.
+    *
+    * @retval true The row was written.
+    * @retval false The row was out of range, or the object is not valid.
+    */
+   bool writeRow(const uint8_t &row, const uint16_t &colsVal);
+};
+
+#endif //_SRGXMUXSCANNER_H_
@@ -0,0 +1,221 @@
+/**
+ ******************************************************************************
+ * @file SRGXSeqPlayer.cpp
+ * @brief Code file for the SRGXSeqPlayer class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXSeqPlayer.h>
+
+SRGXSeqPlayer::SRGXSeqPlayer()
+{
+}
+
+SRGXSeqPlayer::SRGXSeqPlayer(ShiftRegGPIOXpander* SRGXPtr)
+:_SRGXPtr{SRGXPtr}
+{
+}
+
+SRGXSeqPlayer::~SRGXSeqPlayer(){
+   stop();
+}
+
+bool SRGXSeqPlayer::_applyFrame(const bool &fullFrame, const uint8_t* pairsPtr, const uint8_t &pairsQty){
+   bool result{false};
+   const uint8_t* framePtr{nullptr};
+
+   if(_SRGXPtr->_takeMainBffr(trcApiSeqPlayer)){
+      if(fullFrame){
+         framePtr = _frameSeq.getCurFramePtr();
+         for(uint8_t bffrIdx{0}; bffrIdx < _frameSeq.getFrameLen(); bffrIdx++)
+            _SRGXPtr->_mainUnrsrvdWrt(bffrIdx, 0xFF, *(framePtr + bffrIdx));   // Straight from the table, no RAM staging
+      }
+      else{
+         for(uint8_t pairInc{0}; pairInc < pairsQty; pairInc++)
+            _SRGXPtr->_mainUnrsrvdWrt(*(pairsPtr + (2 * pairInc)), 0x00, 0x00, *(pairsPtr + (2 * pairInc) + 1));
+      }
+      _SRGXPtr->_giveMainBffr(true, trcApiSeqPlayer);
+      result = true;
+   }
+
+   return result;
+}
+
+void SRGXSeqPlayer::_frameTmrCb(void* argp){
+   SRGXSeqPlayer* playerPtr = static_cast<SRGXSeqPlayer*>(argp);
+
+   if(playerPtr->_playerTskHndl != nullptr)
+      xTaskNotifyGive(playerPtr->_playerTskHndl);
+
+   return;
+}
+
+uint16_t SRGXSeqPlayer::getCurFrame(){
+
+   return _frameSeq.getCurFrame();
+}
+
+bool SRGXSeqPlayer::isPlaying(){
+
+   return _playing;
+}
+
+bool SRGXSeqPlayer::pause(){
+   bool result{false};
+
+   if(_playing && !_paused){
+      _paused = true;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXSeqPlayer::play(const uint32_t &framePeriodUs, const SRGXSeqPlayMode &playMode){
+   bool result{false};
+
+   stop();
+   if((_SRGXPtr != nullptr) && _frameSeq.isValid() && (framePeriodUs >= 1000)){
+      const esp_timer_create_args_t frameTmrArgs{
+         .callback = &SRGXSeqPlayer::_frameTmrCb,
+         .arg = this,
+         .dispatch_method = ESP_TIMER_TASK,
+         .name = "SRGXSeqPlayerTmr",
+         .skip_unhandled_events = true
+      };
+
+      _framePeriodUs = framePeriodUs;
+      _playMode = playMode;
+      _playFwd = true;
+      _paused = false;
+      _frameSeq.rewind();
+      _applyFrame(true, nullptr, 0);   // The first frame is applied in full, for both formats
+
+      if(xTaskCreate(_playerTsk, "SRGXSeqPlayerTsk", 2048, this, _playerTskPrrty, &_playerTskHndl) == pdPASS){
+         if(esp_timer_create(&frameTmrArgs, &_frameTmrHndl) == ESP_OK){
+            _playing = true;
+            if(esp_timer_start_periodic(_frameTmrHndl, _framePeriodUs) == ESP_OK)
+               result = true;
+         }
+      }
+      else
+         _playerTskHndl = nullptr;
+      if(!result)
+         stop();
+   }
+
+   return result;
+}
+
+void SRGXSeqPlayer::_playerTsk(void* argp){
+   SRGXSeqPlayer* playerPtr = static_cast<SRGXSeqPlayer*>(argp);
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      if(playerPtr->_frameTmrHndl == nullptr)   // The player is being stopped, the task is not blocked at a Main Buffer operation so it's safe to end it here
+         break;
+      playerPtr->_showNextFrame();
+   }
+   playerPtr->_playerTskHndl = nullptr;
+   vTaskDelete(NULL);
+}
+
+bool SRGXSeqPlayer::resume(){
+   bool result{false};
+
+   if(_playing && _paused){
+      _paused = false;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXSeqPlayer::setPlayerTskPrrty(const BaseType_t &playerTskPrrty){
+   bool result{false};
+
+   if((playerTskPrrty > 0) && (playerTskPrrty < configMAX_PRIORITIES)){
+      _playerTskPrrty = playerTskPrrty;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXSeqPlayer::setSequence(const uint8_t* seqPtr, const uint16_t &framesQty, const bool &deltaEnc, const uint32_t &seqSize){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && !_playing){
+      SRGXFrameSeq newFrameSeq(seqPtr, framesQty, _SRGXPtr->getSrQty(), deltaEnc, seqSize);
+
+      if(newFrameSeq.isValid()){
+         _frameSeq = newFrameSeq;
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+void SRGXSeqPlayer::_showNextFrame(){
+   const uint8_t* pairsPtr{nullptr};
+   uint8_t pairsQty{0};
+   bool stepped{false};
+
+   if(_playing && !_paused){
+      stepped = (_playFwd)?_frameSeq.stepFwd(pairsPtr, pairsQty):_frameSeq.stepBwd(pairsPtr, pairsQty);
+      if(!stepped){  // The sequence end was reached in the playing direction
+         switch(_playMode){
+            case seqPlayLoop:
+               _frameSeq.rewind();
+               _applyFrame(true, nullptr, 0);
+               break;
+            case seqPlayPingPong:
+               _playFwd = !_playFwd;
+               stepped = (_playFwd)?_frameSeq.stepFwd(pairsPtr, pairsQty):_frameSeq.stepBwd(pairsPtr, pairsQty);
+               break;
+            default: // seqPlayOnce
+               _playing = false; // The timer is left running, it's only stopped and deleted by stop(), the single owner of the handle
+               break;
+         }
+      }
+      if(stepped)
+         _applyFrame(!_frameSeq.isDeltaEnc(), pairsPtr, pairsQty);
+   }
+
+   return;
+}
+
+bool SRGXSeqPlayer::stop(){
+   bool result{_playing};
+
+   _playing = false;
+   if(_frameTmrHndl != nullptr){
+      esp_timer_stop(_frameTmrHndl);
+      esp_timer_delete(_frameTmrHndl);
+      _frameTmrHndl = nullptr;
+   }
+   if(_playerTskHndl != nullptr){
+      xTaskNotifyGive(_playerTskHndl); // Wake the player task so it ends itself
+      while(_playerTskHndl != nullptr)
+         vTaskDelay(1);
+   }
+
+   return result;
+}
@@ -0,0 +1,170 @@
+/**
+ ******************************************************************************
+ * @file SRGXSeqPlayer.h
+ * @brief Header file for the SRGXSeqPlayer class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class provides a frame sequence player for ShiftRegGPIOXpander objects. The frames are streamed straight from a const table -kept in flash memory in the ESP32 platform- to the Main Buffer, without RAM staging, at a fixed frame rate driven by a hardware based timer.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXSEQPLAYER_H_
+#define _SRGXSEQPLAYER_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <esp_timer.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXFrameSeq.h>
+
+/**
+ * @brief Sequence playing modes
+ */
+enum SRGXSeqPlayMode : uint8_t{
+   seqPlayOnce,   // The sequence is played from the first to the last frame, then the player stops showing frames until stop() or play() release the timer and the player task
+   seqPlayLoop,   // The sequence is played from the first to the last frame, then restarts from the first frame
+   seqPlayPingPong   // The sequence is played from the first to the last frame, then backwards to the first frame, and so on
+};
+
+/**
+ * @brief A class that models a frame sequence player for a ShiftRegGPIOXpander object.
+ *
+ * The sequence frames are described by a SRGXFrameSeq object, full frames or delta-encoded. Each frame is applied to the ShiftRegGPIOXpander Main Buffer under a single Main Buffer mutex taking and flushed once, straight from the const table: no copy of the frame is made, and no heap memory is used while playing.
+ *
+ * The frame rate is driven by an esp_timer periodic timer (hardware timer based), whose callback wakes a dedicated player task that applies the frame. The player task is created when playing starts and deleted when the player is stopped.
+ *
+ * @note Full frames overwrite the whole Main Buffer. Delta-encoded frames only toggle the bytes bits that change from the previous frame, so pins modified by other means while playing keep their modified state as long as the sequence does not modify them. When a delta-encoded sequence loops the key frame is applied in full.
+ *
+ * @class SRGXSeqPlayer
+ */
+class SRGXSeqPlayer{
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   SRGXFrameSeq _frameSeq;
+   SRGXSeqPlayMode _playMode{seqPlayOnce};
+   bool _playFwd{true};
+   bool _playing{false};
+   bool _paused{false};
+   uint32_t _framePeriodUs{0};
+   esp_timer_handle_t _frameTmrHndl{nullptr};
+   TaskHandle_t _playerTskHndl{nullptr};
+   BaseType_t _playerTskPrrty{configMAX_PRIORITIES - 2};
+
+   bool _applyFrame(const bool &fullFrame, const uint8_t* pairsPtr, const uint8_t &pairsQty);
+   static void _frameTmrCb(void* argp);
+   static void _playerTsk(void* argp);
+   void _showNextFrame();
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   SRGXSeqPlayer();
+   /**
+    * @brief Class constructor
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object whose Main Buffer will show the frames. The object must be begun before playing.
+    */
+   SRGXSeqPlayer(ShiftRegGPIOXpander* SRGXPtr);
+   /**
+    * @brief Copy constructor, deleted.
+    *
+    * The object owns the timer and the player task, a copy would share them with the original object.
+    */
+   SRGXSeqPlayer(const SRGXSeqPlayer&) = delete;
+   /**
+    * @brief Class destructor
+    *
+    * Stops the sequence, releasing the timer and the player task.
+    */
+   ~SRGXSeqPlayer();
+   /**
+    * @brief Copy assignment operator, deleted.
+    */
+   SRGXSeqPlayer& operator=(const SRGXSeqPlayer&) = delete;
+   /**
+    * @brief Returns the index of the frame being shown.
+    */
+   uint16_t getCurFrame();
+   /**
+    * @brief Returns the playing condition of the player.
+    *
+    * @retval true The sequence is playing, paused or not.
+    * @retval false The sequence is stopped, either by stop() or because a seqPlayOnce sequence reached the last frame.
+    */
+   bool isPlaying();
+   /**
+    * @brief Pauses the sequence, keeping the frame being shown.
+    *
+    * @retval true The sequence was playing and was paused.
+    * @retval false The sequence was not playing.
+    */
+   bool pause();
+   /**
+    * @brief Starts playing the sequence from the first frame.
+    *
+    * The first frame is applied immediately, the following ones every framePeriodUs microseconds.
+    *
+    * @param framePeriodUs Time between frames, in microseconds. The valid range is framePeriodUs >= 1000, the minimum being enforced to keep the flush time -that depends on the quantity of shift registers- inside the frame period.
+    * @param playMode Optional parameter. Playing mode, see SRGXSeqPlayMode. seqPlayOnce if not provided.
+    *
+    * @retval true The sequence started playing.
+    * @retval false The sequence was not set or not valid, the period was out of range, or the timer or the player task could not be created.
+    */
+   bool play(const uint32_t &framePeriodUs, const SRGXSeqPlayMode &playMode = seqPlayOnce);
+   /**
+    * @brief Resumes a paused sequence from the frame it was paused at.
+    *
+    * @retval true The sequence was paused and was resumed.
+    * @retval false The sequence was not paused.
+    */
+   bool resume();
+   /**
+    * @brief Sets the sequence to be played.
+    *
+    * @param seqPtr Pointer to the const table holding the sequence, see SRGXFrameSeq for the formats. The table is never copied, it must remain available while the sequence plays.
+    * @param framesQty Number of frames of the sequence.
+    * @param deltaEnc Indicates if the table is delta-encoded (true) or holds full frames (false).
+    * @param seqSize Size in bytes of the table, see SRGXFrameSeq::SRGXFrameSeq(). For a table defined as an array in the sketch sizeof() of the array might be used.
+    *
+    * @retval true The sequence was set.
+    * @retval false The player has no valid ShiftRegGPIOXpander, the sequence is not valid, or the player is playing.
+    *
+    * @note The frames length is taken from the ShiftRegGPIOXpander object, see ShiftRegGPIOXpander::getSrQty().
+    */
+   bool setSequence(const uint8_t* seqPtr, const uint16_t &framesQty, const bool &deltaEnc, const uint32_t &seqSize);
+   /**
+    * @brief Sets the priority of the player task.
+    *
+    * @param playerTskPrrty The priority of the task created to apply the frames. The default value is (configMAX_PRIORITIES - 2).
+    *
+    * @retval true The priority was set, it will take effect the next time play() is invoked.
+    * @retval false The priority was out of the valid range.
+    */
+   bool setPlayerTskPrrty(const BaseType_t &playerTskPrrty);
+   /**
+    * @brief Stops the sequence, keeping the frame being shown.
+    *
+    * @retval true The sequence was playing and was stopped.
+    * @retval false The sequence was not playing.
+    */
+   bool stop();
+};
+
+#endif //_SRGXSEQPLAYER_H_
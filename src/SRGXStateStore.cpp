@@ -0,0 +1,217 @@
+/**
+ ******************************************************************************
+ * @file SRGXStateStore.cpp
+ * @brief Code file for the SRGXStateStore classes, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <SRGXStateStore.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+   #include <esp_attr.h>
+#endif
+
+SRGXStateStore::SRGXStateStore()
+{
+}
+
+SRGXStateStore::~SRGXStateStore()
+{
+}
+
+uint16_t SRGXStateStore::crc16(const uint8_t* dataPtr, const uint16_t &dataLen, uint16_t crc){
+   for(uint16_t byteInc{0}; byteInc < dataLen; byteInc++){
+      crc ^= static_cast<uint16_t>(*(dataPtr + byteInc)) << 8;
+      for(uint8_t bitInc{0}; bitInc < 8; bitInc++)
+         crc = (crc & 0x8000)?((crc << 1) ^ 0x1021):(crc << 1);
+   }
+
+   return crc;
+}
+
+bool SRGXStateStore::decodeRec(const uint8_t* recPtr, const uint16_t &recLen, uint8_t* imgPtr, const uint8_t &srQty){
+   bool result{false};
+
+   if((recPtr != nullptr) && (imgPtr != nullptr) && (srQty > 0) && (recLen == getRecLen(srQty))){
+      if((memcmp(recPtr, "SRGS", 4) == 0) && (*(recPtr + 4) == 1) && (*(recPtr + 5) == srQty)){
+         const uint16_t recCrc{static_cast<uint16_t>(*(recPtr + 6) | (*(recPtr + 7) << 8))};
+
+         if(crc16(recPtr + _recHdrLen, srQty, crc16(recPtr, 6)) == recCrc){
+            memcpy(imgPtr, recPtr + _recHdrLen, srQty);
+            result = true;
+         }
+      }
+   }
+
+   return result;
+}
+
+uint16_t SRGXStateStore::encodeRec(const uint8_t* imgPtr, const uint8_t &srQty, uint8_t* recPtr, const uint16_t &recSize){
+   uint16_t result{0};
+
+   if((imgPtr != nullptr) && (recPtr != nullptr) && (srQty > 0) && (getRecLen(srQty) <= recSize)){
+      memcpy(recPtr, "SRGS", 4);
+      *(recPtr + 4) = 1;   // Record format version
+      *(recPtr + 5) = srQty;
+      memcpy(recPtr + _recHdrLen, imgPtr, srQty);
+      const uint16_t recCrc{crc16(recPtr + _recHdrLen, srQty, crc16(recPtr, 6))};
+      *(recPtr + 6) = recCrc & 0xFF;
+      *(recPtr + 7) = recCrc >> 8;
+      result = getRecLen(srQty);
+   }
+
+   return result;
+}
+
+uint16_t SRGXStateStore::getRecLen(const uint8_t &srQty){
+
+   return _recHdrLen + srQty;
+}
+
+uint32_t SRGXStateStore::getSavesQty(){
+
+   return _savesQty;
+}
+
+bool SRGXStateStore::load(uint8_t* imgPtr, const uint8_t &srQty){
+   uint8_t rec[_recHdrLen + 255];
+   bool result{false};
+
+   if((imgPtr != nullptr) && (srQty > 0)){
+      if(_readRec(rec, getRecLen(srQty)))
+         result = decodeRec(rec, getRecLen(srQty), imgPtr, srQty);
+   }
+
+   return result;
+}
+
+bool SRGXStateStore::save(const uint8_t* imgPtr, const uint8_t &srQty){
+   uint8_t rec[_recHdrLen + 255];
+   bool result{false};
+   const uint16_t recLen{encodeRec(imgPtr, srQty, rec, sizeof(rec))};
+
+   if(recLen > 0){
+      if(_writeRec(rec, recLen)){
+         _savesQty++;
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+SRGXFileStateStore::SRGXFileStateStore(const char* path)
+{
+   if(path != nullptr)
+      strncpy(_path, path, _maxPathLen);
+}
+
+bool SRGXFileStateStore::_readRec(uint8_t* recPtr, const uint16_t &recLen){
+   bool result{false};
+   FILE* filePtr{fopen(_path, "rb")};
+
+   if(filePtr != nullptr){
+      if(fread(recPtr, 1, recLen, filePtr) == recLen)
+         result = (fgetc(filePtr) == EOF);   // A longer file holds a record for a different chain
+      fclose(filePtr);
+   }
+
+   return result;
+}
+
+bool SRGXFileStateStore::_writeRec(const uint8_t* recPtr, const uint16_t &recLen){
+   bool result{false};
+   FILE* filePtr{fopen(_path, "wb")};
+
+   if(filePtr != nullptr){
+      result = (fwrite(recPtr, 1, recLen, filePtr) == recLen);
+      if(fclose(filePtr) != 0)
+         result = false;
+   }
+
+   return result;
+}
+
+#if defined(ESP_PLATFORM)
+//=========================================================================> Class methods delimiter
+
+static const uint16_t _rtcRecSize{8 + 64};
+RTC_NOINIT_ATTR static uint8_t _rtcRec[_rtcRecSize];  // Not initialized at startup, keeps the record through the resets
+
+SRGXRtcStateStore::SRGXRtcStateStore()
+{
+}
+
+bool SRGXRtcStateStore::_readRec(uint8_t* recPtr, const uint16_t &recLen){
+   bool result{false};
+
+   if(recLen <= _rtcRecSize){
+      memcpy(recPtr, _rtcRec, recLen);
+      result = true; // The contents are validated by the record CRC, the area holds garbage after a power-up
+   }
+
+   return result;
+}
+
+bool SRGXRtcStateStore::_writeRec(const uint8_t* recPtr, const uint16_t &recLen){
+   bool result{false};
+
+   if(recLen <= _rtcRecSize){
+      memcpy(_rtcRec, recPtr, recLen);
+      result = true;
+   }
+
+   return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+SRGXNvsStateStore::SRGXNvsStateStore(const char* nmspc, const char* key)
+:_nmspc{nmspc}, _key{key}
+{
+}
+
+bool SRGXNvsStateStore::_readRec(uint8_t* recPtr, const uint16_t &recLen){
+   Preferences prfrncs;
+   bool result{false};
+
+   if(prfrncs.begin(_nmspc, true)){
+      if(prfrncs.getBytesLength(_key) == recLen)
+         result = (prfrncs.getBytes(_key, recPtr, recLen) == recLen);
+      prfrncs.end();
+   }
+
+   return result;
+}
+
+bool SRGXNvsStateStore::_writeRec(const uint8_t* recPtr, const uint16_t &recLen){
+   Preferences prfrncs;
+   bool result{false};
+
+   if(prfrncs.begin(_nmspc, false)){
+      result = (prfrncs.putBytes(_key, recPtr, recLen) == recLen);
+      prfrncs.end();
+   }
+
+   return result;
+}
+#endif
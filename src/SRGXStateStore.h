@@ -0,0 +1,226 @@
+/**
+ ******************************************************************************
+ * @file SRGXStateStore.h
+ * @brief Header file for the SRGXStateStore classes, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The classes model the non-volatile stores a ShiftRegGPIOXpander object persists it's latched image to, so the outputs are restored in a single flush by ShiftRegGPIOXpander::begin(uint8_t*) after a reset. The SRGXStateStore base class and the file backed store have no dependencies on the Arduino framework nor the FreeRTOS kernel, so the records encoding, decoding and the restore logic might be verified on a host computer. The RTC memory and NVS backed stores are available in the ESP-IDF based builds only.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXSTATESTORE_H_
+#define _SRGXSTATESTORE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(ESP_PLATFORM)
+   #include <Preferences.h>
+#endif
+
+/**
+ * @brief An abstract class that models a non-volatile store for the latched image of a ShiftRegGPIOXpander object.
+ *
+ * The image is kept as a single record formatted as [signature "SRGS"] [version] [srQty] [CRC16] [image], where the CRC16 (CCITT, 0xFFFF initial value, little endian) covers the six header bytes preceding it and the image. A record interrupted while written -i.e. by a brown-out reset-, written by a different version, or for a chain of a different length is not loaded, so the ShiftRegGPIOXpander object falls back to it's initial contents.
+ *
+ * The derived classes provide the raw record reading and writing, see _readRec(uint8_t*, const uint16_t&) and _writeRec(const uint8_t*, const uint16_t&).
+ *
+ * @class SRGXStateStore
+ */
+class SRGXStateStore{
+protected:
+   static const uint16_t _recHdrLen{8};
+   uint32_t _savesQty{0};
+
+   /**
+    * @brief Reads the raw record from the store.
+    *
+    * @param recPtr Pointer to the memory area where the record is read to.
+    * @param recLen Length of the record expected.
+    *
+    * @retval true The store holds a record of recLen bytes, and it was read.
+    * @retval false The store is empty, holds a record of a different length, or could not be read.
+    */
+   virtual bool _readRec(uint8_t* recPtr, const uint16_t &recLen) = 0;
+   /**
+    * @brief Writes the raw record to the store, replacing the one held.
+    *
+    * @param recPtr Pointer to the record.
+    * @param recLen Length of the record.
+    *
+    * @retval true The record was written.
+    * @retval false The record could not be written.
+    */
+   virtual bool _writeRec(const uint8_t* recPtr, const uint16_t &recLen) = 0;
+
+public:
+   /**
+    * @brief Class constructor
+    */
+   SRGXStateStore();
+   /**
+    * @brief Class destructor
+    */
+   virtual ~SRGXStateStore();
+   /**
+    * @brief Calculates the CRC16 of a memory area.
+    *
+    * @param dataPtr Pointer to the memory area.
+    * @param dataLen Length of the memory area.
+    * @param crc Optional parameter. Initial value of the CRC, or the CRC of the preceding areas to chain the calculation (default 0xFFFF).
+    *
+    * @return The CCITT CRC16 (0x1021 polynomial) of the memory area.
+    */
+   static uint16_t crc16(const uint8_t* dataPtr, const uint16_t &dataLen, uint16_t crc = 0xFFFF);
+   /**
+    * @brief Decodes a record, extracting the image it holds.
+    *
+    * @param recPtr Pointer to the record.
+    * @param recLen Length of the record.
+    * @param imgPtr Pointer to the memory area where the image is copied to, srQty bytes long.
+    * @param srQty Number of shift registers of the chain the image is expected for.
+    *
+    * @retval true The record is valid for a chain of srQty shift registers, and the image was copied to imgPtr.
+    * @retval false The record is not valid, imgPtr was not modified.
+    */
+   static bool decodeRec(const uint8_t* recPtr, const uint16_t &recLen, uint8_t* imgPtr, const uint8_t &srQty);
+   /**
+    * @brief Encodes an image into a record.
+    *
+    * @param imgPtr Pointer to the image, srQty bytes long.
+    * @param srQty Number of shift registers of the chain.
+    * @param recPtr Pointer to the memory area where the record is built.
+    * @param recSize Size of the memory area pointed by recPtr.
+    *
+    * @return The length of the record built, or 0 if the parameters were not valid or the record does not fit in recSize bytes.
+    */
+   static uint16_t encodeRec(const uint8_t* imgPtr, const uint8_t &srQty, uint8_t* recPtr, const uint16_t &recSize);
+   /**
+    * @brief Returns the length of the record for a chain of srQty shift registers.
+    */
+   static uint16_t getRecLen(const uint8_t &srQty);
+   /**
+    * @brief Returns the quantity of records successfully written to the store by this object.
+    *
+    * The value might be used to verify the writes coalescing, as each write wears the flash based stores.
+    */
+   uint32_t getSavesQty();
+   /**
+    * @brief Loads the image held by the store.
+    *
+    * @param imgPtr Pointer to the memory area where the image is copied to, srQty bytes long.
+    * @param srQty Number of shift registers of the chain.
+    *
+    * @retval true A valid record for a chain of srQty shift registers was read, and the image was copied to imgPtr.
+    * @retval false The store holds no valid record, imgPtr was not modified.
+    */
+   bool load(uint8_t* imgPtr, const uint8_t &srQty);
+   /**
+    * @brief Saves an image to the store.
+    *
+    * @param imgPtr Pointer to the image, srQty bytes long.
+    * @param srQty Number of shift registers of the chain.
+    *
+    * @retval true The image was saved.
+    * @retval false The parameters were not valid or the record could not be written.
+    */
+   bool save(const uint8_t* imgPtr, const uint8_t &srQty);
+};
+
+//=========================================================================> Class methods delimiter
+
+/**
+ * @brief A class that models a SRGXStateStore kept in a file.
+ *
+ * The file is accessed through the C standard library streams, so the store might be used on a host computer to verify the restore logic, or in the ESP32 with any file system mounted in the VFS (i.e. SPIFFS, LittleFS or FAT), with the path including the mounting point.
+ *
+ * @class SRGXFileStateStore
+ */
+class SRGXFileStateStore: public SRGXStateStore{
+protected:
+   static const uint8_t _maxPathLen{64};
+   char _path[_maxPathLen + 1]{};
+
+   bool _readRec(uint8_t* recPtr, const uint16_t &recLen) override;
+   bool _writeRec(const uint8_t* recPtr, const uint16_t &recLen) override;
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param path Path of the file holding the record, up to 64 characters long, longer paths are truncated.
+    */
+   SRGXFileStateStore(const char* path);
+};
+
+#if defined(ESP_PLATFORM)
+//=========================================================================> Class methods delimiter
+
+/**
+ * @brief A class that models a SRGXStateStore kept in the RTC slow memory.
+ *
+ * The record is kept in a RTC memory area not initialized at startup, so it survives the software, watchdog, brown-out and deep sleep resets, but not the power cycles. The memory is not worn by the writes, so no writes coalescing is needed.
+ *
+ * @note The RTC memory area is unique, a single SRGXRtcStateStore object might be used at a time, for chains of up to 64 shift registers.
+ *
+ * @class SRGXRtcStateStore
+ */
+class SRGXRtcStateStore: public SRGXStateStore{
+protected:
+   bool _readRec(uint8_t* recPtr, const uint16_t &recLen) override;
+   bool _writeRec(const uint8_t* recPtr, const uint16_t &recLen) override;
+
+public:
+   /**
+    * @brief Class constructor
+    */
+   SRGXRtcStateStore();
+};
+
+//=========================================================================> Class methods delimiter
+
+/**
+ * @brief A class that models a SRGXStateStore kept in the NVS (Non Volatile Storage) flash partition.
+ *
+ * The record survives any reset and the power cycles. Each write wears the flash, so the ShiftRegGPIOXpander object should coalesce the writes, see ShiftRegGPIOXpander::setStateStore(SRGXStateStore*, const uint32_t&).
+ *
+ * @class SRGXNvsStateStore
+ */
+class SRGXNvsStateStore: public SRGXStateStore{
+protected:
+   const char* _nmspc;
+   const char* _key;
+
+   bool _readRec(uint8_t* recPtr, const uint16_t &recLen) override;
+   bool _writeRec(const uint8_t* recPtr, const uint16_t &recLen) override;
+
+public:
+   /**
+    * @brief Class constructor
+    *
+    * @param nmspc Optional parameter. NVS namespace the record is kept in, up to 15 characters long (default "srgx").
+    * @param key Optional parameter. NVS key of the record, up to 15 characters long (default "state").
+    *
+    * @attention The strings are not copied, they must remain valid for the object's lifetime (i.e. string literals).
+    */
+   SRGXNvsStateStore(const char* nmspc = "srgx", const char* key = "state");
+};
+#endif
+
+#endif //_SRGXSTATESTORE_H_
@@ -0,0 +1,428 @@
+/**
+ ******************************************************************************
+ * @file SRGXStepperEng.cpp
+ * @brief Code file for the SRGXStepperEng class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+ */
+#include <Arduino.h>
+#include <SRGXStepperEng.h>
+
+// Stepping sequences phases patterns, bit 0 = phase A ... bit 3 = phase D
+static const uint8_t _waveStepTbl[4]{0x01, 0x02, 0x04, 0x08};
+static const uint8_t _fullStepTbl[4]{0x03, 0x06, 0x0C, 0x09};
+static const uint8_t _halfStepTbl[8]{0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x09};
+
+SRGXStepperEng::SRGXStepperEng()
+{
+}
+
+SRGXStepperEng::SRGXStepperEng(ShiftRegGPIOXpander* SRGXPtr)
+:_SRGXPtr{SRGXPtr}
+{
+   if(_SRGXPtr != nullptr){
+      _motorsPinsMskPtr = new uint8_t[_SRGXPtr->getSrQty()]{};
+      _tickMskPtr = new uint8_t[_SRGXPtr->getSrQty()]{};
+      _tickValsPtr = new uint8_t[_SRGXPtr->getSrQty()]{};
+   }
+}
+
+SRGXStepperEng::~SRGXStepperEng(){
+   end();
+   if(_SRGXPtr != nullptr){
+      for(uint8_t motorInc{0}; motorInc < _motorsQty; motorInc++)
+         releaseMotor(motorInc);
+      _SRGXPtr->_releasePins(_motorsPinsMskPtr);
+   }
+   delete [] _motorsPinsMskPtr;
+   delete [] _tickMskPtr;
+   delete [] _tickValsPtr;
+}
+
+int8_t SRGXStepperEng::addMotor(const uint8_t &strtPin, const SRGXStepMode &stepMode){
+   int8_t result{-1};
+
+   if((_SRGXPtr != nullptr) && (_motorsQty < _maxMotorsQty) && ((strtPin + 3) <= _SRGXPtr->getMaxSRGXPin())){
+      uint8_t* motorMskPtr = new uint8_t[_SRGXPtr->getSrQty()]{};
+
+      for(uint8_t pinInc{0}; pinInc < 4; pinInc++)
+         *(motorMskPtr + ((strtPin + pinInc) / 8)) |= (1 << ((strtPin + pinInc) % 8));
+      if(_SRGXPtr->_reservePins(motorMskPtr)){
+         SRGXStepMotor &motor = _motors[_motorsQty];
+
+         for(uint8_t bffrIdx{0}; bffrIdx < _SRGXPtr->getSrQty(); bffrIdx++)
+            *(_motorsPinsMskPtr + bffrIdx) |= *(motorMskPtr + bffrIdx);
+         motor = SRGXStepMotor{};
+         motor.strtPin = strtPin;
+         motor.stepMode = stepMode;
+         motor.cMinUs = 1000000.0f / 100.0f;
+         motor.c0Us = motor.cMinUs;
+         taskENTER_CRITICAL(&_motorsMux);
+         result = _motorsQty++;  // The motor is visible to the engine task only once set
+         taskEXIT_CRITICAL(&_motorsMux);
+      }
+      delete [] motorMskPtr;
+   }
+
+   return result;
+}
+
+bool SRGXStepperEng::_advanceMotor(SRGXStepMotor &motor){
+   const uint8_t stepTblLen{static_cast<uint8_t>((motor.stepMode == stepHalf)?8:4)};
+   const int32_t stepDir{(motor.trgtPos > motor.curPos)?1:-1};
+   uint32_t stepsLeft{0};
+
+   motor.phaseIdx = (motor.phaseIdx + stepTblLen + stepDir) % stepTblLen;
+   motor.curPos += stepDir;
+
+   stepsLeft = (motor.trgtPos > motor.curPos)?(motor.trgtPos - motor.curPos):(motor.curPos - motor.trgtPos);
+   if(stepsLeft == 0){
+      motor.moving = false;
+      motor.decel = false;
+      motor.rampN = 0;
+   }
+   else{
+      if(!motor.decel && (motor.rampN > 0) && (stepsLeft <= motor.rampN))  // The steps left are the ones needed to decelerate to a stop
+         motor.decel = true;
+      if(motor.decel){
+         if(motor.rampN > 0){ // Inverse of the acceleration step, walking the ramp back down
+            motor.cnUs = motor.cnUs * ((4.0f * motor.rampN) + 1) / ((4.0f * motor.rampN) - 1);
+            motor.rampN--;
+         }
+      }
+      else if(motor.cnUs > motor.cMinUs){
+         motor.rampN++;
+         motor.cnUs = motor.cnUs * ((4.0f * motor.rampN) - 1) / ((4.0f * motor.rampN) + 1);  // cn = cn-1 - (2 * cn-1 / (4n + 1))
+         if(motor.cnUs < motor.cMinUs)
+            motor.cnUs = motor.cMinUs;
+      }
+      motor.tmToStepUs += motor.cnUs;
+   }
+
+   return true;
+}
+
+bool SRGXStepperEng::begin(const uint32_t &tickUs){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && !_running && (tickUs >= 50)){
+      const esp_timer_create_args_t tickTmrArgs{
+         .callback = &SRGXStepperEng::_tickTmrCb,
+         .arg = this,
+         .dispatch_method = ESP_TIMER_TASK,
+         .name = "SRGXStepperTmr",
+         .skip_unhandled_events = true
+      };
+
+      _tickUs = tickUs;
+      taskENTER_CRITICAL(&_motorsMux);
+      for(uint8_t motorInc{0}; motorInc < _motorsQty; motorInc++){ // The speeds set above the tick rate are capped to a step per tick
+         if(_motors[motorInc].cMinUs < _tickUs)
+            _motors[motorInc].cMinUs = _tickUs;
+         if(_motors[motorInc].c0Us < _tickUs)
+            _motors[motorInc].c0Us = _tickUs;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+      if(xTaskCreate(_engTsk, "SRGXStepperTsk", 2048, this, _engTskPrrty, &_engTskHndl) == pdPASS){
+         if(esp_timer_create(&tickTmrArgs, &_tickTmrHndl) == ESP_OK){
+            if(esp_timer_start_periodic(_tickTmrHndl, _tickUs) == ESP_OK){
+               _running = true;
+               result = true;
+            }
+         }
+      }
+      else
+         _engTskHndl = nullptr;
+      if(!result)
+         _releaseEngRsrcs();
+   }
+
+   return result;
+}
+
+bool SRGXStepperEng::end(){
+   bool result{false};
+
+   if(_running){
+      _releaseEngRsrcs();
+      taskENTER_CRITICAL(&_motorsMux);
+      for(uint8_t motorInc{0}; motorInc < _motorsQty; motorInc++){
+         _motors[motorInc].moving = false;
+         _motors[motorInc].trgtPos = _motors[motorInc].curPos;
+         _motors[motorInc].cmdSeq++;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+      result = true;
+   }
+
+   return result;
+}
+
+void SRGXStepperEng::_engTsk(void* argp){
+   SRGXStepperEng* engPtr = static_cast<SRGXStepperEng*>(argp);
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      if(engPtr->_tickTmrHndl == nullptr)   // The engine is being stopped, the task is not blocked at a Main Buffer operation so it's safe to end it here
+         break;
+      engPtr->_processTick();
+   }
+   engPtr->_engTskHndl = nullptr;
+   vTaskDelete(NULL);
+}
+
+int32_t SRGXStepperEng::getCurPos(const uint8_t &motor){
+   int32_t result{0};
+
+   if(motor < _motorsQty){
+      taskENTER_CRITICAL(&_motorsMux);
+      result = _motors[motor].curPos;
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+uint8_t SRGXStepperEng::getMotorsQty(){
+
+   return _motorsQty;
+}
+
+bool SRGXStepperEng::isMoving(const uint8_t &motor){
+   bool result{false};
+
+   if(motor < _motorsQty){
+      taskENTER_CRITICAL(&_motorsMux);
+      result = _motors[motor].moving;
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+void SRGXStepperEng::_mergePhases(const SRGXStepMotor &motor){
+   const uint8_t* stepTblPtr{(motor.stepMode == stepHalf)?_halfStepTbl:((motor.stepMode == stepWave)?_waveStepTbl:_fullStepTbl)};
+   const uint8_t phasesVal{stepTblPtr[motor.phaseIdx]};
+
+   for(uint8_t pinInc{0}; pinInc < 4; pinInc++){
+      const uint8_t srPin = motor.strtPin + pinInc;
+
+      *(_tickMskPtr + (srPin / 8)) |= (1 << (srPin % 8));
+      if((phasesVal >> pinInc) & 0x01)
+         *(_tickValsPtr + (srPin / 8)) |= (1 << (srPin % 8));
+      else
+         *(_tickValsPtr + (srPin / 8)) &= ~(1 << (srPin % 8));
+   }
+
+   return;
+}
+
+bool SRGXStepperEng::move(const uint8_t &motor, const int32_t &relSteps){
+   bool result{false};
+
+   if(motor < _motorsQty)
+      result = moveTo(motor, getCurPos(motor) + relSteps);
+
+   return result;
+}
+
+bool SRGXStepperEng::moveTo(const uint8_t &motor, const int32_t &trgtPos){
+   bool result{false};
+
+   if(motor < _motorsQty){
+      taskENTER_CRITICAL(&_motorsMux);
+      if(!_motors[motor].moving){
+         _motors[motor].trgtPos = trgtPos;
+         if(trgtPos != _motors[motor].curPos){
+            _motors[motor].decel = false;
+            _motors[motor].rampN = 0;
+            _motors[motor].cnUs = _motors[motor].c0Us;
+            _motors[motor].tmToStepUs = 0;   // The first step is taken on the next tick
+            _motors[motor].moving = true;
+         }
+         _motors[motor].cmdSeq++;
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+void SRGXStepperEng::_processTick(){
+   bool stpdMotors[_maxMotorsQty]{};
+   bool stepped{false};
+   uint8_t motorsQty{0};
+
+   memset(_tickMskPtr, 0x00, _SRGXPtr->getSrQty());
+   taskENTER_CRITICAL(&_motorsMux);   // Only the state snapshot and the commit are done in the critical section, the profiles are calculated outside it
+   motorsQty = _motorsQty;
+   memcpy(_motorsWrk, _motors, motorsQty * sizeof(SRGXStepMotor));
+   taskEXIT_CRITICAL(&_motorsMux);
+
+   for(uint8_t motorInc{0}; motorInc < motorsQty; motorInc++){
+      SRGXStepMotor &motor = _motorsWrk[motorInc];
+
+      if(motor.moving){
+         motor.tmToStepUs -= _tickUs;
+         if(motor.tmToStepUs <= 0)
+            stpdMotors[motorInc] = _advanceMotor(motor);
+      }
+   }
+
+   taskENTER_CRITICAL(&_motorsMux);
+   for(uint8_t motorInc{0}; motorInc < motorsQty; motorInc++){
+      if(_motors[motorInc].moving && (_motorsWrk[motorInc].cmdSeq == _motors[motorInc].cmdSeq))
+         _motors[motorInc] = _motorsWrk[motorInc];
+      else
+         stpdMotors[motorInc] = false;   // Modified by the API since the snapshot, the step is discarded and taken over from the new state on the next tick
+   }
+   taskEXIT_CRITICAL(&_motorsMux);
+
+   for(uint8_t motorInc{0}; motorInc < motorsQty; motorInc++){
+      if(stpdMotors[motorInc]){
+         _mergePhases(_motorsWrk[motorInc]);
+         stepped = true;
+      }
+   }
+   if(stepped){   // All the motors stepped in this tick are merged in a single Main Buffer update and flush
+      if(_SRGXPtr->_takeMainBffr(trcApiStepperEng)){
+         for(uint8_t bffrIdx{0}; bffrIdx < _SRGXPtr->getSrQty(); bffrIdx++){
+            if(*(_tickMskPtr + bffrIdx) != 0x00)
+               _SRGXPtr->_mainMskdWrt(bffrIdx, *(_tickMskPtr + bffrIdx), *(_tickValsPtr + bffrIdx));
+         }
+         _SRGXPtr->_giveMainBffr(true, trcApiStepperEng);
+      }
+   }
+
+   return;
+}
+
+bool SRGXStepperEng::releaseMotor(const uint8_t &motor){
+   bool result{false};
+
+   if((motor < _motorsQty) && !isMoving(motor)){
+      if(_SRGXPtr->_takeMainBffr(trcApiStepperEng)){
+         for(uint8_t pinInc{0}; pinInc < 4; pinInc++)
+            _SRGXPtr->_mainMskdWrt((_motors[motor].strtPin + pinInc) / 8, 1 << ((_motors[motor].strtPin + pinInc) % 8), 0x00);
+         _SRGXPtr->_giveMainBffr(true, trcApiStepperEng);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+void SRGXStepperEng::_releaseEngRsrcs(){
+   _running = false;
+   if(_tickTmrHndl != nullptr){
+      esp_timer_stop(_tickTmrHndl);
+      esp_timer_delete(_tickTmrHndl);
+      _tickTmrHndl = nullptr;
+   }
+   if(_engTskHndl != nullptr){
+      xTaskNotifyGive(_engTskHndl); // Wake the engine task so it ends itself
+      while(_engTskHndl != nullptr)
+         vTaskDelay(1);
+   }
+
+   return;
+}
+
+bool SRGXStepperEng::setCurPos(const uint8_t &motor, const int32_t &curPos){
+   bool result{false};
+
+   if(motor < _motorsQty){
+      taskENTER_CRITICAL(&_motorsMux);
+      if(!_motors[motor].moving){
+         _motors[motor].curPos = curPos;
+         _motors[motor].trgtPos = curPos;
+         _motors[motor].cmdSeq++;
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+bool SRGXStepperEng::setEngTskPrrty(const BaseType_t &engTskPrrty){
+   bool result{false};
+
+   if((engTskPrrty > 0) && (engTskPrrty < configMAX_PRIORITIES)){
+      _engTskPrrty = engTskPrrty;
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGXStepperEng::setSpeed(const uint8_t &motor, const float &maxSpeed, const float &accel){
+   bool result{false};
+
+   if((motor < _motorsQty) && (maxSpeed > 0.0f) && (accel >= 0.0f) && ((_tickUs == 0) || (maxSpeed <= (1000000.0f / _tickUs)))){   // A motor takes one step per tick at most
+      const float cMinUs{1000000.0f / maxSpeed};
+      float c0Us{cMinUs};
+
+      if(accel > 0.0f){
+         c0Us = 0.676f * sqrtf(2.0f / accel) * 1000000.0f;  // First step interval, corrected for the approximation error of the first step
+         if(c0Us < cMinUs)
+            c0Us = cMinUs;
+      }
+      taskENTER_CRITICAL(&_motorsMux);
+      if(!_motors[motor].moving){
+         _motors[motor].cMinUs = cMinUs;
+         _motors[motor].c0Us = c0Us;
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+bool SRGXStepperEng::stop(const uint8_t &motor){
+   bool result{false};
+
+   if(motor < _motorsQty){
+      taskENTER_CRITICAL(&_motorsMux);
+      if(_motors[motor].moving){
+         if(_motors[motor].rampN == 0){   // Constant speed, or still at the first step: stop right here
+            _motors[motor].trgtPos = _motors[motor].curPos;
+            _motors[motor].moving = false;
+         }
+         else if(!_motors[motor].decel){  // The deceleration takes as many steps as the acceleration took
+            _motors[motor].trgtPos = _motors[motor].curPos + ((_motors[motor].trgtPos > _motors[motor].curPos)?1:-1) * static_cast<int32_t>(_motors[motor].rampN);
+         }
+         _motors[motor].cmdSeq++;
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_motorsMux);
+   }
+
+   return result;
+}
+
+void SRGXStepperEng::_tickTmrCb(void* argp){
+   SRGXStepperEng* engPtr = static_cast<SRGXStepperEng*>(argp);
+
+   if(engPtr->_engTskHndl != nullptr)
+      xTaskNotifyGive(engPtr->_engTskHndl);
+
+   return;
+}
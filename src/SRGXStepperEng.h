@@ -0,0 +1,254 @@
+/**
+ ******************************************************************************
+ * @file SRGXStepperEng.h
+ * @brief Header file for the SRGXStepperEng class, part of the ShiftRegGPIOXtender_ESP32 library
+ *
+ * @details The class provides a stepper motors engine for unipolar motors driven through ShiftRegGPIOXpander pins. The engine advances every motor whose step is due in a single timer tick, merges the phase patterns of all the motors stepped and flushes the Main Buffer once per tick.
+ *
+ * Repository: https://github.com/GabyGold67/ShiftRegGPIOXpander_ESP32
+ *
+ * Framework: Arduino
+ * Platform: ESP32
+ *
+ * @author Gabriel D. Goldman
+ * mail <gdgoldman67@hotmail.com>
+ * Github <https://github.com/GabyGold67>
+ *
+ * @version 3.1.0
+ *
+ * @date First release: 12/02/2025
+ *       Last update:   05/07/2025 17:30 (GMT+0200) DST
+ *
+ * @copyright Copyright (c) 2025  GPL-3.0 license
+ *******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+ *******************************************************************************
+ */
+#ifndef _SRGXSTEPPERENG_H_
+#define _SRGXSTEPPERENG_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <esp_timer.h>
+#include <ShiftRegGPIOXpander_ESP32.h>
+
+/**
+ * @brief Stepping sequences for the unipolar motors
+ */
+enum SRGXStepMode : uint8_t{
+   stepWave,   // One phase energized at a time, 4 steps per cycle
+   stepFull,   // Two phases energized at a time, 4 steps per cycle, more torque
+   stepHalf // One and two phases energized alternately, 8 steps per cycle, double resolution
+};
+
+/**
+ * @brief State of each motor handled by a SRGXStepperEng object.
+ *
+ * @struct SRGXStepMotor
+ */
+struct SRGXStepMotor{
+   uint8_t strtPin;  // First of the 4 consecutive ShiftRegGPIOXpander pins driving the motor phases A, B, C, D
+   SRGXStepMode stepMode;
+   uint8_t phaseIdx; // Position in the stepping sequence table
+   bool moving;
+   bool decel; // The deceleration ramp is in progress
+   int32_t curPos;
+   int32_t trgtPos;
+   uint32_t rampN;   // Steps taken in the acceleration ramp
+   float c0Us; // First step interval, as set by the acceleration
+   float cMinUs;  // Minimum step interval, as set by the maximum speed
+   float cnUs; // Current step interval
+   float tmToStepUs; // Time left to the next step
+   uint32_t cmdSeq;  // Count of the API modifications, a step calculated by the engine over an older state is discarded
+};
+
+/**
+ * @brief A class that models a stepper motors engine over a ShiftRegGPIOXpander object.
+ *
+ * Each unipolar motor is driven by 4 consecutive ShiftRegGPIOXpander pins -phases A to D- through the usual darlington or MOSFET drivers. The pins are reserved for the engine when the motor is added -see SRGXVPort::reservePins()- so they are not overwritten by exclusive SRGXVPort objects nor by Auxiliary Buffer moves.
+ *
+ * The engine runs on a fixed tick driven by an esp_timer periodic timer (hardware timer based), whose callback wakes a dedicated engine task. On each tick every moving motor whose step is due advances one step of it's stepping sequence, the phase patterns of all the motors stepped are merged into the Main Buffer under a single Main Buffer mutex taking, and the Main Buffer is flushed once. Ticks with no step due produce no flushing.
+ *
+ * The acceleration profiles are trapezoidal, computed incrementally: each step interval is calculated from the previous one with a single division (D. Austin's "Generate stepper-motor speed profiles in real time" approximation), so no profile tables are needed.
+ *
+ * @class SRGXStepperEng
+ */
+class SRGXStepperEng{
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   static const uint8_t _maxMotorsQty{16};
+   SRGXStepMotor _motors[_maxMotorsQty]{};
+   SRGXStepMotor _motorsWrk[_maxMotorsQty]{}; // Motors state snapshot the engine task calculates the tick steps on, out of the critical section
+   uint8_t _motorsQty{0};
+   portMUX_TYPE _motorsMux = portMUX_INITIALIZER_UNLOCKED;  // Spinlock protecting the motors state, shared by the engine task and the API
+   uint8_t* _motorsPinsMskPtr{nullptr};   // Main Buffer sized mask of the pins reserved by the engine motors
+   uint8_t* _tickMskPtr{nullptr};   // Main Buffer sized mask and values of the phases modified in the tick being processed
+   uint8_t* _tickValsPtr{nullptr};
+
+   bool _running{false};
+   uint32_t _tickUs{0};
+   esp_timer_handle_t _tickTmrHndl{nullptr};
+   TaskHandle_t _engTskHndl{nullptr};
+   BaseType_t _engTskPrrty{configMAX_PRIORITIES - 2};
+
+   bool _advanceMotor(SRGXStepMotor &motor);
+   static void _engTsk(void* argp);
+   void _mergePhases(const SRGXStepMotor &motor);
+   void _processTick();
+   void _releaseEngRsrcs();
+   static void _tickTmrCb(void* argp);
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   SRGXStepperEng();
+   /**
+    * @brief Class constructor
+    *
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object whose pins drive the motors. The object must be begun before adding motors.
+    */
+   SRGXStepperEng(ShiftRegGPIOXpander* SRGXPtr);
+   /**
+    * @brief Copy constructor, deleted.
+    *
+    * The object owns the timer, the engine task and the reserved pins, a copy would share them with the original object.
+    */
+   SRGXStepperEng(const SRGXStepperEng&) = delete;
+   /**
+    * @brief Class destructor
+    *
+    * Stops the engine, de-energizes every motor and releases the timer, the engine task and the reserved pins.
+    */
+   ~SRGXStepperEng();
+   /**
+    * @brief Copy assignment operator, deleted.
+    */
+   SRGXStepperEng& operator=(const SRGXStepperEng&) = delete;
+   /**
+    * @brief Adds a motor to the engine.
+    *
+    * The motor phases pins are reserved, and the motor is set at position 0, de-energized, with a 100 steps/s speed and no acceleration, see setSpeed(const uint8_t&, const float&, const float&).
+    *
+    * @param strtPin First of the 4 consecutive ShiftRegGPIOXpander pins driving the motor phases A, B, C and D.
+    * @param stepMode Optional parameter. Stepping sequence, see SRGXStepMode. stepFull if not provided.
+    *
+    * @return The index of the motor, to be used in the rest of the methods, or -1 if the pins were out of range or already reserved, or the maximum of 16 motors was reached.
+    */
+   int8_t addMotor(const uint8_t &strtPin, const SRGXStepMode &stepMode = stepFull);
+   /**
+    * @brief Starts the engine tick.
+    *
+    * @param tickUs Tick period, in microseconds. It's the time resolution of the steps, the maximum speed of every motor is limited to 1000000 / tickUs steps/s, the speeds set above it are capped to that value. The valid range is tickUs >= 50, the flush time -that depends on the quantity of shift registers- must be shorter than the tick period.
+    *
+    * @retval true The engine started.
+    * @retval false The object is not valid, the engine was already started, the tick was out of range, or the timer or the engine task could not be created.
+    */
+   bool begin(const uint32_t &tickUs);
+   /**
+    * @brief Stops the engine tick.
+    *
+    * The moving motors are stopped immediately, without deceleration, keeping their phases energized.
+    *
+    * @retval true The engine was stopped.
+    * @retval false The engine was not started.
+    */
+   bool end();
+   /**
+    * @brief Returns the current position of a motor, in steps.
+    *
+    * @param motor Index of the motor, as returned by addMotor(const uint8_t&, const SRGXStepMode&).
+    *
+    * @return The current position, or 0 if the motor index is not valid.
+    */
+   int32_t getCurPos(const uint8_t &motor);
+   /**
+    * @brief Returns the number of motors added to the engine.
+    */
+   uint8_t getMotorsQty();
+   /**
+    * @brief Returns the moving condition of a motor.
+    *
+    * @param motor Index of the motor.
+    *
+    * @retval true The motor is moving towards it's target position.
+    * @retval false The motor is stopped, or the motor index is not valid.
+    */
+   bool isMoving(const uint8_t &motor);
+   /**
+    * @brief Moves a motor a number of steps relative to it's current position.
+    *
+    * @param motor Index of the motor.
+    * @param relSteps Steps to move, positive values advance the stepping sequence, negative values reverse it.
+    *
+    * @retval true The movement was started.
+    * @retval false The motor index is not valid, or the motor is moving.
+    */
+   bool move(const uint8_t &motor, const int32_t &relSteps);
+   /**
+    * @brief Moves a motor to an absolute position.
+    *
+    * The movement follows a trapezoidal profile: the motor accelerates up to the maximum speed, and decelerates to stop at the target position, see setSpeed(const uint8_t&, const float&, const float&).
+    *
+    * @param motor Index of the motor.
+    * @param trgtPos Target position, in steps.
+    *
+    * @retval true The movement was started, or the motor was already at the target position.
+    * @retval false The motor index is not valid, or the motor is moving.
+    */
+   bool moveTo(const uint8_t &motor, const int32_t &trgtPos);
+   /**
+    * @brief De-energizes the phases of a stopped motor.
+    *
+    * @param motor Index of the motor.
+    *
+    * @retval true The motor phases were de-energized.
+    * @retval false The motor index is not valid, or the motor is moving.
+    *
+    * @note The motor keeps it's position and stepping sequence position, the next movement energizes the phases again.
+    */
+   bool releaseMotor(const uint8_t &motor);
+   /**
+    * @brief Sets the current position of a stopped motor, without moving it.
+    *
+    * @param motor Index of the motor.
+    * @param curPos New current position, in steps.
+    *
+    * @retval true The position was set.
+    * @retval false The motor index is not valid, or the motor is moving.
+    */
+   bool setCurPos(const uint8_t &motor, const int32_t &curPos);
+   /**
+    * @brief Sets the priority of the engine task.
+    *
+    * @param engTskPrrty The priority of the task created to process the ticks. The default value is (configMAX_PRIORITIES - 2).
+    *
+    * @retval true The priority was set, it will take effect the next time begin() is invoked.
+    * @retval false The priority was out of the valid range.
+    */
+   bool setEngTskPrrty(const BaseType_t &engTskPrrty);
+   /**
+    * @brief Sets the speed profile of a motor.
+    *
+    * @param motor Index of the motor.
+    * @param maxSpeed Maximum speed, in steps/s. The valid range is 0 < maxSpeed <= 1000000 / tickUs, as a motor takes one step per tick at most. Before the first begin() the tick is unknown and any maxSpeed > 0 is accepted, begin() then caps it to the tick rate.
+    * @param accel Optional parameter. Acceleration and deceleration, in steps/s^2, 0 (default) for movements at constant maxSpeed.
+    *
+    * @retval true The speed profile was set, it will take effect on the next movement.
+    * @retval false The motor index is not valid, the parameters were out of range, or the motor is moving.
+    */
+   bool setSpeed(const uint8_t &motor, const float &maxSpeed, const float &accel = 0.0);
+   /**
+    * @brief Stops a moving motor as soon as possible.
+    *
+    * If the motor has an acceleration set, the deceleration ramp starts immediately, and the target position is modified accordingly. Otherwise the motor stops at it's current position.
+    *
+    * @param motor Index of the motor.
+    *
+    * @retval true The motor is stopping.
+    * @retval false The motor index is not valid, or the motor was not moving.
+    */
+   bool stop(const uint8_t &motor);
+};
+
+#endif //_SRGXSTEPPERENG_H_
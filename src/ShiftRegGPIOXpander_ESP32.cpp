@@ -41,32 +41,418 @@
  */
 #include <Arduino.h>
 #include <ShiftRegGPIOXpander_ESP32.h>
+#include <SRGXBus.h>
+#include <SRGXStateStore.h>
+#include <esp_rom_gpio.h>
+#include <hal/gpio_ll.h>
+#include <soc/gpio_sig_map.h>
+#include <soc/gpio_struct.h>
+#include <soc/ledc_periph.h>
+
+#if SRGX_IRAM_EN
+   #include <esp_heap_caps.h>
+   #include <esp_rom_sys.h>
+   // Flash resident Arduino GPIO and delay functions are replaced by inlined low level register accesses and ROM delays
+   #define SRGX_PIN_WRT(pin, lvl) gpio_ll_set_level(&GPIO, static_cast<gpio_num_t>(pin), (lvl))
+   #define SRGX_PIN_RD(pin) gpio_ll_get_level(&GPIO, static_cast<gpio_num_t>(pin))
+   #define SRGX_DLY_US(us) esp_rom_delay_us(us)
+#else
+   #define SRGX_PIN_WRT(pin, lvl) ::digitalWrite((pin), (lvl))
+   #define SRGX_PIN_RD(pin) ::digitalRead(pin)
+   #define SRGX_DLY_US(us) delayMicroseconds(us)
+#endif
+
+/*LEDC duty writing: the Arduino-ESP32 cores 3.x and later address the LEDC channels through the pin
+they are attached to.*/
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3)
+   #define SRGX_LEDC_WRT(pin, chnl, duty) ledcWrite((pin), (duty))
+#else
+   #define SRGX_LEDC_WRT(pin, chnl, duty) ledcWrite((chnl), (duty))
+#endif
+
+SRGXAsyncHndl::SRGXAsyncHndl()
+{
+}
+
+SRGXAsyncHndl::SRGXAsyncHndl(ShiftRegGPIOXpander* SRGXPtr, const uint32_t &wrtSeq)
+:_SRGXPtr{SRGXPtr}, _wrtSeq{wrtSeq}
+{
+}
+
+#if SRGX_CORO_EN
+bool SRGXAsyncHndl::await_ready() const noexcept{
+
+   return isDone();
+}
+
+bool SRGXAsyncHndl::await_resume() const noexcept{
+
+   return isDone();
+}
+
+bool SRGXAsyncHndl::await_suspend(std::coroutine_handle<> crtnHndl){
+   ShiftRegGPIOXpander* SRGXPtr{_SRGXPtr};   // Once the waiter is added the coroutine might be resumed -and this object destroyed- by the flushing task
+   const uint32_t wrtSeq{_wrtSeq};
+   bool result{false};
+
+   if((SRGXPtr != nullptr) && SRGXPtr->_addAsyncWtr(wrtSeq, nullptr, crtnHndl.address())){
+      result = true;
+      if(static_cast<int32_t>(__atomic_load_n(&SRGXPtr->_ltchdWrtSeq, __ATOMIC_SEQ_CST) - wrtSeq) >= 0)  // Latched while being added, the flushing task might have missed the waiter
+         result = !SRGXPtr->_rmvAsyncWtr(nullptr, crtnHndl.address()); // If it was not missed the flushing task resumes the coroutine
+   }
+
+   return result;
+}
+#endif
+
+bool SRGXAsyncHndl::isDone() const{
+   bool result{false};
+
+   if(_SRGXPtr != nullptr)
+      result = static_cast<int32_t>(__atomic_load_n(&_SRGXPtr->_ltchdWrtSeq, __ATOMIC_SEQ_CST) - _wrtSeq) >= 0;
+
+   return result;
+}
+
+bool SRGXAsyncHndl::isValid() const{
+
+   return (_SRGXPtr != nullptr);
+}
+
+bool SRGXAsyncHndl::wait(const TickType_t &tmOut){
+   bool result{false};
+
+   if(_SRGXPtr != nullptr){
+      const TickType_t strtTm{xTaskGetTickCount()};
+      TaskHandle_t curTskHndl{xTaskGetCurrentTaskHandle()};
+      bool wtrAdded{false};
+
+      result = isDone();
+      while(!result && ((xTaskGetTickCount() - strtTm) < tmOut)){
+         if(!wtrAdded)
+            wtrAdded = _SRGXPtr->_addAsyncWtr(_wrtSeq, curTskHndl, nullptr);
+         if(!wtrAdded)
+            vTaskDelay(1); // The waiters list is full, poll
+         else if(!isDone())   // Checked after adding the waiter, a latch done before it was added would not be notified
+            ulTaskNotifyTake(pdTRUE, tmOut - (xTaskGetTickCount() - strtTm));
+         result = isDone();
+      }
+      if(wtrAdded)
+         _SRGXPtr->_rmvAsyncWtr(curTskHndl, nullptr);   // Still listed if the time was out, or if the write was latched before the flushing task processed the waiter
+   }
+
+   return result;
+}
+
+//=========================================================================> Class methods delimiter
 
 ShiftRegGPIOXpander::ShiftRegGPIOXpander()
 {
 }
 
 ShiftRegGPIOXpander::ShiftRegGPIOXpander(uint8_t ds, uint8_t sh_cp, uint8_t st_cp, uint8_t srQty)
-:_ds{ds}, _sh_cp{sh_cp}, _st_cp{st_cp}, _srQty{srQty}, _mainBuffrArryPtr {new uint8_t [srQty]}
+:_ds{ds}, _sh_cp{sh_cp}, _st_cp{st_cp}, _srQty{srQty}
 {
    _maxSRGXPin = (_srQty * 8) - 1;
+   _mainBuffrArryPtr = _allocBffr(_srQty);  // Allocated as 32-bits words to allow atomic masked operations over the Main Buffer, see _mainMskdWrt()
+   _pinOwnrshpPtr = new uint8_t [_srQty]{};
 }
 
 ShiftRegGPIOXpander::~ShiftRegGPIOXpander(){
    end();
-   if(_auxBuffrArryPtr !=nullptr){
-      delete [] _auxBuffrArryPtr;
-      _auxBuffrArryPtr = nullptr;
+   _freeBffr(_auxBuffrArryPtr);
+   _freeBffr(_mainBuffrArryPtr);
+   if(_pinOwnrshpPtr !=nullptr){
+      delete [] _pinOwnrshpPtr;
+      _pinOwnrshpPtr = nullptr;
+   }
+   if(_inBffrArryPtr !=nullptr){
+      delete [] _inBffrArryPtr;
+      _inBffrArryPtr = nullptr;
+   }
+   if(_asyncWtrsPtr !=nullptr){
+      delete [] _asyncWtrsPtr;
+      _asyncWtrsPtr = nullptr;
+   }
+   if(_asyncWrtsSeqPtr !=nullptr){
+      delete [] _asyncWrtsSeqPtr;
+      _asyncWrtsSeqPtr = nullptr;
+   }
+   if(_asyncWrtsMskPtr !=nullptr){
+      delete [] _asyncWrtsMskPtr;
+      _asyncWrtsMskPtr = nullptr;
+   }
+   if(_asyncWrtsValsPtr !=nullptr){
+      delete [] _asyncWrtsValsPtr;
+      _asyncWrtsValsPtr = nullptr;
+   }
+   if(_inStgBffrPtr !=nullptr){
+      delete [] _inStgBffrPtr;
+      _inStgBffrPtr = nullptr;
+   }
+   if(_rmpRegsPtr !=nullptr){
+      delete [] _rmpRegsPtr;
+      _rmpRegsPtr = nullptr;
+   }
+   if(_physImgPtr !=nullptr){
+      delete [] _physImgPtr;
+      _physImgPtr = nullptr;
+   }
+   endTrace();
+   _freeBffr(_lgclPrvFrmPtr);
+   _freeBffr(_lgclCurFrmPtr);
+   _freeBffr(_ilckBrkFrmPtr);
+   if(_ilckMsksPtr !=nullptr){
+      delete [] _ilckMsksPtr;
+      _ilckMsksPtr = nullptr;
+   }
+   if(_lpbkExpPtr !=nullptr){
+      delete [] _lpbkExpPtr;
+      _lpbkExpPtr = nullptr;
+   }
+   if(_stSavedPtr !=nullptr){
+      delete [] _stSavedPtr;
+      _stSavedPtr = nullptr;
+   }
+   if(_stImgPtr !=nullptr){
+      delete [] _stImgPtr;
+      _stImgPtr = nullptr;
+   }
+   if(_snpshtSlotsPtr !=nullptr){
+      for(uint8_t slotIdx{0}; slotIdx < _snpshtsQty; slotIdx++)
+         _freeBffr(*(_snpshtSlotsPtr + slotIdx));
+      delete [] _snpshtSlotsPtr;
+      _snpshtSlotsPtr = nullptr;
+   }
+}
+
+bool ShiftRegGPIOXpander::addInterlock(const uint8_t* pinsPtr, const uint8_t &pinsQty, const uint32_t &deadTmUs){
+   bool result{false};
+
+   if((pinsPtr != nullptr) && (pinsQty > 1) && (deadTmUs <= _maxIlckDeadTmUs) && (_srQty > 0)){
+      const uint8_t wrdsQty{static_cast<uint8_t>((_srQty + 3) / 4)};
+      bool mainTkn{_SRGXMnBffrMtx == nullptr}; // Not begun, there's no flushing to synchronize with
+
+      if(!mainTkn)
+         mainTkn = (xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE);
+      if(mainTkn){
+         if(_ilcksQty < _maxIlcksQty){
+            if(_ilckMsksPtr == nullptr){
+               _ilckMsksPtr = new uint32_t [_maxIlcksQty * wrdsQty]{};
+               _ilckBrkFrmPtr = _allocBffr(_srQty);
+            }
+
+            uint8_t* ilckMskPtr{reinterpret_cast<uint8_t*>(_ilckMsksPtr + _ilcksQty * wrdsQty)}; // The group is not counted yet, so the flushes ignore it while built
+            uint8_t ilckPinsQty{0};
+            bool validLst{true};
+
+            memset(ilckMskPtr, 0x00, wrdsQty * sizeof(uint32_t));
+            for(uint8_t pinInc{0}; validLst && (pinInc < pinsQty); pinInc++){
+               const uint8_t srPin{*(pinsPtr + pinInc)};
+
+               if(srPin > _maxSRGXPin)
+                  validLst = false;
+               else if((*(ilckMskPtr + srPin / 8) & (0x01 << (srPin % 8))) == 0x00){  // Repeated pins are counted once
+                  *(ilckMskPtr + srPin / 8) |= 0x01 << (srPin % 8);
+                  ilckPinsQty++;
+               }
+            }
+            if(validLst && (ilckPinsQty > 1)){
+               _allocLgclFrms();
+               _ilckDeadTmUs[_ilcksQty] = deadTmUs;
+               _ilcksQty++;
+               result = true;
+            }
+         }
+         if(_SRGXMnBffrMtx != nullptr)
+            xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::addObserver(SRGXObsCb cb, void* argp){
+   bool result{false};
+
+   if(cb != nullptr){
+      taskENTER_CRITICAL(&_obsMux);
+      if(_obsRegsQty < _maxObsRegsQty){
+         result = true;
+         for(uint8_t obsInc{0}; result && (obsInc < _obsRegsQty); obsInc++){
+            if((_obsRegs[obsInc].cb == cb) && (_obsRegs[obsInc].argp == argp))
+               result = false;
+         }
+         if(result)
+            _obsRegs[_obsRegsQty++] = SRGXObsReg{cb, argp};
+      }
+      taskEXIT_CRITICAL(&_obsMux);
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::_addAsyncWtr(const uint32_t &wrtSeq, TaskHandle_t tskHndl, void* crtnAddr){
+   bool result{false};
+
+   if(_asyncWtrsPtr != nullptr){
+      taskENTER_CRITICAL(&_asyncMux);
+      if(_asyncWtrsQty < _maxAsyncWtrsQty){
+         *(_asyncWtrsPtr + _asyncWtrsQty) = SRGXAsyncWtr{wrtSeq, tskHndl, crtnAddr};
+         __atomic_store_n(&_asyncWtrsQty, _asyncWtrsQty + 1, __ATOMIC_SEQ_CST);
+         result = true;
+      }
+      taskEXIT_CRITICAL(&_asyncMux);
+   }
+
+   return result;
+}
+
+uint8_t* ShiftRegGPIOXpander::_allocBffr(const uint8_t &bytesQty){
+   uint8_t* result{nullptr};
+
+#if SRGX_IRAM_EN
+   result = static_cast<uint8_t*>(heap_caps_calloc((bytesQty + 3) / 4, sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT));
+#else
+   result = reinterpret_cast<uint8_t*>(new uint32_t [(bytesQty + 3) / 4]{});
+#endif
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_allocLgclFrms(){
+   if(_lgclCurFrmPtr == nullptr){
+      _lgclPrvFrmPtr = _allocBffr(_srQty);
+      memcpy(_lgclPrvFrmPtr, _mainBuffrArryPtr, _srQty); // The outputs are assumed to hold the Main Buffer contents flushed last
+      _lgclCurFrmPtr = _allocBffr(_srQty);
    }
-   if(_mainBuffrArryPtr !=nullptr){
-      delete [] _mainBuffrArryPtr;
-      _mainBuffrArryPtr = nullptr;
+
+   return;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_applyIlcks(uint32_t &deadTmUs){
+   const uint8_t wrdsQty{static_cast<uint8_t>((_srQty + 3) / 4)};
+   uint32_t* curFrmPtr{reinterpret_cast<uint32_t*>(_lgclCurFrmPtr)};
+   const uint32_t* prvFrmPtr{reinterpret_cast<const uint32_t*>(_lgclPrvFrmPtr)};
+   uint32_t* brkFrmPtr{reinterpret_cast<uint32_t*>(_ilckBrkFrmPtr)};
+   bool fltFound{false};
+   bool result{false};
+
+   deadTmUs = 0;
+   for(uint8_t ilckInc{0}; ilckInc < _ilcksQty; ilckInc++){ // Frames setting more than one pin of a group get the group pins reset
+      const uint32_t* ilckMskPtr{_ilckMsksPtr + ilckInc * wrdsQty};
+      uint16_t setQty{0};
+
+      for(uint8_t wrdInc{0}; wrdInc < wrdsQty; wrdInc++)
+         setQty += __builtin_popcount(*(curFrmPtr + wrdInc) & *(ilckMskPtr + wrdInc));
+      if(setQty > 1){
+         for(uint8_t wrdInc{0}; wrdInc < wrdsQty; wrdInc++)
+            *(curFrmPtr + wrdInc) &= ~*(ilckMskPtr + wrdInc);
+         fltFound = true;
+      }
+   }
+   memcpy(brkFrmPtr, curFrmPtr, wrdsQty * sizeof(uint32_t));
+   for(uint8_t ilckInc{0}; ilckInc < _ilcksQty; ilckInc++){ // A pin being set while other pin of the group is set in the outputs is kept reset in the break frame
+      const uint32_t* ilckMskPtr{_ilckMsksPtr + ilckInc * wrdsQty};
+      uint32_t risingBits{0};
+      uint32_t prvSetBits{0};
+
+      for(uint8_t wrdInc{0}; wrdInc < wrdsQty; wrdInc++){
+         risingBits |= *(curFrmPtr + wrdInc) & ~*(prvFrmPtr + wrdInc) & *(ilckMskPtr + wrdInc);
+         prvSetBits |= *(prvFrmPtr + wrdInc) & *(ilckMskPtr + wrdInc);
+      }
+      if((risingBits != 0) && (prvSetBits != 0)){  // The frame sets at most one pin of the group, so the pins set in the outputs are being reset
+         for(uint8_t wrdInc{0}; wrdInc < wrdsQty; wrdInc++)
+            *(brkFrmPtr + wrdInc) &= ~(*(curFrmPtr + wrdInc) & ~*(prvFrmPtr + wrdInc) & *(ilckMskPtr + wrdInc));
+         if(_ilckDeadTmUs[ilckInc] > deadTmUs)
+            deadTmUs = _ilckDeadTmUs[ilckInc];
+         result = true;
+      }
+   }
+   if(fltFound)
+      _ilckFltsQty++;
+   if(result)
+      _ilckBrksQty++;
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_applyAsyncWrts(){
+   if(_takeMainBffr(trcApiAsync))   // The writes queued are applied by the mutex taking, see _drainAsyncWrts()
+      _giveMainBffr(static_cast<int32_t>(_flshdWrtSeq - __atomic_load_n(&_lckFreeWrtSeq, __ATOMIC_ACQUIRE)) < 0, trcApiAsync);  // Flushed if not every write sequenced was included in a flush started
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::_applyPinsLst(const SRGXPinsLstOp &lstOp, const SRGXPinValue* itemsPtr, const uint8_t* pinsPtr, const size_t &itemsQty, const SRGXTrcApi &trcApi){
+   bool result{false};
+   bool validLst{(itemsQty > 0) && (_mainBuffrArryPtr != nullptr) && ((lstOp == _lstWrite)?(itemsPtr != nullptr):(pinsPtr != nullptr))};
+
+   for(size_t itemInc{0}; validLst && (itemInc < itemsQty); itemInc++){ // The whole list is validated before modifying any pin
+      const uint8_t srPin{(lstOp == _lstWrite)?(itemsPtr + itemInc)->pin:*(pinsPtr + itemInc)};
+
+      if((srPin > _maxSRGXPin) || isPinReserved(srPin))  // Pins reserved by other objects are not written
+         validLst = false;
+   }
+   if(validLst){
+      if(_takeMainBffr(trcApi)){
+         uint8_t bffrIdx{0};
+         uint8_t bffrMsk{0x00};
+         uint8_t bffrVals{0x00};
+         uint8_t bffrTggl{0x00};
+
+         for(size_t itemInc{0}; itemInc < itemsQty; itemInc++){
+            const uint8_t srPin{(lstOp == _lstWrite)?(itemsPtr + itemInc)->pin:*(pinsPtr + itemInc)};
+            const uint8_t pinMsk = 0x01 << (srPin % 8);
+
+            if(((srPin / 8) != bffrIdx) && ((bffrMsk | bffrTggl) != 0x00)){ // The item belongs to other register, write the merged register items
+               _mainMskdWrt(bffrIdx, bffrMsk, bffrVals, bffrTggl);
+               bffrMsk = 0x00;
+               bffrVals = 0x00;
+               bffrTggl = 0x00;
+            }
+            bffrIdx = srPin / 8;
+            if(lstOp == _lstToggle)
+               bffrTggl ^= pinMsk;
+            else{
+               bffrMsk |= pinMsk;
+               if((lstOp == _lstSet) || ((lstOp == _lstWrite) && ((itemsPtr + itemInc)->value)))
+                  bffrVals |= pinMsk;
+               else
+                  bffrVals &= ~pinMsk;
+            }
+         }
+         if((bffrMsk | bffrTggl) != 0x00)
+            _mainMskdWrt(bffrIdx, bffrMsk, bffrVals, bffrTggl);
+         _giveMainBffr(true, trcApi);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_asyncTsk(void* argp){
+   ShiftRegGPIOXpander* SRGXPtr = static_cast<ShiftRegGPIOXpander*>(argp);
+
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);  // The notifications pending are cleared, the writes requested meanwhile are coalesced in a single flush
+      if(SRGXPtr->_asyncTskEnd)
+         break;
+      SRGXPtr->_applyAsyncWrts();
+      SRGXPtr->_notifyAsyncWtrs();
    }
+   SRGXPtr->_asyncTskHndl = nullptr;
+   vTaskDelete(NULL);
 }
 
 bool ShiftRegGPIOXpander::begin(uint8_t* initCntnt){
    bool result{true};
 
+   if(_oe != 0xFF){  // The outputs are kept disabled until the first valid frame is latched
+      ::digitalWrite(_oe, HIGH);
+      pinMode(_oe, OUTPUT);
+   }
    ::digitalWrite(_sh_cp, HIGH);
    ::digitalWrite(_ds, LOW);
    ::digitalWrite(_st_cp, HIGH);
@@ -82,89 +468,261 @@ bool ShiftRegGPIOXpander::begin(uint8_t* initCntnt){
 
    if(result){
       if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(initCntnt != nullptr)
-            memcpy(_mainBuffrArryPtr, initCntnt, _srQty);
-         else
-            memset(_mainBuffrArryPtr,0x00, _srQty);
-         _sendAllSRCntnt();
+         _stRestored = (_stStorePtr != nullptr) && _stStorePtr->load(_mainBuffrArryPtr, _srQty);
+         if(!_stRestored){
+            if(initCntnt != nullptr)
+               memcpy(_mainBuffrArryPtr, initCntnt, _srQty);
+            else
+               memset(_mainBuffrArryPtr,0x00, _srQty);
+         }
+         _sendAllSRCntnt(trcApiBegin);   // A single flush restores every output
          xSemaphoreGive(_SRGXMnBffrMtx);
       }
       else 
          result = false;
    }
+   if(result && (_oe != 0xFF))
+      ::digitalWrite(_oe, LOW);
+   if(result && (_stStorePtr != nullptr) && (_stTskHndl == nullptr)){
+      if(_stSavedPtr == nullptr)
+         _stSavedPtr = new uint8_t [_srQty]{};
+      if(_stImgPtr == nullptr)
+         _stImgPtr = new uint8_t [_srQty]{};
+      memcpy(_stSavedPtr, _mainBuffrArryPtr, _srQty);
+      if(!_stRestored)  // The store held no valid image, it's initialized with the initial contents
+         _stStorePtr->save(_stSavedPtr, _srQty);
+      if(xTaskCreate(_stTsk, "SRGXStateTsk", 4096, this, tskIDLE_PRIORITY + 1, &_stTskHndl) != pdPASS){ // Low priority, the saving is not time critical
+         _stTskHndl = nullptr;
+         result = false;
+      }
+   }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::_copyMainToAux(const bool &overWriteIfExists){
-   bool result {false};
-   
-   if((_auxBuffrArryPtr == nullptr) || overWriteIfExists){
-      if(_auxBuffrArryPtr == nullptr)
-         _auxBuffrArryPtr = new uint8_t [_srQty];
-      memcpy(_auxBuffrArryPtr, _mainBuffrArryPtr, _srQty);
-      result = true;
+bool ShiftRegGPIOXpander::beginInput(const uint8_t &qh, const uint8_t &sh_ld, const uint8_t &inSrQty){
+   bool result{false};
+
+   if((_SRGXMnBffrMtx != nullptr) && (_inSrQty == 0) && (inSrQty > 0)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){   // The writes queued before are applied first, see _drainAsyncWrts()
+            _drainAsyncWrts();
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         _qh = qh;
+         _sh_ld = sh_ld;
+         ::digitalWrite(_sh_ld, HIGH);
+         pinMode(_sh_ld, OUTPUT);
+         pinMode(_qh, INPUT);
+         _inBffrArryPtr = new uint8_t [inSrQty]{};
+         _inStgBffrPtr = new uint8_t [inSrQty]{};
+         _maxSRGXInPin = (inSrQty * 8) - 1;
+         _inSrQty = inSrQty;  // Set last, flushes include the input chain from now on
+         _sendAllSRCntnt(trcApiBeginInput);   // First capture of the inputs
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::copyMainToAux(const bool &overWriteIfExists){
-   bool result {false};
-   
-   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-         if((_auxBuffrArryPtr == nullptr) || overWriteIfExists){
-            if(_auxBuffrArryPtr == nullptr)
-               _auxBuffrArryPtr = new uint8_t [_srQty];
-            memcpy(_auxBuffrArryPtr, _mainBuffrArryPtr, _srQty);
-            result = true;
+bool ShiftRegGPIOXpander::beginObservers(const uint8_t &queueDepth, const BaseType_t &obsTskPrrty){
+   bool result{false};
+
+   if((_obsQueue == nullptr) && (_srQty > 0) && (queueDepth > 0) && (obsTskPrrty > 0) && (obsTskPrrty < configMAX_PRIORITIES)){
+      const uint16_t itemWrdsQty{static_cast<uint16_t>(3 + 2 * ((_srQty + 3) / 4))};   // Header, changes mask and values
+
+      _obsQueue = xQueueCreate(queueDepth, itemWrdsQty * sizeof(uint32_t));
+      if(_obsQueue != nullptr){
+         _obsItemPtr = new uint32_t [itemWrdsQty]{};
+         _obsRcvdPtr = new uint32_t [itemWrdsQty]{};
+         _obsLtchsQty = 0;
+         _obsPndng = false;
+         if(xTaskCreate(_obsTsk, "SRGXObsTsk", 4096, this, obsTskPrrty, &_obsTskHndl) == pdPASS){
+            if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+               _allocLgclFrms();
+               _obsEn = true;
+               result = true;
+            }
+            else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+               _allocLgclFrms(); // The changes are notified from the frame latched last
+               _obsEn = true;
+               xSemaphoreGive(_SRGXMnBffrMtx);
+               result = true;
+            }
+            if(!result)
+               endObservers();
+         }
+         else{
+            _obsTskHndl = nullptr;
+            vQueueDelete(_obsQueue);
+            _obsQueue = nullptr;
+            _releaseObsRsrcs();
          }
-         xSemaphoreGive(_SRGXAuxBffrMtx);
       }
-      xSemaphoreGive(_SRGXMnBffrMtx);
    }
 
    return result;
 }
 
-SRGXVPort ShiftRegGPIOXpander::createSRGXVPort(const uint8_t &strtPin, const uint8_t &pinsQty){
-   if((pinsQty > 0) && ((strtPin + pinsQty - 1) <= _maxSRGXPin) && (pinsQty <= SRGXVPort::_maxPortPinsQty))
-      return SRGXVPort(this, strtPin, pinsQty);
-   else
-      return SRGXVPort();
+bool ShiftRegGPIOXpander::beginOEDimming(const uint8_t &ledcChnl, const uint32_t &freqHz, const uint8_t &rsltnBits){
+   bool result{false};
+
+   if((_SRGXMnBffrMtx != nullptr) && (_oe != 0xFF) && (_oeLedcChnl == 0xFF) && (freqHz > 0) && (rsltnBits >= 1) && (rsltnBits <= 14)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){   // No flush is blanking the outputs while the line is attached
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3)
+         result = ledcAttachChannel(_oe, freqHz, rsltnBits, ledcChnl);
+#else
+         result = (ledcSetup(ledcChnl, freqHz, rsltnBits) != 0);
+         if(result)
+            ledcAttachPin(_oe, ledcChnl);
+#endif
+         if(result){
+            _oeLedcChnl = ledcChnl;
+            _oeMaxDuty = static_cast<uint32_t>(0x01) << rsltnBits;
+            _oeBrghtns = _oeMaxDuty;
+            _oeLedcSig = ledc_periph_signal[ledcChnl / 8].sig_out0_idx + (ledcChnl % 8);   // The Arduino cores map the channels 8 to 15 to the second LEDC group
+            SRGX_LEDC_WRT(_oe, _oeLedcChnl, 0);  // OE permanently LOW, full brightness
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
 }
 
-int ShiftRegGPIOXpander::digitalRead(const uint8_t &srPin){
-   int result {GPIO_NUM_NC};
+bool ShiftRegGPIOXpander::beginSnapshots(const uint8_t &snpshtsQty){
+   bool result{false};
 
-   if((srPin >= 0) && (srPin <= _maxSRGXPin)){
-      result = digitalReadSr(srPin);
-      if(result == 0x00)
-         result = LOW;  
-      else if(result == 0x01)
-         result = HIGH;
+   if((_snpshtSlotsPtr == nullptr) && (snpshtsQty > 0) && (snpshtsQty <= _maxSnpshtsQty) && (_srQty > 0)){
+      if(_SRGXSnpshtMtx == nullptr)
+         _SRGXSnpshtMtx = xSemaphoreCreateMutex();
+      if(_SRGXSnpshtMtx != nullptr){
+         _snpshtSlotsPtr = new uint8_t* [snpshtsQty]{};
+         for(uint8_t slotIdx{0}; slotIdx < snpshtsQty; slotIdx++)
+            *(_snpshtSlotsPtr + slotIdx) = _allocBffr(_srQty);
+         _snpshtStgdMsk = 0x0000;
+         _snpshtsQty = snpshtsQty;
+         result = true;
+      }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalReadSgmntSr(const uint8_t &strtPin, const uint8_t &pinsQty, uint16_t &bffrSgmnt){
+bool ShiftRegGPIOXpander::beginTrace(const uint32_t &rngSize){
    bool result{false};
 
-   if((pinsQty > 0) && (pinsQty <= 16 ) && ((strtPin + pinsQty - 1) <= _maxSRGXPin)){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         bffrSgmnt = 0; // Initialize the result segment to zero
-         for (int ptrInc{0}; ptrInc < pinsQty; ptrInc++){
-            if(*(_mainBuffrArryPtr + ((strtPin + ptrInc) / 8)) & (static_cast<uint8_t>(0x01) << ((strtPin + ptrInc) % 8)))  // If the bit is set in Main then it needs to be set in the result segment
-               bffrSgmnt |= (static_cast<uint16_t>(0x01) << ptrInc); // Set the bit in the result segment
+   if((_trcRngPtr == nullptr) && (_srQty > 0) && (rngSize >= (10 + 2 * static_cast<uint32_t>(_srQty)))){
+      uint8_t* trcRngPtr = new uint8_t [rngSize]{};
+
+      _trcBaseFrmPtr = new uint8_t [_srQty]{};
+      _trcPrvFrmPtr = new uint8_t [_srQty]{};
+      _trcCurFrmPtr = new uint8_t [_srQty]{};
+      _trcRecPtr = new uint8_t [10 + 2 * _srQty]{};
+      _trcRngSize = rngSize;
+      _trcTail = 0;
+      _trcUsed = 0;
+      _trcLostQty = 0;
+      _trcWrstCycles = 0;
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _trcRngPtr = trcRngPtr;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         _trcRngPtr = trcRngPtr;
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
+      if(!result){
+         delete [] trcRngPtr;
+         _releaseTrcRsrcs();
+      }
+   }
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_blankOE(const bool &blank){
+   if(_oeLedcChnl != 0xFF){   // The pin is switched from the LEDC signal to the GPIO output register and back through the GPIO matrix, the LEDC channel keeps running undisturbed
+      if(blank){
+         gpio_ll_set_level(&GPIO, static_cast<gpio_num_t>(_oe), HIGH);
+         esp_rom_gpio_connect_out_signal(_oe, SIG_GPIO_OUT_IDX, false, false);
+      }
+      else
+         esp_rom_gpio_connect_out_signal(_oe, _oeLedcSig, false, false);
+   }
+   else
+      SRGX_PIN_WRT(_oe, blank?HIGH:LOW);
+
+   return;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_buildPhysImg(const uint8_t* lgclImgPtr){
+   int lgclIdx{-1};
+   uint8_t lgclVal{0};
+
+   memset(_physImgPtr, 0x00, _srQty);
+   for(uint16_t rmpRegIdx{0}; rmpRegIdx < _rmpRegsQty; rmpRegIdx++){
+      const SRGXRemapReg &rmpReg{*(_rmpRegsPtr + rmpRegIdx)};
+
+      if(rmpReg.lgclIdx != lgclIdx){   // The tables are grouped by logical register, each one is read once
+         lgclIdx = rmpReg.lgclIdx;
+         lgclVal = __atomic_load_n(lgclImgPtr + lgclIdx, __ATOMIC_RELAXED);
+      }
+      *(_physImgPtr + rmpReg.physIdx) |= rmpReg.rmpTbl[0][lgclVal & 0x0F] | rmpReg.rmpTbl[1][lgclVal >> 4];
+   }
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::calibrateBitDelay(const uint8_t &lpbkPin, const uint32_t &marginUs, const uint8_t &passesQty){
+   bool result{false};
+
+   if((_SRGXMnBffrMtx != nullptr) && (_busPtr == nullptr) && (marginUs <= (_maxBitDlyUs - _dfltBitDlyUs)) && (passesQty > 0)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){   // No flushing is in progress while the patterns are shifted
+         if(_lpbkPinVld(lpbkPin)){
+            const uint32_t prvBitDlyUs{_bitDlyUs};
+
+            _lpbkPin = lpbkPin;
+            pinMode(_lpbkPin, INPUT);
+            _bitDlyUs = _dfltBitDlyUs;
+            if(_lpbkTest(passesQty)){
+               bool passed{true};
+
+               while(passed && (_bitDlyUs > 0)){   // The delay is decreased until a pattern is altered, the faster rates are not tried
+                  _bitDlyUs--;
+                  passed = _lpbkTest(passesQty);
+               }
+               if(!passed)
+                  _bitDlyUs++;
+               _bitDlyUs += marginUs;
+               _flshRegTmUs = 0; // The register time is measured again at the new rate
+               result = true;
+            }
+            else
+               _bitDlyUs = prvBitDlyUs;
+            _lpbkExpVld = false; // The chain holds the last test pattern, not a frame
          }
          xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::clearInterlocks(){
+   bool result{false};
+
+   if(_ilcksQty > 0){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _ilcksQty = 0;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         _ilcksQty = 0;
+         xSemaphoreGive(_SRGXMnBffrMtx);
          result = true;
       }
    }
@@ -172,433 +730,1988 @@ bool ShiftRegGPIOXpander::digitalReadSgmntSr(const uint8_t &strtPin, const uint8
    return result;
 }
 
-uint8_t ShiftRegGPIOXpander::digitalReadSr(const uint8_t &srPin){
-   uint8_t result{0xFF};
-
-   if(srPin <= _maxSRGXPin){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         result = (*(_mainBuffrArryPtr + (srPin / 8)) >> (srPin % 8)) & 0x01;
-         xSemaphoreGive(_SRGXMnBffrMtx);
-      }
-   }
+bool ShiftRegGPIOXpander::clearPinsRemap(){
+   SRGXRemapReg* oldRmpRegsPtr{nullptr};
+   bool result{false};
+
+   if(_rmpRegsPtr != nullptr){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         oldRmpRegsPtr = _rmpRegsPtr;
+         _rmpRegsPtr = nullptr;
+         _rmpRegsQty = 0;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){   // The writes queued before are applied first, see _drainAsyncWrts()
+            _drainAsyncWrts();
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         oldRmpRegsPtr = _rmpRegsPtr;
+         _rmpRegsPtr = nullptr;
+         _rmpRegsQty = 0;
+         _sendAllSRCntnt(trcApiClearPinsRemap);   // The outputs are set to the new wiring immediately
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
+      if(oldRmpRegsPtr != nullptr)
+         delete [] oldRmpRegsPtr;
+   }
+
+   return result;
+}
+
+int16_t ShiftRegGPIOXpander::cmpSnapshotToMain(const uint8_t &slot, uint8_t* diffMskPtr){
+   int16_t result{-1};
+
+   if(slot < _snpshtsQty){
+      if(xSemaphoreTake(_SRGXSnpshtMtx, portMAX_DELAY) == pdTRUE){
+         if(_snpshtStgdMsk & (0x0001 << slot)){
+            const uint8_t* slotPtr{*(_snpshtSlotsPtr + slot)};
+
+            result = 0;
+            for(int ptrInc{0}; ptrInc < _srQty; ptrInc++){
+               const uint8_t diffBits = *(slotPtr + ptrInc) ^ __atomic_load_n(_mainBuffrArryPtr + ptrInc, __ATOMIC_RELAXED);
+
+               result += __builtin_popcount(diffBits);
+               if(diffMskPtr != nullptr)
+                  *(diffMskPtr + ptrInc) = diffBits;
+            }
+         }
+         xSemaphoreGive(_SRGXSnpshtMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::_copyMainToAux(const bool &overWriteIfExists){
+   bool result {false};
+   
+   if((_auxBuffrArryPtr == nullptr) || overWriteIfExists){
+      if(_auxBuffrArryPtr == nullptr)
+         _auxBuffrArryPtr = _allocBffr(_srQty);
+      memcpy(_auxBuffrArryPtr, _mainBuffrArryPtr, _srQty);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::copyMainToAux(const bool &overWriteIfExists){
+   bool result {false};
+   
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+         _drainAsyncWrts();
+         if((_auxBuffrArryPtr == nullptr) || overWriteIfExists){
+            if(_auxBuffrArryPtr == nullptr)
+               _auxBuffrArryPtr = _allocBffr(_srQty);
+            memcpy(_auxBuffrArryPtr, _mainBuffrArryPtr, _srQty);
+            result = true;
+         }
+         xSemaphoreGive(_SRGXAuxBffrMtx);
+      }
+      xSemaphoreGive(_SRGXMnBffrMtx);
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::copyMainToSnapshot(const uint8_t &slot){
+   bool result{false};
+
+   if(slot < _snpshtsQty){
+      if(_takeMainBffr(trcApiMoveAuxToMain)){   // A pending Auxiliary Buffer is moved to the Main Buffer before it's copied, as the reading methods see it
+         if(xSemaphoreTake(_SRGXSnpshtMtx, portMAX_DELAY) == pdTRUE){
+            memcpy(*(_snpshtSlotsPtr + slot), _mainBuffrArryPtr, _srQty);
+            _snpshtStgdMsk |= (0x0001 << slot);
+            xSemaphoreGive(_SRGXSnpshtMtx);
+            result = true;
+         }
+         _giveMainBffr(false, trcApiNone);
+      }
+   }
+
+   return result;
+}
+
+SRGXVPort ShiftRegGPIOXpander::createSRGXVPort(const uint8_t &strtPin, const uint8_t &pinsQty){
+   if((pinsQty > 0) && ((strtPin + pinsQty - 1) <= _maxSRGXPin) && (pinsQty <= SRGXVPort::_maxPortPinsQty))
+      return SRGXVPort(this, strtPin, pinsQty);
+   else
+      return SRGXVPort();
+}
+
+SRGXVPort ShiftRegGPIOXpander::createSRGXSctrVPort(const uint8_t* pinsLstPtr, const uint8_t &pinsQty){
+
+   return SRGXVPort(this, pinsLstPtr, pinsQty); // The constructor validates the pins list, building an invalid SRGXVPort if the list is not valid
+}
+
+SRGXInVPort ShiftRegGPIOXpander::createSRGXInVPort(const uint8_t &strtPin, const uint8_t &pinsQty){
+
+   return SRGXInVPort(this, strtPin, pinsQty);  // The constructor validates the pins range, building an invalid SRGXInVPort if not valid
+}
+
+int ShiftRegGPIOXpander::digitalRead(const uint8_t &srPin){
+   int result {GPIO_NUM_NC};
+
+   if((srPin >= 0) && (srPin <= _maxSRGXPin)){
+      result = digitalReadSr(srPin);
+      if(result == 0x00)
+         result = LOW;  
+      else if(result == 0x01)
+         result = HIGH;
+   }
+
+   return result;
+}
+
+int ShiftRegGPIOXpander::digitalReadIn(const uint8_t &inPin){
+   int result {GPIO_NUM_NC};
+   uint8_t inByte{0};
+
+   if((_inSrQty > 0) && (inPin <= _maxSRGXInPin)){
+      _readInImg(inPin / 8, 1, &inByte);
+      result = ((inByte >> (inPin % 8)) & 0x01)?HIGH:LOW;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalReadSgmntIn(const uint8_t &strtPin, const uint8_t &pinsQty, uint16_t &inSgmnt){
+   bool result{false};
+   uint8_t inBytes[3]{0};  // A 16 pins segment spans at most 3 Input Image bytes
+   uint32_t sgmntWndw{0};
+
+   if((_inSrQty > 0) && (pinsQty > 0) && (pinsQty <= 16) && ((strtPin + pinsQty - 1) <= _maxSRGXInPin)){
+      const uint8_t frstIdx = strtPin / 8;
+      const uint8_t bytesQty = ((strtPin + pinsQty - 1) / 8) - frstIdx + 1;
+
+      _readInImg(frstIdx, bytesQty, inBytes);
+      for(int byteInc{bytesQty - 1}; byteInc >= 0; byteInc--)
+         sgmntWndw = (sgmntWndw << 8) | inBytes[byteInc];
+      inSgmnt = static_cast<uint16_t>(sgmntWndw >> (strtPin % 8)) & static_cast<uint16_t>((1UL << pinsQty) - 1);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalReadSgmntSr(const uint8_t &strtPin, const uint8_t &pinsQty, uint16_t &bffrSgmnt){
+   bool result{false};
+
+   if((pinsQty > 0) && (pinsQty <= 16 ) && ((strtPin + pinsQty - 1) <= _maxSRGXPin)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalReadSgmntSr);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         bffrSgmnt = 0; // Initialize the result segment to zero
+         for (int ptrInc{0}; ptrInc < pinsQty; ptrInc++){
+            if(*(_mainBuffrArryPtr + ((strtPin + ptrInc) / 8)) & (static_cast<uint8_t>(0x01) << ((strtPin + ptrInc) % 8)))  // If the bit is set in Main then it needs to be set in the result segment
+               bffrSgmnt |= (static_cast<uint16_t>(0x01) << ptrInc); // Set the bit in the result segment
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+uint8_t ShiftRegGPIOXpander::digitalReadSr(const uint8_t &srPin){
+   uint8_t result{0xFF};
+
+   if(srPin <= _maxSRGXPin){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalReadSr);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         result = (*(_mainBuffrArryPtr + (srPin / 8)) >> (srPin % 8)) & 0x01;
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::digitalToggleSr(const uint8_t &srPin){
+   bool result{false};
+
+   if((srPin <= _maxSRGXPin) && !isPinReserved(srPin)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalToggleSr);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         _mainMskdWrt(srPin / 8, 0x00, 0x00, (0x01 << (srPin % 8)));
+         _sendAllSRCntnt(trcApiDigitalToggleSr);
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;  //!< The operation was successful, the pin was toggled in the Main Buffer
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalToggleSrAll(){
+   bool result{false};
+
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
+         _drainAsyncWrts();
+         if(_auxBuffrArryPtr != nullptr)
+            _moveAuxToMain(trcApiDigitalToggleSrAll);
+         xSemaphoreGive(_SRGXAuxBffrMtx);
+      }
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+         _mainUnrsrvdWrt(ptrInc, 0x00, 0x00, 0xFF);
+      _sendAllSRCntnt(trcApiDigitalToggleSrAll);
+      xSemaphoreGive(_SRGXMnBffrMtx);
+      result = true;  
+   }
+   
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalToggleSrMask(uint8_t *toggleMask){
+   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+   bool result{false};
+
+   if(toggleMask != nullptr){
+      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid toggleMask being modified while the copy operation is being performed
+      uint8_t* localToggleMask = new uint8_t[_srQty];
+      memcpy(localToggleMask, toggleMask, _srQty);
+      taskEXIT_CRITICAL(&mux);   // Exit critical section
+
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalToggleSrMask);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            _mainUnrsrvdWrt(ptrInc, 0x00, 0x00, *(localToggleMask + ptrInc));
+         _sendAllSRCntnt(trcApiDigitalToggleSrMask);
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;  //!< The operation was successful, the pins were toggled in the Main Buffer
+      }
+      delete [] localToggleMask;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalToggleSrToAux(const uint8_t &srPin){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr == nullptr)
+               _copyMainToAux();
+            *(_auxBuffrArryPtr + (srPin / 8)) ^= (0x01 << (srPin % 8));
+            result = true;  
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::digitalWrite(const uint8_t &srPin, const uint8_t &value){
+   digitalWriteSr(srPin, value);
+
+   return;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::digitalWriteSr(const uint8_t &srPin, const uint8_t &value){
+   bool result{false};
+
+   if((srPin <= _maxSRGXPin) && !isPinReserved(srPin)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalWriteSr);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         _mainMskdWrt(srPin / 8, (0x01 << (srPin % 8)), (value)?0xFF:0x00);
+         _sendAllSRCntnt(trcApiDigitalWriteSr);
+         result = true;  
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::digitalWriteSr(const SRGXPinDsc &pinDsc, const uint8_t &value){
+   bool result{false};
+
+   if((pinDsc.bffrIdx < _srQty) && ((__atomic_load_n(_pinOwnrshpPtr + pinDsc.bffrIdx, __ATOMIC_ACQUIRE) & pinDsc.bitMsk) == 0x00)){ // A descriptor built for a longer chain is rejected by a single compare. Pins reserved by other objects are not written
+      if(_takeMainBffr(trcApiDigitalWriteSr)){
+         _mainMskdWrt(pinDsc.bffrIdx, pinDsc.bitMsk, (value)?0xFF:0x00);
+         _giveMainBffr(true, trcApiDigitalWriteSr);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrAllReset(){
+   bool result{false};
+
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+         _drainAsyncWrts();
+         if(_auxBuffrArryPtr != nullptr)   //!< Although the discardAux() method makes this check, it is better to do it here to avoid unnecessary calls to the method
+            _discardAux();
+         xSemaphoreGive(_SRGXAuxBffrMtx);
+      }
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+         _mainUnrsrvdWrt(ptrInc, 0xFF, 0x00);
+      _sendAllSRCntnt(trcApiDigitalWriteSrAllReset);
+      xSemaphoreGive(_SRGXMnBffrMtx);
+      result = true;  
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrAllSet(){
+   bool result{false};
+
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+         _drainAsyncWrts();
+         if(_auxBuffrArryPtr != nullptr)   //!< Although the discardAux() method makes this check, it is better to do it here to avoid unnecessary calls to the method
+            _discardAux();
+         xSemaphoreGive(_SRGXAuxBffrMtx);
+      }
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+         _mainUnrsrvdWrt(ptrInc, 0xFF, 0xFF);
+      _sendAllSRCntnt(trcApiDigitalWriteSrAllSet);
+      xSemaphoreGive(_SRGXMnBffrMtx);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrMaskReset(uint8_t* resetMask){
+   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+   bool result{false};
+
+   if(resetMask != nullptr){
+      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid resetMask being modified while the operation is being performed
+      uint8_t* localResetMask = new uint8_t[_srQty];
+      memcpy(localResetMask, resetMask, _srQty);
+      taskEXIT_CRITICAL(&mux);   // Exit critical section
+
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalWriteSrMaskReset);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            _mainUnrsrvdWrt(ptrInc, *(localResetMask + ptrInc), 0x00);
+         _sendAllSRCntnt(trcApiDigitalWriteSrMaskReset);
+         delete [] localResetMask;
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;  
+      }      
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrMaskSet(uint8_t* setMask){
+   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+   bool result{false};
+
+   if(setMask != nullptr){
+      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid resetMask being modified while the operation is being performed
+      uint8_t* localSetMask = new uint8_t[_srQty];
+      memcpy(localSetMask, setMask, _srQty);
+      taskEXIT_CRITICAL(&mux);   // Exit critical section
+
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr != nullptr)
+               _moveAuxToMain(trcApiDigitalWriteSrMaskSet);
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            _mainUnrsrvdWrt(ptrInc, *(localSetMask + ptrInc), 0xFF);
+         _sendAllSRCntnt(trcApiDigitalWriteSrMaskSet);
+         delete [] localSetMask;
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;  
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrToAux(const uint8_t srPin, const uint8_t value){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            if(_auxBuffrArryPtr == nullptr)
+               _copyMainToAux();
+            if(value)
+               *(_auxBuffrArryPtr + (srPin / 8)) |= (0x01 << (srPin % 8));
+            else
+               *(_auxBuffrArryPtr + (srPin / 8)) &= ~(0x01 << (srPin % 8));
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+            result = true;
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::digitalWriteSrToSnapshot(const uint8_t &slot, const uint8_t &srPin, const uint8_t &value){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin){
+      if(_takeSnpsht(slot)){
+         if(value)
+            *(*(_snpshtSlotsPtr + slot) + (srPin / 8)) |= (0x01 << (srPin % 8));
+         else
+            *(*(_snpshtSlotsPtr + slot) + (srPin / 8)) &= ~(0x01 << (srPin % 8));
+         xSemaphoreGive(_SRGXSnpshtMtx);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_giveMainBffr(const bool &flush, const SRGXTrcApi &trcApi){
+   if(flush)
+      _sendAllSRCntnt(trcApi);
+   xSemaphoreGive(_SRGXMnBffrMtx);
+
+   return;
+}
+
+void ShiftRegGPIOXpander::_discardAux(){
+   _freeBffr(_auxBuffrArryPtr);
+   
+   return;
+}
+
+bool ShiftRegGPIOXpander::discardAux(){
+   bool result{false};
+
+   if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+      _freeBffr(_auxBuffrArryPtr);
+      xSemaphoreGive(_SRGXAuxBffrMtx);
+      result = true;  
+   }
+   
+   return result;
+}
+
+bool ShiftRegGPIOXpander::discardSnapshot(const uint8_t &slot){
+   bool result{false};
+
+   if(slot < _snpshtsQty){
+      if(xSemaphoreTake(_SRGXSnpshtMtx, portMAX_DELAY) == pdTRUE){
+         if(_snpshtStgdMsk & (0x0001 << slot)){
+            _snpshtStgdMsk &= ~(0x0001 << slot);
+            result = true;
+         }
+         xSemaphoreGive(_SRGXSnpshtMtx);
+      }
+   }
+
+   return result;
+}
+
+uint32_t ShiftRegGPIOXpander::dumpTrace(uint8_t* dumpPtr, const uint32_t &dumpSize){
+   uint32_t result{0};
+
+   if((_trcRngPtr != nullptr) && (dumpPtr != nullptr) && (dumpSize >= getTraceDumpSize())){
+      for(uint8_t tryInc{0}; (tryInc < 8) && (result == 0); tryInc++){
+         const uint32_t trcSeq{__atomic_load_n(&_trcSeq, __ATOMIC_ACQUIRE)};
+
+         if(!(trcSeq & 0x01)){
+            const uint32_t trcTail{__atomic_load_n(&_trcTail, __ATOMIC_RELAXED)};
+            const uint32_t trcUsed{__atomic_load_n(&_trcUsed, __ATOMIC_RELAXED)};
+            const uint32_t trcLostQty{__atomic_load_n(&_trcLostQty, __ATOMIC_RELAXED)};
+            const uint32_t frstQty{((_trcRngSize - trcTail) < trcUsed)?(_trcRngSize - trcTail):trcUsed};  // The records might wrap around the ring buffer end
+
+            memcpy(dumpPtr, "SRGT", 4);
+            *(dumpPtr + 4) = 2;
+            *(dumpPtr + 5) = _srQty;
+            *(dumpPtr + 6) = 0;
+            *(dumpPtr + 7) = 0;
+            memcpy(dumpPtr + 8, &trcUsed, 4);
+            memcpy(dumpPtr + 12, &trcLostQty, 4);
+            memcpy(dumpPtr + 16, _trcBaseFrmPtr, _srQty);
+            memcpy(dumpPtr + 16 + _srQty, _trcRngPtr + trcTail, frstQty);
+            memcpy(dumpPtr + 16 + _srQty + frstQty, _trcRngPtr, trcUsed - frstQty);
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if(__atomic_load_n(&_trcSeq, __ATOMIC_RELAXED) == trcSeq)
+               result = 16 + _srQty + trcUsed;
+         }
+         if(result == 0)
+            vTaskDelay(1); // A flush is adding a record, retry after it's done
+      }
+   }
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_drainAsyncWrts(){
+   if(_asyncWrtsSeqPtr != nullptr){
+      uint8_t wrtsQty{0};
+
+      taskENTER_CRITICAL(&_asyncWrtsMux);
+      wrtsQty = _asyncWrtsQty;
+      taskEXIT_CRITICAL(&_asyncWrtsMux);
+      while(wrtsQty > 0){  // The writes queued are applied in order, the slots are not reused by the producers until released
+         const uint16_t slotOfst{static_cast<uint16_t>(_asyncWrtsHd * _srQty)};
+
+         for(uint8_t bffrIdx{0}; bffrIdx < _srQty; bffrIdx++){
+            const uint8_t wrtMsk{*(_asyncWrtsMskPtr + slotOfst + bffrIdx)};
+            const uint8_t wrtVals{*(_asyncWrtsValsPtr + slotOfst + bffrIdx)};
+
+            _mainUnrsrvdWrt(bffrIdx, wrtMsk, wrtVals);
+            if(_auxBuffrArryPtr != nullptr)  // The Auxiliary Buffer copy of the pins is refreshed too, so moving it does not overwrite the write with older values
+               *(_auxBuffrArryPtr + bffrIdx) = (*(_auxBuffrArryPtr + bffrIdx) & ~wrtMsk) | (wrtVals & wrtMsk);
+         }
+         taskENTER_CRITICAL(&_asyncWrtsMux);
+         _asyncWrtsHd = (_asyncWrtsHd + 1) % _asyncWrtsDpth;
+         wrtsQty = --_asyncWrtsQty;
+         taskEXIT_CRITICAL(&_asyncWrtsMux);
+      }
+   }
+
+   return;
+}
+
+void ShiftRegGPIOXpander::end(){
+   if(_asyncTskHndl != nullptr){
+      _asyncTskEnd = true;
+      xTaskNotifyGive(_asyncTskHndl);  // Wake the flushing task so it ends itself
+      while(_asyncTskHndl != nullptr)
+         vTaskDelay(1);
+      _asyncTskEnd = false;
+      _asyncTskSt = 0;
+      _asyncWrtsQty = 0;   // The writes queued and not applied are discarded
+   }
+   if(_stTskHndl != nullptr){
+      _stTskEnd = true;
+      xTaskNotifyGive(_stTskHndl);  // Wake the state persisting task so it saves the pending image and ends itself
+      while(_stTskHndl != nullptr)
+         vTaskDelay(1);
+      _stTskEnd = false;
+   }
+   endObservers();
+   endOEDimming();
+   if(_busPtr != nullptr)
+      _busPtr->removeSRGX(this);
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::endObservers(){
+   bool result{false};
+
+   if(_obsQueue != nullptr){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _obsEn = false;
+         result = true;
+      }
+      else{
+         while(!result && (xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE)){
+            _postObsDiff(false); // The changes folded while the queue was full are queued before ending, as the dispatching task makes room
+            if(!_obsPndng || (_obsTskHndl == nullptr)){
+               _obsEn = false;
+               result = true;
+            }
+            xSemaphoreGive(_SRGXMnBffrMtx);
+            if(!result)
+               vTaskDelay(1);
+         }
+      }
+      if(result){
+         if(_obsTskHndl != nullptr){
+            *_obsItemPtr = 0; // Latch number 0, the dispatching task ends itself when receiving it
+            xQueueSend(_obsQueue, _obsItemPtr, portMAX_DELAY); // Queued after the notifications pending, which are delivered first
+            while(_obsTskHndl != nullptr)
+               vTaskDelay(1);
+         }
+         vQueueDelete(_obsQueue);
+         _obsQueue = nullptr;
+         _releaseObsRsrcs();
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::endOEDimming(){
+   bool result{false};
+
+   if(_oeLedcChnl != 0xFF){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && (ESP_ARDUINO_VERSION_MAJOR >= 3)
+         ledcDetach(_oe);
+#else
+         ledcDetachPin(_oe);
+#endif
+         _oeLedcChnl = 0xFF;
+         _oeBrghtns = 0;
+         ::digitalWrite(_oe, LOW);
+         pinMode(_oe, OUTPUT);
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::endTrace(){
+   uint8_t* trcRngPtr{_trcRngPtr};
+   bool result{false};
+
+   if(trcRngPtr != nullptr){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _trcRngPtr = nullptr;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         _trcRngPtr = nullptr;
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
+      }
+      if(result){
+         delete [] trcRngPtr;
+         _releaseTrcRsrcs();
+      }
+   }
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_freeBffr(uint8_t* &bffrPtr){
+   if(bffrPtr != nullptr){
+#if SRGX_IRAM_EN
+      heap_caps_free(bffrPtr);
+#else
+      delete [] reinterpret_cast<uint32_t*>(bffrPtr);
+#endif
+      bffrPtr = nullptr;
+   }
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::flipBit(const uint8_t &srPin){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin)
+      result = digitalToggleSr(srPin); // Toggle the pin state at position srPin
+
+   return result;
+}
+
+uint32_t ShiftRegGPIOXpander::getBitDelay(){
+
+   return _bitDlyUs;
+}
+
+uint32_t ShiftRegGPIOXpander::getBrightness(){
+
+   return _oeBrghtns;
+}
+
+uint8_t ShiftRegGPIOXpander::getInSrQty(){
+
+   return _inSrQty;
+}
+
+uint32_t ShiftRegGPIOXpander::getFlushCrtclWrstTm(){
+
+   return _flshCrtclWrstUs;
+}
+
+SRGXFlushPolicy ShiftRegGPIOXpander::getFlushPolicy(){
+
+   return _flshPolicy;
+}
+
+uint32_t ShiftRegGPIOXpander::getFlushWrstTm(){
+
+   return _flshWrstUs;
+}
+
+uint32_t ShiftRegGPIOXpander::getInterlockBrksQty(){
+
+   return _ilckBrksQty;
+}
+
+uint32_t ShiftRegGPIOXpander::getInterlockFltsQty(){
+
+   return _ilckFltsQty;
+}
+
+uint32_t ShiftRegGPIOXpander::getLoopbackErrsQty(){
+
+   return _lpbkErrsQty;
+}
+
+uint8_t* ShiftRegGPIOXpander::getMainBuffPtr(){
+
+   return _mainBuffrArryPtr;
+}
+
+uint8_t ShiftRegGPIOXpander::getMaxSRGXPin(){
+
+   return _maxSRGXPin;
+}
+
+uint8_t ShiftRegGPIOXpander::getMaxSRGXInPin(){
+
+   return _maxSRGXInPin;
+}
+
+uint8_t ShiftRegGPIOXpander::getSnapshotsQty(){
+
+   return _snpshtsQty;
+}
+
+uint32_t ShiftRegGPIOXpander::getTraceDumpSize(){
+
+   return (_trcRngPtr != nullptr)?(16 + _srQty + _trcRngSize):0;
+}
+
+uint32_t ShiftRegGPIOXpander::getTraceWrstCycles(){
+
+   return _trcWrstCycles;
+}
+
+uint8_t ShiftRegGPIOXpander::getSrQty(){
+
+   return _srQty;
+}
+
+bool ShiftRegGPIOXpander::isValid(SRGXVPort &VPort){
+
+   return (VPort.getSRGXPtr() != nullptr);
+}
+
+bool ShiftRegGPIOXpander::isValid(const SRGXPinDsc &pinDsc){
+
+   return (pinDsc.srQty > 0) && (pinDsc.srQty <= _srQty) && (pinDsc.bffrIdx < _srQty);
+}
+
+bool ShiftRegGPIOXpander::isPinReserved(const uint8_t &srPin){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin)
+      result = (__atomic_load_n(_pinOwnrshpPtr + (srPin / 8), __ATOMIC_ACQUIRE) >> (srPin % 8)) & 0x01;
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::isSnapshotStaged(const uint8_t &slot){
+   bool result{false};
+
+   if(slot < _snpshtsQty)
+      result = (__atomic_load_n(&_snpshtStgdMsk, __ATOMIC_RELAXED) & (0x0001 << slot)) != 0;
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::isStateRestored(){
+
+   return _stRestored;
+}
+
+bool ShiftRegGPIOXpander::_lpbkPinVld(const uint8_t &lpbkPin){
+   bool result{digitalPinIsValid(lpbkPin)};
+
+   if(result){
+      if((lpbkPin == _ds) || (lpbkPin == _sh_cp) || (lpbkPin == _st_cp) || ((_oe != 0xFF) && (lpbkPin == _oe)))
+         result = false;
+      else if((_inSrQty > 0) && ((lpbkPin == _qh) || (lpbkPin == _sh_ld)))
+         result = false;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::_lpbkTest(const uint8_t &passesQty){
+   static const uint8_t fxdPttrns[4]{0xAA, 0x55, 0xFF, 0x00};  // Bit transitions at every clock first, then stuck lines
+   uint8_t* pttrnPtr{new uint8_t [_srQty]{}};
+   uint32_t rndmSeed{0x2545F491};
+   bool result{true};
+
+   for(int passInc{0}; passInc <= passesQty; passInc++){ // The first pass fills the chain, each of the next ones reads the preceding pattern back
+      for(int byteInc{0}; byteInc < _srQty; byteInc++){
+         uint8_t lpbkData{0};
+         uint8_t pttrnByte{0};
+
+         if(passInc < 4)
+            pttrnByte = fxdPttrns[passInc];
+         else{
+            rndmSeed ^= rndmSeed << 13;   // xorshift32 pseudo-random patterns
+            rndmSeed ^= rndmSeed >> 17;
+            rndmSeed ^= rndmSeed << 5;
+            pttrnByte = rndmSeed & 0xFF;
+         }
+         _sendSnglSRCntnt(pttrnByte, nullptr, (passInc > 0)?&lpbkData:nullptr);
+         if((passInc > 0) && (lpbkData != *(pttrnPtr + byteInc)))  // The first byte shifted in is the first one shifted out
+            result = false;
+         *(pttrnPtr + byteInc) = pttrnByte;
+      }
+   }
+   delete [] pttrnPtr;
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_mainMskdWrt(const uint8_t &bffrIdx, const uint8_t &msk, const uint8_t &vals, const uint8_t &tgglMsk){
+   if((msk != 0x00) || (tgglMsk != 0x00)){
+      uint32_t* wordPtr = reinterpret_cast<uint32_t*>(_mainBuffrArryPtr) + (bffrIdx / 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+      const uint8_t wordShft = (3 - (bffrIdx % 4)) * 8;
+#else
+      const uint8_t wordShft = (bffrIdx % 4) * 8;  // ESP32 is little-endian, the byte at bffrIdx occupies the wordShft position of it's word
+#endif
+      const uint32_t wordMsk = static_cast<uint32_t>(msk) << wordShft;
+      const uint32_t wordVals = static_cast<uint32_t>(vals & msk) << wordShft;
+      const uint32_t wordTggl = static_cast<uint32_t>(tgglMsk) << wordShft;
+      uint32_t oldWord = __atomic_load_n(wordPtr, __ATOMIC_RELAXED);
+      uint32_t newWord{0};
+
+      do{
+         newWord = ((oldWord & ~wordMsk) | wordVals) ^ wordTggl;
+      }while(!__atomic_compare_exchange_n(wordPtr, &oldWord, newWord, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));  // oldWord is refreshed on failure, a concurrent lock-free SRGXVPort write modified the word
+   }
+
+   return;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_mainUnrsrvdWrt(const uint8_t &bffrIdx, const uint8_t &msk, const uint8_t &vals, const uint8_t &tgglMsk){
+   const uint8_t freeMsk{static_cast<uint8_t>(~__atomic_load_n(_pinOwnrshpPtr + bffrIdx, __ATOMIC_ACQUIRE))};
+
+   _mainMskdWrt(bffrIdx, msk & freeMsk, vals, tgglMsk & freeMsk);
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::_moveAuxToMain(const SRGXTrcApi &trcApi){
+   bool result {false};
+
+   if(_auxBuffrArryPtr != nullptr){
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+         _mainMskdWrt(ptrInc, ~(*(_pinOwnrshpPtr + ptrInc)), *(_auxBuffrArryPtr + ptrInc));  // Pins reserved by an exclusive SRGXVPort keep the Main value, the Auxiliary holds a stale copy of them
+      _discardAux();
+      _sendAllSRCntnt(trcApi);
+      result = true;}
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::moveAuxToMain(){
+   bool result {false};
+
+   if(_auxBuffrArryPtr != nullptr){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
+            result = _moveAuxToMain(trcApiMoveAuxToMain); 
+            xSemaphoreGive(_SRGXAuxBffrMtx);
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::moveSnapshotToMain(const uint8_t &slot, const bool &keepSnapshot){
+   bool result{false};
+
+   if(slot < _snpshtsQty){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         if(xSemaphoreTake(_SRGXSnpshtMtx, portMAX_DELAY) == pdTRUE){
+            if(_snpshtStgdMsk & (0x0001 << slot)){
+               if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){   // The commit supersedes a pending Auxiliary Buffer, as stampOverMain() does, so no later method moves the older copy over it
+                  _drainAsyncWrts();
+                  if(_auxBuffrArryPtr != nullptr)
+                     _discardAux();
+                  xSemaphoreGive(_SRGXAuxBffrMtx);
+               }
+               const uint8_t* slotPtr{*(_snpshtSlotsPtr + slot)};
+
+               for(int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+                  _mainMskdWrt(ptrInc, ~(*(_pinOwnrshpPtr + ptrInc)), *(slotPtr + ptrInc));  // Pins reserved by an exclusive SRGXVPort keep the Main value
+               if(!keepSnapshot)
+                  _snpshtStgdMsk &= ~(0x0001 << slot);
+               _sendAllSRCntnt(trcApiMoveSnapshotToMain);   // A single latch switches every output to the slot image
+               result = true;
+            }
+            xSemaphoreGive(_SRGXSnpshtMtx);
+         }
+         xSemaphoreGive(_SRGXMnBffrMtx);
+      }
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::_readBytesFromMain(const uint8_t* bffrIdxPtr, const uint8_t &bytesQty, uint8_t* valsPtr, const SRGXTrcApi &trcApi){
+   bool result{false};
+
+   if((bffrIdxPtr != nullptr) && (valsPtr != nullptr)){
+      if(_takeMainBffr(trcApi)){
+         for(int ptrInc{0}; ptrInc < bytesQty; ptrInc++)
+            *(valsPtr + ptrInc) = *(_mainBuffrArryPtr + *(bffrIdxPtr + ptrInc));
+         _giveMainBffr(false, trcApi);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_readInImg(const uint8_t &frstIdx, const uint8_t &bytesQty, uint8_t* valsPtr){
+   uint32_t strtSeq{0};
+   uint32_t endSeq{0};
+
+   do{
+      strtSeq = __atomic_load_n(&_inImgSeq, __ATOMIC_ACQUIRE);
+      for(int byteInc{0}; byteInc < bytesQty; byteInc++)
+         *(valsPtr + byteInc) = __atomic_load_n(_inBffrArryPtr + frstIdx + byteInc, __ATOMIC_RELAXED);
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+      endSeq = __atomic_load_n(&_inImgSeq, __ATOMIC_RELAXED);
+   }while((strtSeq & 0x01) || (strtSeq != endSeq));   // An odd sequence or a sequence change means a publication overlapped the copy
+
+   return;
+}
+
+void ShiftRegGPIOXpander::_notifyAsyncWtrs(){
+   SRGXAsyncWtr ltchdWtrs[_maxAsyncWtrsQty];
+   uint8_t ltchdWtrsQty{0};
+   const uint32_t ltchdWrtSeq{__atomic_load_n(&_ltchdWrtSeq, __ATOMIC_SEQ_CST)};
+
+   taskENTER_CRITICAL(&_asyncMux);
+   for(uint8_t wtrInc{0}; wtrInc < _asyncWtrsQty;){
+      if(static_cast<int32_t>(ltchdWrtSeq - (_asyncWtrsPtr + wtrInc)->wrtSeq) >= 0){
+         ltchdWtrs[ltchdWtrsQty++] = *(_asyncWtrsPtr + wtrInc);
+         *(_asyncWtrsPtr + wtrInc) = *(_asyncWtrsPtr + _asyncWtrsQty - 1);
+         __atomic_store_n(&_asyncWtrsQty, _asyncWtrsQty - 1, __ATOMIC_SEQ_CST);
+      }
+      else
+         wtrInc++;
+   }
+   taskEXIT_CRITICAL(&_asyncMux);
+   for(uint8_t wtrInc{0}; wtrInc < ltchdWtrsQty; wtrInc++){   // Notified and resumed out of the critical section
+      if(ltchdWtrs[wtrInc].tskHndl != nullptr)
+         xTaskNotifyGive(ltchdWtrs[wtrInc].tskHndl);
+#if SRGX_CORO_EN
+      else
+         std::coroutine_handle<>::from_address(ltchdWtrs[wtrInc].crtnAddr).resume();
+#endif
+   }
+
+   return;
+}
+
+void ShiftRegGPIOXpander::_obsTsk(void* argp){
+   ShiftRegGPIOXpander* SRGXPtr = static_cast<ShiftRegGPIOXpander*>(argp);
+   const uint8_t wrdsQty{static_cast<uint8_t>((SRGXPtr->_srQty + 3) / 4)};
+   SRGXObsReg obsRegs[_maxObsRegsQty];
+   uint8_t obsRegsQty{0};
+
+   for(;;){
+      if(xQueueReceive(SRGXPtr->_obsQueue, SRGXPtr->_obsRcvdPtr, portMAX_DELAY) == pdTRUE){
+         const uint32_t* rcvdPtr{SRGXPtr->_obsRcvdPtr};
+
+         if(*rcvdPtr == 0) // Ending notification, queued by endObservers()
+            break;
+
+         const SRGXChgDiff diff{*rcvdPtr, *(rcvdPtr + 1), *(rcvdPtr + 2), SRGXPtr->_srQty, reinterpret_cast<const uint8_t*>(rcvdPtr + 3), reinterpret_cast<const uint8_t*>(rcvdPtr + 3 + wrdsQty)};
+
+         taskENTER_CRITICAL(&SRGXPtr->_obsMux);
+         obsRegsQty = SRGXPtr->_obsRegsQty;
+         memcpy(obsRegs, SRGXPtr->_obsRegs, obsRegsQty * sizeof(SRGXObsReg));
+         taskEXIT_CRITICAL(&SRGXPtr->_obsMux);
+         for(uint8_t obsInc{0}; obsInc < obsRegsQty; obsInc++)
+            obsRegs[obsInc].cb(diff, obsRegs[obsInc].argp);
+         if((uxQueueMessagesWaiting(SRGXPtr->_obsQueue) == 0) && __atomic_load_n(&SRGXPtr->_obsPndng, __ATOMIC_ACQUIRE)){  // The changes folded while the queue was full are not left undelivered if no more latches come
+            if(xSemaphoreTake(SRGXPtr->_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+               if(SRGXPtr->_obsEn)
+                  SRGXPtr->_postObsDiff(false);
+               xSemaphoreGive(SRGXPtr->_SRGXMnBffrMtx);
+            }
+         }
+      }
+   }
+   SRGXPtr->_obsTskHndl = nullptr;
+   vTaskDelete(NULL);
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_postObsDiff(const bool &ltchd){
+   const uint8_t wrdsQty{static_cast<uint8_t>((_srQty + 3) / 4)};
+   uint32_t* chgMskPtr{_obsItemPtr + 3};
+
+   if(ltchd){
+      const uint32_t* curFrmPtr{reinterpret_cast<const uint32_t*>(_lgclCurFrmPtr)};
+      const uint32_t* prvFrmPtr{reinterpret_cast<const uint32_t*>(_lgclPrvFrmPtr)};
+      uint32_t chgsFound{0};
+
+      for(uint8_t wrdInc{0}; wrdInc < wrdsQty; wrdInc++){   // The buffers are zero padded to 32-bits words, the padding never differs
+         const uint32_t chgBits{*(curFrmPtr + wrdInc) ^ *(prvFrmPtr + wrdInc)};
+
+         *(chgMskPtr + wrdInc) |= chgBits;
+         chgsFound |= chgBits;
+      }
+      if(++_obsLtchsQty == 0) // Latch number 0 is reserved for the ending notification
+         _obsLtchsQty = 1;
+      if(chgsFound != 0){
+         if(_obsPndng)
+            (*(_obsItemPtr + 2))++; // The changes of the latch not queued are folded into this one
+         *_obsItemPtr = _obsLtchsQty;
+         *(_obsItemPtr + 1) = static_cast<uint32_t>(esp_timer_get_time());
+         memcpy(chgMskPtr + wrdsQty, _lgclCurFrmPtr, wrdsQty * sizeof(uint32_t));
+         __atomic_store_n(&_obsPndng, true, __ATOMIC_RELEASE);
+      }
+   }
+   if(_obsPndng){
+      if(xQueueSend(_obsQueue, _obsItemPtr, 0) == pdTRUE){   // Never waits, a full queue must not extend the flush
+         memset(chgMskPtr, 0x00, wrdsQty * sizeof(uint32_t));
+         *(_obsItemPtr + 2) = 0;
+         __atomic_store_n(&_obsPndng, false, __ATOMIC_RELEASE);
+      }
+   }
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::readInImg(uint8_t* inImgPtr){
+   bool result{false};
+
+   if((_inSrQty > 0) && (inImgPtr != nullptr)){
+      _readInImg(0, _inSrQty, inImgPtr);
+      result = true;
+   }
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR ShiftRegGPIOXpander::_recTrcFrm(){
+   const uint32_t strtCycles{ESP.getCycleCount()};
+   const uint32_t tmStmp{static_cast<uint32_t>(esp_timer_get_time())};
+   const uint32_t tskHndl{static_cast<uint32_t>(reinterpret_cast<uintptr_t>(xTaskGetCurrentTaskHandle()))};
+   uint8_t diffsQty{0};
+
+   memcpy(_trcRecPtr, &tmStmp, 4);
+   memcpy(_trcRecPtr + 4, &tskHndl, 4);
+   *(_trcRecPtr + 8) = static_cast<uint8_t>(_trcApi);
+   for(uint8_t ptrInc{0}; ptrInc < _srQty; ptrInc++){
+      const uint8_t diffBits = *(_trcCurFrmPtr + ptrInc) ^ *(_trcPrvFrmPtr + ptrInc);
+
+      if(diffBits != 0x00){
+         *(_trcRecPtr + 10 + 2 * diffsQty) = ptrInc;
+         *(_trcRecPtr + 11 + 2 * diffsQty) = diffBits;
+         *(_trcPrvFrmPtr + ptrInc) = *(_trcCurFrmPtr + ptrInc);
+         diffsQty++;
+      }
+   }
+   *(_trcRecPtr + 9) = diffsQty;
+
+   const uint32_t recSize{10 + 2 * static_cast<uint32_t>(diffsQty)};
+   const uint32_t trcSeq{__atomic_load_n(&_trcSeq, __ATOMIC_RELAXED)};
+
+   __atomic_store_n(&_trcSeq, trcSeq + 1, __ATOMIC_RELAXED);
+   __atomic_thread_fence(__ATOMIC_RELEASE);
+   while((_trcRngSize - _trcUsed) < recSize){   // The oldest records are evicted, their changes are folded into the base frame
+      const uint8_t oldDiffsQty{*(_trcRngPtr + ((_trcTail + 9) % _trcRngSize))};
+      const uint32_t oldRecSize{10 + 2 * static_cast<uint32_t>(oldDiffsQty)};
+
+      for(uint8_t diffInc{0}; diffInc < oldDiffsQty; diffInc++)
+         *(_trcBaseFrmPtr + *(_trcRngPtr + ((_trcTail + 10 + 2 * diffInc) % _trcRngSize))) ^= *(_trcRngPtr + ((_trcTail + 11 + 2 * diffInc) % _trcRngSize));
+      _trcTail = (_trcTail + oldRecSize) % _trcRngSize;
+      _trcUsed -= oldRecSize;
+      _trcLostQty++;
+   }
+
+   const uint32_t recHead{(_trcTail + _trcUsed) % _trcRngSize};
+   const uint32_t frstQty{((_trcRngSize - recHead) < recSize)?(_trcRngSize - recHead):recSize};
+
+   memcpy(_trcRngPtr + recHead, _trcRecPtr, frstQty);
+   memcpy(_trcRngPtr, _trcRecPtr + frstQty, recSize - frstQty);
+   _trcUsed += recSize;
+   __atomic_store_n(&_trcSeq, trcSeq + 2, __ATOMIC_RELEASE);
+
+   const uint32_t recCycles{ESP.getCycleCount() - strtCycles};
+   if(recCycles > _trcWrstCycles)
+      _trcWrstCycles = recCycles;
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::_releasePins(const uint8_t* pinsMskPtr){
+   bool result{false};
+
+   if(pinsMskPtr != nullptr){
+      taskENTER_CRITICAL(&_SRGXOwnrshpMux);
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+         __atomic_and_fetch(_pinOwnrshpPtr + ptrInc, static_cast<uint8_t>(~(*(pinsMskPtr + ptrInc))), __ATOMIC_RELEASE);
+      taskEXIT_CRITICAL(&_SRGXOwnrshpMux);
+      result = true;
+   }
+
+   return result;
+}
+
+void ShiftRegGPIOXpander::_releaseObsRsrcs(){
+   delete [] _obsItemPtr;
+   _obsItemPtr = nullptr;
+   delete [] _obsRcvdPtr;
+   _obsRcvdPtr = nullptr;
+
+   return;
+}
+
+void ShiftRegGPIOXpander::_releaseTrcRsrcs(){
+   delete [] _trcBaseFrmPtr;
+   _trcBaseFrmPtr = nullptr;
+   delete [] _trcPrvFrmPtr;
+   _trcPrvFrmPtr = nullptr;
+   delete [] _trcCurFrmPtr;
+   _trcCurFrmPtr = nullptr;
+   delete [] _trcRecPtr;
+   _trcRecPtr = nullptr;
+   _trcRngSize = 0;
+
+   return;
+}
+
+bool ShiftRegGPIOXpander::_reqAsyncFlush(uint32_t &wrtSeq, const uint8_t* bffrIdxPtr, const uint8_t* mskPtr, const uint8_t* valsPtr, const uint8_t &bytesQty){
+   uint8_t asyncTskSt{0};
+   bool result{false};
+
+   if(__atomic_compare_exchange_n(&_asyncTskSt, &asyncTskSt, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)){ // First asynchronous write, create the flushing task
+      if(_asyncWtrsPtr == nullptr)
+         _asyncWtrsPtr = new SRGXAsyncWtr[_maxAsyncWtrsQty];
+      if(_asyncWrtsSeqPtr == nullptr){
+         _asyncWrtsSeqPtr = new uint32_t[_asyncWrtsDpth]{};
+         _asyncWrtsMskPtr = new uint8_t[_asyncWrtsDpth * _srQty]{};
+         _asyncWrtsValsPtr = new uint8_t[_asyncWrtsDpth * _srQty]{};
+      }
+      if(xTaskCreate(_asyncTsk, "SRGXAsyncTsk", 2048, this, _asyncTskPrrty, &_asyncTskHndl) == pdPASS)
+         asyncTskSt = 2;
+      else
+         _asyncTskHndl = nullptr;
+      __atomic_store_n(&_asyncTskSt, asyncTskSt, __ATOMIC_RELEASE);
+   }
+   while(asyncTskSt == 1){ // Other task is creating the flushing task
+      vTaskDelay(1);
+      asyncTskSt = __atomic_load_n(&_asyncTskSt, __ATOMIC_ACQUIRE);
+   }
+   if(asyncTskSt == 2){
+      if(mskPtr == nullptr)   // Lock-free write, already applied to the Main Buffer
+         wrtSeq = __atomic_add_fetch(&_lckFreeWrtSeq, 1, __ATOMIC_ACQ_REL);
+      else{
+         bool queued{false};
+
+         while(!queued){
+            taskENTER_CRITICAL(&_asyncWrtsMux);
+            if(_asyncWrtsQty < _asyncWrtsDpth){
+               const uint8_t slot = (_asyncWrtsHd + _asyncWrtsQty) % _asyncWrtsDpth;
+               uint8_t* slotMskPtr{_asyncWrtsMskPtr + (slot * _srQty)};
+               uint8_t* slotValsPtr{_asyncWrtsValsPtr + (slot * _srQty)};
+
+               memset(slotMskPtr, 0x00, _srQty);
+               memset(slotValsPtr, 0x00, _srQty);
+               for(uint8_t ptrInc{0}; ptrInc < bytesQty; ptrInc++){
+                  const uint8_t bffrIdx{(bffrIdxPtr != nullptr)?*(bffrIdxPtr + ptrInc):ptrInc};
+
+                  *(slotMskPtr + bffrIdx) |= *(mskPtr + ptrInc);
+                  *(slotValsPtr + bffrIdx) = (*(slotValsPtr + bffrIdx) & ~*(mskPtr + ptrInc)) | (*(valsPtr + ptrInc) & *(mskPtr + ptrInc));
+               }
+               wrtSeq = __atomic_add_fetch(&_lckFreeWrtSeq, 1, __ATOMIC_ACQ_REL);  // Sequenced in the queue order, see _sendChainCntnt()
+               *(_asyncWrtsSeqPtr + slot) = wrtSeq;
+               _asyncWrtsQty++;
+               queued = true;
+            }
+            taskEXIT_CRITICAL(&_asyncWrtsMux);
+            if(!queued){   // The queue is full, wait for the flushing task to apply the oldest write
+               xTaskNotifyGive(_asyncTskHndl);
+               vTaskDelay(1);
+            }
+         }
+      }
+      xTaskNotifyGive(_asyncTskHndl);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::_reservePins(const uint8_t* pinsMskPtr){
+   bool result{false};
+
+   if(pinsMskPtr != nullptr){
+      result = true;
+      taskENTER_CRITICAL(&_SRGXOwnrshpMux);
+      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++){
+         if(*(_pinOwnrshpPtr + ptrInc) & *(pinsMskPtr + ptrInc)){ // At least one of the pins is already reserved, the ports are not disjoint
+            result = false;
+            break;
+         }
+      }
+      if(result){
+         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            __atomic_or_fetch(_pinOwnrshpPtr + ptrInc, *(pinsMskPtr + ptrInc), __ATOMIC_RELEASE);
+      }
+      taskEXIT_CRITICAL(&_SRGXOwnrshpMux);
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::removeObserver(SRGXObsCb cb, void* argp){
+   bool result{false};
+
+   taskENTER_CRITICAL(&_obsMux);
+   for(uint8_t obsInc{0}; !result && (obsInc < _obsRegsQty); obsInc++){
+      if((_obsRegs[obsInc].cb == cb) && (_obsRegs[obsInc].argp == argp)){
+         _obsRegs[obsInc] = _obsRegs[_obsRegsQty - 1];
+         _obsRegsQty--;
+         result = true;
+      }
+   }
+   taskEXIT_CRITICAL(&_obsMux);
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::resetBit(const uint8_t &srPin){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin)
+      result = digitalWriteSr(srPin, LOW); // Set the pin to LOW
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::resetBit(const SRGXPinDsc &pinDsc){
+
+   return digitalWriteSr(pinDsc, LOW);
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_sendAllSRCntnt(const SRGXTrcApi &trcApi){
+   bool result{false};
+
+   _trcApi = trcApi; // Identifies the API method requesting the flush in the trace records, the flush might be done by another object's bus flush
+   if(_busPtr != nullptr)
+      result = _busPtr->_flush(this);
+   else
+      result = _sendChainCntnt();
+
+   return result;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_sendChainCntnt(){
+   bool result{false};
+
+   if((_srQty > 0) && (_mainBuffrArryPtr != nullptr)){
+      const int64_t flshStrtTm{esp_timer_get_time()};
+      const uint8_t* outImgPtr{_mainBuffrArryPtr};
+      uint32_t deadTmUs{0};
+
+      if(_asyncWrtsSeqPtr != nullptr){ // A write queued and not applied yet is not included, nor the ones sequenced after it
+         taskENTER_CRITICAL(&_asyncWrtsMux);
+         _flshdWrtSeq = (_asyncWrtsQty == 0)?__atomic_load_n(&_lckFreeWrtSeq, __ATOMIC_ACQUIRE):(*(_asyncWrtsSeqPtr + _asyncWrtsHd) - 1);
+         taskEXIT_CRITICAL(&_asyncWrtsMux);
+      }
+      else
+         _flshdWrtSeq = __atomic_load_n(&_lckFreeWrtSeq, __ATOMIC_ACQUIRE); // Every lock-free write sequenced up to this point will be included in this flush
+      if(_lgclCurFrmPtr != nullptr){   // The logical frame shifted out is kept, to be validated against the interlock groups and compared against the preceding one once latched
+         for(int wrdInc{0}; wrdInc < ((_srQty + 3) / 4); wrdInc++)
+            *(reinterpret_cast<uint32_t*>(_lgclCurFrmPtr) + wrdInc) = __atomic_load_n(reinterpret_cast<uint32_t*>(_mainBuffrArryPtr) + wrdInc, __ATOMIC_RELAXED);
+         outImgPtr = _lgclCurFrmPtr;
+         if((_ilcksQty > 0) && _applyIlcks(deadTmUs)){
+            _shiftOutFrm(_ilckBrkFrmPtr); // Break-before-make, the interlocked pins being reset are latched before the ones being set
+            if(deadTmUs > _maxIlckSpinUs)
+               vTaskDelay(((deadTmUs + (portTICK_PERIOD_MS * 1000) - 1) / (portTICK_PERIOD_MS * 1000)) + 1);  // A vTaskDelay(n) might last just over (n - 1) ticks, one more tick ensures the dead time
+            else if(deadTmUs > 0)
+               SRGX_DLY_US(deadTmUs);
+         }
+      }
+      _shiftOutFrm(outImgPtr);
+      if(_lgclCurFrmPtr != nullptr){
+         uint8_t* frmPtr{_lgclPrvFrmPtr};
+
+         if(_obsEn)
+            _postObsDiff(true);  // The observers are notified by their own task, the flush only queues the changes
+         _lgclPrvFrmPtr = _lgclCurFrmPtr; // The frame latched becomes the preceding one
+         _lgclCurFrmPtr = frmPtr;
+      }
+      __atomic_store_n(&_ltchdWrtSeq, _flshdWrtSeq, __ATOMIC_SEQ_CST);  // The asynchronous writes included are latched
+      if((__atomic_load_n(&_asyncWtrsQty, __ATOMIC_SEQ_CST) > 0) && (_asyncTskHndl != nullptr))
+         xTaskNotifyGive(_asyncTskHndl);  // The flushing task signals the waiters
+      if(_stTskHndl != nullptr)
+         xTaskNotifyGive(_stTskHndl);  // The state persisting task coalesces the latched images and saves them
+      const uint32_t flshTm{static_cast<uint32_t>(esp_timer_get_time() - flshStrtTm)};
+      if(flshTm > _flshWrstUs)
+         _flshWrstUs = flshTm;
+      if(_inSrQty > 0){ // Publish the captured inputs to the Input Image under the seqlock
+         const uint32_t inImgSeq{__atomic_load_n(&_inImgSeq, __ATOMIC_RELAXED)};
+
+         __atomic_store_n(&_inImgSeq, inImgSeq + 1, __ATOMIC_RELAXED);
+         __atomic_thread_fence(__ATOMIC_RELEASE);
+         for(int inBffrIdx{0}; inBffrIdx < _inSrQty; inBffrIdx++)
+            __atomic_store_n(_inBffrArryPtr + inBffrIdx, *(_inStgBffrPtr + inBffrIdx), __ATOMIC_RELAXED);
+         __atomic_store_n(&_inImgSeq, inImgSeq + 2, __ATOMIC_RELEASE);
+      }
+      result = true;
+   }
+
+   return result;
+}
+
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_sendSnglSRCntnt(const uint8_t &data, uint8_t* rcvdDataPtr, uint8_t* lpbkDataPtr){  
+   uint8_t mask{0x80};
+   uint8_t rcvdData{0};
+   uint8_t lpbkData{0};
+   bool result{true};
+
+   for (int bitPos {7}; bitPos >= 0; bitPos--){   //Send each of the bits corresponding to one 8-bits shift register module
+      SRGX_PIN_WRT(_sh_cp, LOW); // Start of next bit value addition to the shift register internal buffer -> Lower the clock pin         
+      SRGX_PIN_WRT(_ds, (data & mask)?HIGH:LOW);
+      mask >>= 1; // Shift the mask to the right to get the next bit value
+      if(_bitDlyUs > 0)
+         SRGX_DLY_US(_bitDlyUs);  // Time required by the 74HCx595 to modify the SH_CP line, 10 us by datasheet unless calibrated, see calibrateBitDelay()
+      /* 
+      delayMicroseconds(_bitDlyUs) Equivalent:
+         uint64_t micros = esp_timer_get_time();
+         while((esp_timer_get_time() - micros) < _bitDlyUs){}; // Wait for the time required by the 74HCx595 to modify the SH_CP line by datasheet
+      */
+      if(rcvdDataPtr != nullptr)
+         rcvdData = (rcvdData << 1) | ((SRGX_PIN_RD(_qh))?0x01:0x00);  // The 74HCx165 QH output is stable before the rising edge that shifts the next bit
+      if(lpbkDataPtr != nullptr)
+         lpbkData = (lpbkData << 1) | ((SRGX_PIN_RD(_lpbkPin))?0x01:0x00);  // The 74HCx595 QH' output holds the bit shifted in getSrQty() * 8 clocks before
+      SRGX_PIN_WRT(_sh_cp, HIGH);   // End of next bit value addition to the shift register internal buffer -> Lower the clock pin      
+   }
+   if(rcvdDataPtr != nullptr)
+      *rcvdDataPtr = rcvdData;
+   if(lpbkDataPtr != nullptr)
+      *lpbkDataPtr = lpbkData;
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::resetFlushStats(){
+   bool result{false};
+
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      _flshWrstUs = 0;
+      _flshCrtclWrstUs = 0;
+      xSemaphoreGive(_SRGXMnBffrMtx);
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::resetMany(const uint8_t* pinsPtr, const size_t &pinsQty){
+
+   return _applyPinsLst(_lstReset, nullptr, pinsPtr, pinsQty, trcApiResetMany);
+}
+
+bool ShiftRegGPIOXpander::_rmvAsyncWtr(TaskHandle_t tskHndl, void* crtnAddr){
+   bool result{false};
+
+   if(_asyncWtrsPtr != nullptr){
+      taskENTER_CRITICAL(&_asyncMux);
+      for(uint8_t wtrInc{0}; !result && (wtrInc < _asyncWtrsQty); wtrInc++){
+         if(((_asyncWtrsPtr + wtrInc)->tskHndl == tskHndl) && ((_asyncWtrsPtr + wtrInc)->crtnAddr == crtnAddr)){
+            *(_asyncWtrsPtr + wtrInc) = *(_asyncWtrsPtr + _asyncWtrsQty - 1);
+            __atomic_store_n(&_asyncWtrsQty, _asyncWtrsQty - 1, __ATOMIC_SEQ_CST);
+            result = true;
+         }
+      }
+      taskEXIT_CRITICAL(&_asyncMux);
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::setAsyncTskPrrty(const BaseType_t &asyncTskPrrty){
+   bool result{false};
+
+   if((asyncTskPrrty > 0) && (asyncTskPrrty < configMAX_PRIORITIES)){
+      _asyncTskPrrty = asyncTskPrrty;
+      result = true;
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::setBit(const uint8_t &srPin){
+   bool result{false};
+
+   if(srPin <= _maxSRGXPin)
+      result = digitalWriteSr(srPin, HIGH); // Set the pin to HIGH
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::setBit(const SRGXPinDsc &pinDsc){
 
-   return result;
+   return digitalWriteSr(pinDsc, HIGH);
 }
 
-bool ShiftRegGPIOXpander::digitalToggleSr(const uint8_t &srPin){
+bool ShiftRegGPIOXpander::setBitDelay(const uint32_t &bitDlyUs){
    bool result{false};
 
-   if(srPin <= _maxSRGXPin){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         *(_mainBuffrArryPtr + (srPin / 8)) ^= (0x01 << (srPin % 8));
-         _sendAllSRCntnt();
+   if(bitDlyUs <= _maxBitDlyUs){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _bitDlyUs = bitDlyUs;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         _bitDlyUs = bitDlyUs;
+         _flshRegTmUs = 0; // The register time is measured again at the new rate
          xSemaphoreGive(_SRGXMnBffrMtx);
-         result = true;  //!< The operation was successful, the pin was toggled in the Main Buffer
+         result = true;
       }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalToggleSrAll(){
+bool ShiftRegGPIOXpander::setBrightness(const uint32_t &brightness){
    bool result{false};
 
-   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
-         if(_auxBuffrArryPtr != nullptr)
-            _moveAuxToMain();
-         xSemaphoreGive(_SRGXAuxBffrMtx);
+   if((_oeLedcChnl != 0xFF) && (brightness <= _oeMaxDuty)){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){   // No flush is blanking the outputs, so the duty set is not overwritten by it
+         _oeBrghtns = brightness;
+         SRGX_LEDC_WRT(_oe, _oeLedcChnl, _oeMaxDuty - _oeBrghtns);
+         xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
       }
-      for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
-         *(_mainBuffrArryPtr + ptrInc) ^= 0xFF;
-      _sendAllSRCntnt();
-      xSemaphoreGive(_SRGXMnBffrMtx);
-      result = true;  
    }
-   
+
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalToggleSrMask(uint8_t *toggleMask){
-   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+bool ShiftRegGPIOXpander::setFlushPolicy(const SRGXFlushPolicy &flshPolicy, const uint32_t &maxCrtclUs){
    bool result{false};
 
-   if(toggleMask != nullptr){
-      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid toggleMask being modified while the copy operation is being performed
-      uint8_t* localToggleMask = new uint8_t[_srQty];
-      memcpy(localToggleMask, toggleMask, _srQty);
-      taskEXIT_CRITICAL(&mux);   // Exit critical section
-
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
-            *(_mainBuffrArryPtr + ptrInc) ^= *(localToggleMask + ptrInc);
-         _sendAllSRCntnt();
+   if(flshPolicy <= flshWholeFrame){
+      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){   // No flushing is in progress while the policy is modified
+         _flshPolicy = flshPolicy;
+         _flshMaxCrtclUs = (flshPolicy == flshWholeFrame)?((maxCrtclUs > 0)?maxCrtclUs:_dfltFlshMaxCrtclUs):0;  // The whole frame critical section is never left unbounded
+         _flshWrstUs = 0;
+         _flshCrtclWrstUs = 0;
          xSemaphoreGive(_SRGXMnBffrMtx);
-         result = true;  //!< The operation was successful, the pins were toggled in the Main Buffer
+         result = true;
       }
-      delete [] localToggleMask;
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalToggleSrToAux(const uint8_t &srPin){
+bool ShiftRegGPIOXpander::setLoopbackCheck(const uint8_t &lpbkPin, const uint32_t &chkPrdFlshs){
    bool result{false};
-
-   if(srPin <= _maxSRGXPin){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            if(_auxBuffrArryPtr == nullptr)
-               _copyMainToAux();
-            *(_auxBuffrArryPtr + (srPin / 8)) ^= (0x01 << (srPin % 8));
-            result = true;  
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         xSemaphoreGive(_SRGXMnBffrMtx);
+   bool mainTkn{_SRGXMnBffrMtx == nullptr}; // Not begun, there's no flushing to synchronize with
+
+   if(!mainTkn)
+      mainTkn = (xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE);
+   if(mainTkn){
+      if(_lpbkPinVld(lpbkPin)){
+         if(_lpbkExpPtr == nullptr)
+            _lpbkExpPtr = new uint8_t [_srQty]{};
+         pinMode(lpbkPin, INPUT);
+         _lpbkPin = lpbkPin;
+         _lpbkChkPrd = chkPrdFlshs;
+         _lpbkChkCnt = 0;
+         _lpbkExpVld = false; // The frame held by the chain is recorded by the next flush
+         result = true;
       }
+      if(_SRGXMnBffrMtx != nullptr)
+         xSemaphoreGive(_SRGXMnBffrMtx);
    }
 
    return result;
 }
 
-void ShiftRegGPIOXpander::digitalWrite(const uint8_t &srPin, const uint8_t &value){
-   digitalWriteSr(srPin, value);
+bool ShiftRegGPIOXpander::setMany(const uint8_t* pinsPtr, const size_t &pinsQty){
 
-   return;
+   return _applyPinsLst(_lstSet, nullptr, pinsPtr, pinsQty, trcApiSetMany);
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSr(const uint8_t &srPin, const uint8_t &value){
+bool ShiftRegGPIOXpander::setOEBlanking(const bool &blankDuringFlush){
    bool result{false};
 
-   if(srPin <= _maxSRGXPin){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){         
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         if(value)
-            *(_mainBuffrArryPtr + (srPin / 8)) |= (0x01 << (srPin % 8));
-         else
-            *(_mainBuffrArryPtr + (srPin / 8)) &= ~(0x01 << (srPin % 8));
-         _sendAllSRCntnt();
-         result = true;  
+   if(_oe != 0xFF){
+      if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+         _oeBlnkFlsh = blankDuringFlush;
+         result = true;
+      }
+      else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         _oeBlnkFlsh = blankDuringFlush;
          xSemaphoreGive(_SRGXMnBffrMtx);
+         result = true;
       }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSrAllReset(){
+bool ShiftRegGPIOXpander::setOEPin(const uint8_t &oe){
    bool result{false};
 
-   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(_auxBuffrArryPtr != nullptr)   //!< Although the discardAux() method makes this check, it is better to do it here to avoid unnecessary calls to the method
-            _discardAux();
-         xSemaphoreGive(_SRGXAuxBffrMtx);
-      }
-      memset(_mainBuffrArryPtr,0x00, _srQty);
-      _sendAllSRCntnt();
-      xSemaphoreGive(_SRGXMnBffrMtx);
-      result = true;  
+   if(_SRGXMnBffrMtx == nullptr){  // Not begun, the pin is driven by begin()
+      _oe = oe;
+      result = true;
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSrAllSet(){
+bool ShiftRegGPIOXpander::setPinsRemap(const uint8_t* physPinsPtr, const bool &bitRvrs){
    bool result{false};
 
-   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(_auxBuffrArryPtr != nullptr)   //!< Although the discardAux() method makes this check, it is better to do it here to avoid unnecessary calls to the method
-            _discardAux();
-         xSemaphoreGive(_SRGXAuxBffrMtx);
-      }
-      memset(_mainBuffrArryPtr,0xFF, _srQty);
-      _sendAllSRCntnt();
-      xSemaphoreGive(_SRGXMnBffrMtx);
+   if((_srQty > 0) && ((physPinsPtr != nullptr) || bitRvrs)){
+      const uint16_t pinsQty{static_cast<uint16_t>(_maxSRGXPin + 1)};
+      uint8_t* physPinsLstPtr = new uint8_t [pinsQty]{};
+      uint8_t* usedPinsMskPtr = new uint8_t [_srQty]{};
+      bool isIdntty{true};
+
       result = true;
+      for(uint16_t lgclPin{0}; (lgclPin < pinsQty) && result; lgclPin++){  // The physical pins must be a permutation of the pins range
+         uint8_t physPin{static_cast<uint8_t>((physPinsPtr != nullptr)?*(physPinsPtr + lgclPin):lgclPin)};
+
+         if((physPin > _maxSRGXPin) || (*(usedPinsMskPtr + (physPin / 8)) & (0x01 << (physPin % 8))))
+            result = false;
+         else{
+            *(usedPinsMskPtr + (physPin / 8)) |= (0x01 << (physPin % 8));
+            if(bitRvrs)
+               physPin = (physPin & 0xF8) | (7 - (physPin % 8));
+            *(physPinsLstPtr + lgclPin) = physPin;
+            if(physPin != lgclPin)
+               isIdntty = false;
+         }
+      }
+      if(result){
+         SRGXRemapReg* newRmpRegsPtr{nullptr};
+         uint16_t newRmpRegsQty{0};
+
+         if(!isIdntty){
+            for(int pass{0}; pass < 2; pass++){ // The first pass counts the logical and physical registers pairs, the second one builds their tables
+               if(pass == 1)
+                  newRmpRegsPtr = new SRGXRemapReg [newRmpRegsQty]{};
+               newRmpRegsQty = 0;
+               for(uint8_t lgclIdx{0}; lgclIdx < _srQty; lgclIdx++){
+                  const uint16_t frstRmpRegIdx{newRmpRegsQty};
+                  uint8_t physIdxLst[8]{}; // Physical registers of the logical register, 8 at most
+
+                  for(uint8_t bitPos{0}; bitPos < 8; bitPos++){
+                     const uint8_t physPin{*(physPinsLstPtr + (lgclIdx * 8) + bitPos)};
+                     uint16_t rmpRegIdx{frstRmpRegIdx};
+
+                     if(pass == 0){
+                        while((rmpRegIdx < newRmpRegsQty) && (physIdxLst[rmpRegIdx - frstRmpRegIdx] != (physPin / 8)))
+                           rmpRegIdx++;
+                        if(rmpRegIdx == newRmpRegsQty){
+                           physIdxLst[rmpRegIdx - frstRmpRegIdx] = physPin / 8;
+                           newRmpRegsQty++;
+                        }
+                     }
+                     else{
+                        while((rmpRegIdx < newRmpRegsQty) && ((newRmpRegsPtr + rmpRegIdx)->physIdx != (physPin / 8)))
+                           rmpRegIdx++;
+                        if(rmpRegIdx == newRmpRegsQty){
+                           (newRmpRegsPtr + rmpRegIdx)->lgclIdx = lgclIdx;
+                           (newRmpRegsPtr + rmpRegIdx)->physIdx = physPin / 8;
+                           newRmpRegsQty++;
+                        }
+                        for(uint8_t nblVal{0}; nblVal < 16; nblVal++){
+                           if(nblVal & (0x01 << (bitPos % 4)))
+                              (newRmpRegsPtr + rmpRegIdx)->rmpTbl[bitPos / 4][nblVal] |= (0x01 << (physPin % 8));
+                        }
+                     }
+                  }
+               }
+            }
+            if(_physImgPtr == nullptr)
+               _physImgPtr = new uint8_t [_srQty]{};
+         }
+         if(_SRGXMnBffrMtx == nullptr){   // Not begun, there's no flushing to synchronize with
+            SRGXRemapReg* oldRmpRegsPtr{_rmpRegsPtr};
+
+            _rmpRegsPtr = newRmpRegsPtr;
+            _rmpRegsQty = newRmpRegsQty;
+            newRmpRegsPtr = oldRmpRegsPtr;
+         }
+         else if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+            SRGXRemapReg* oldRmpRegsPtr{_rmpRegsPtr};
+
+            if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){   // The writes queued before are applied first, see _drainAsyncWrts()
+               _drainAsyncWrts();
+               xSemaphoreGive(_SRGXAuxBffrMtx);
+            }
+            _rmpRegsPtr = newRmpRegsPtr;
+            _rmpRegsQty = newRmpRegsQty;
+            newRmpRegsPtr = oldRmpRegsPtr;
+            _sendAllSRCntnt(trcApiSetPinsRemap);   // The outputs are set to the new wiring immediately
+            xSemaphoreGive(_SRGXMnBffrMtx);
+         }
+         else
+            result = false;
+         if(newRmpRegsPtr != nullptr)  // The replaced tables, or the new ones if they could not be set
+            delete [] newRmpRegsPtr;
+      }
+      delete [] usedPinsMskPtr;
+      delete [] physPinsLstPtr;
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSrMaskReset(uint8_t* resetMask){
-   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+bool ShiftRegGPIOXpander::setStateStore(SRGXStateStore* storePtr, const uint32_t &coalesceMs){
    bool result{false};
 
-   if(resetMask != nullptr){
-      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid resetMask being modified while the operation is being performed
-      uint8_t* localResetMask = new uint8_t[_srQty];
-      memcpy(localResetMask, resetMask, _srQty);
-      taskEXIT_CRITICAL(&mux);   // Exit critical section
+   if((_SRGXMnBffrMtx == nullptr) && (storePtr != nullptr)){  // Not begun, the image is restored by begin()
+      _stStorePtr = storePtr;
+      _stCoalesceMs = coalesceMs;
+      result = true;
+   }
 
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-         }
-         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
-            *(_mainBuffrArryPtr + ptrInc) &= ~(*(localResetMask + ptrInc));
-         _sendAllSRCntnt();
-         delete [] localResetMask;
-         xSemaphoreGive(_SRGXMnBffrMtx);
-         result = true;  
-      }      
+   return result;
+}
+
+SRGXAsyncHndl ShiftRegGPIOXpander::stampAsync(uint8_t* maskPtr, uint8_t* valsPtr){
+   SRGXAsyncHndl result{};
+   uint32_t wrtSeq{0};
+
+   if((maskPtr != nullptr) && (valsPtr != nullptr) && (_mainBuffrArryPtr != nullptr) && (_SRGXMnBffrMtx != nullptr)){
+      if(_reqAsyncFlush(wrtSeq, nullptr, maskPtr, valsPtr, _srQty))
+         result = SRGXAsyncHndl(this, wrtSeq);
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSrMaskSet(uint8_t* setMask){
+bool ShiftRegGPIOXpander::stampMaskOverMain(uint8_t* maskPtr, uint8_t* valsPtr){
    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-   bool result{false};
+   bool result{false};  
 
-   if(setMask != nullptr){
-      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching, to avoid resetMask being modified while the operation is being performed
-      uint8_t* localSetMask = new uint8_t[_srQty];
-      memcpy(localSetMask, setMask, _srQty);
+   if((maskPtr != nullptr) && (valsPtr != nullptr)){
+      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching
+      uint8_t* localMaskPtr = new uint8_t[_srQty];
+      memcpy(localMaskPtr, maskPtr, _srQty);
+      uint8_t* localValsPtr = new uint8_t[_srQty];
+      memcpy(localValsPtr, valsPtr, _srQty);
       taskEXIT_CRITICAL(&mux);   // Exit critical section
 
       if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
          if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
             if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain();
+               _moveAuxToMain(trcApiStampMaskOverMain); // Move the Auxiliary Buffer to the Main Buffer, if it exists      
             xSemaphoreGive(_SRGXAuxBffrMtx);
          }
          for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
-            *(_mainBuffrArryPtr + ptrInc) |= *(localSetMask + ptrInc);
-         _sendAllSRCntnt();
-         delete [] localSetMask;
+            _mainUnrsrvdWrt(ptrInc, *(localMaskPtr + ptrInc), *(localValsPtr + ptrInc)); // The bits set in the mask take the value from the values array, the rest remain unchanged
+         _sendAllSRCntnt(trcApiStampMaskOverMain); // Flush the Main Buffer to the shift registers
          xSemaphoreGive(_SRGXMnBffrMtx);
-         result = true;  
+         result = true; // If the parameters were valid, the operation was successful
       }
+      delete [] localMaskPtr; // Free the memory allocated for the local mask
+      delete [] localValsPtr; // Free the memory allocated for the local values
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::digitalWriteSrToAux(const uint8_t srPin, const uint8_t value){
+bool ShiftRegGPIOXpander::stampMaskOverSnapshot(const uint8_t &slot, uint8_t* maskPtr, uint8_t* valsPtr){
    bool result{false};
 
-   if(srPin <= _maxSRGXPin){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            if(_auxBuffrArryPtr == nullptr)
-               _copyMainToAux();
-            if(value)
-               *(_auxBuffrArryPtr + (srPin / 8)) |= (0x01 << (srPin % 8));
-            else
-               *(_auxBuffrArryPtr + (srPin / 8)) &= ~(0x01 << (srPin % 8));
-            xSemaphoreGive(_SRGXAuxBffrMtx);
-            result = true;
-         }
-         xSemaphoreGive(_SRGXMnBffrMtx);
+   if((maskPtr != nullptr) && (valsPtr != nullptr)){
+      if(_takeSnpsht(slot)){
+         uint8_t* slotPtr{*(_snpshtSlotsPtr + slot)};
+
+         for(int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            *(slotPtr + ptrInc) = (*(slotPtr + ptrInc) & ~(*(maskPtr + ptrInc))) | (*(valsPtr + ptrInc) & *(maskPtr + ptrInc));
+         xSemaphoreGive(_SRGXSnpshtMtx);
+         result = true;
       }
    }
 
    return result;
 }
 
-void ShiftRegGPIOXpander::_discardAux(){
-   if(_auxBuffrArryPtr != nullptr){
-      delete [] _auxBuffrArryPtr;
-      _auxBuffrArryPtr = nullptr;
-   }
-   
-   return;
-}
-
-bool ShiftRegGPIOXpander::discardAux(){
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_shiftOutFrm(const uint8_t* lgclFrmPtr){
+   const int xfrQty{(_inSrQty > _srQty)?_inSrQty:_srQty};   // Bytes clocked, the longest of the output and input chains
+   const uint8_t* outImgPtr{lgclFrmPtr};
+   uint8_t curSRcntnt{0};
+   int srBuffDsplcPtr{xfrQty - 1};
+   bool lpbkChk{false};
+   bool lpbkErr{false};
    bool result{false};
 
-   if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-      if(_auxBuffrArryPtr != nullptr){
-         delete [] _auxBuffrArryPtr;
-         _auxBuffrArryPtr = nullptr;
+   if((_lpbkChkPrd > 0) && (_busPtr == nullptr) && _lpbkExpVld){   // The chain holds the frame shifted in by the preceding bit train, it's shifted out through QH' by this one
+      if(++_lpbkChkCnt >= _lpbkChkPrd){
+         _lpbkChkCnt = 0;
+         lpbkChk = true;
       }
-      xSemaphoreGive(_SRGXAuxBffrMtx);
-      result = true;  
    }
-   
-   return result;
-}
-
-void ShiftRegGPIOXpander::end(){
-
-   return;
-}
-
-bool ShiftRegGPIOXpander::flipBit(const uint8_t &srPin){
-   bool result{false};
-
-   if(srPin <= _maxSRGXPin){
-      digitalToggleSr(srPin); // Toggle the pin state at position srPin
-      result = true;
+   if(_rmpRegsPtr != nullptr){   // The logical image is transformed before the bit train, so the remapping adds no time to the critical sections
+      _buildPhysImg(lgclFrmPtr);
+      outImgPtr = _physImgPtr;
+   }
+   if(_inSrQty > 0){ // Parallel load the inputs into the 74HCx165 chain, to be shifted in by the same clock train that shifts the outputs
+      SRGX_PIN_WRT(_sh_ld, LOW);
+      SRGX_PIN_WRT(_sh_ld, HIGH);
+   }
+   if(_oeBlnkFlsh)
+      _blankOE(true);   // The intermediate shift states do not reach the outputs
+   SRGX_PIN_WRT(_st_cp, LOW); // Start of access to the shift register internal buffer to write -> Lower the latch pin
+   while(srBuffDsplcPtr >= 0){   // The bit train is sent in chunks of registers, each chunk inside a critical section unless the policy is flshPreemptible
+      int chnkQty{1};
+
+      if(_flshPolicy == flshPreemptible)
+         chnkQty = srBuffDsplcPtr + 1;
+      else if(_flshPolicy == flshWholeFrame){
+         chnkQty = srBuffDsplcPtr + 1;
+         if(_flshMaxCrtclUs > 0){
+            if(_flshRegTmUs == 0)   // The register time is not measured yet, a single register chunk measures it
+               chnkQty = 1;
+            else if((_flshMaxCrtclUs / _flshRegTmUs) < static_cast<uint32_t>(chnkQty))
+               chnkQty = (_flshMaxCrtclUs < _flshRegTmUs)?1:(_flshMaxCrtclUs / _flshRegTmUs);
+         }
+      }
+      if(_flshPolicy != flshPreemptible)
+         taskENTER_CRITICAL(&_flshMux);
+      const int64_t chnkStrtTm{esp_timer_get_time()};
+      for(int chnkInc{0}; chnkInc < chnkQty; chnkInc++, srBuffDsplcPtr--){
+         const int inBffrIdx{xfrQty - 1 - srBuffDsplcPtr};  // The input chain delivers first the register nearest to the MCU
+
+         curSRcntnt = (srBuffDsplcPtr < _srQty)?*(outImgPtr + srBuffDsplcPtr):0x00;  // Padding bytes are sent first, and shifted out of the output chain
+         if((_trcRngPtr != nullptr) && (srBuffDsplcPtr < _srQty))
+            *(_trcCurFrmPtr + srBuffDsplcPtr) = curSRcntnt;
+         if(lpbkChk && (inBffrIdx < _srQty)){
+            uint8_t lpbkData{0};
+
+            result = _sendSnglSRCntnt(curSRcntnt, (inBffrIdx < _inSrQty)?(_inStgBffrPtr + inBffrIdx):nullptr, &lpbkData);
+            if(lpbkData != *(_lpbkExpPtr + _srQty - 1 - inBffrIdx))   // The farthest register, holding the first byte shifted in, is shifted out first
+               lpbkErr = true;
+         }
+         else
+            result = _sendSnglSRCntnt(curSRcntnt, (inBffrIdx < _inSrQty)?(_inStgBffrPtr + inBffrIdx):nullptr);
+      }
+      const uint32_t chnkTm{static_cast<uint32_t>(esp_timer_get_time() - chnkStrtTm)};
+      if(_flshPolicy != flshPreemptible){
+         taskEXIT_CRITICAL(&_flshMux);
+         if(chnkTm > _flshCrtclWrstUs)
+            _flshCrtclWrstUs = chnkTm;
+         if(((chnkTm + chnkQty - 1) / chnkQty) > _flshRegTmUs)  // Uninterrupted time, a clean measure of the register time
+            _flshRegTmUs = (chnkTm + chnkQty - 1) / chnkQty;
+      }
    }
+   SRGX_PIN_WRT(_st_cp, HIGH);   // End of access to the shift register internal buffer, copy the buffer values to the output pins -> Lower the latch pin
+   if(_oeBlnkFlsh)
+      _blankOE(false);
+   if(_lpbkChkPrd > 0){
+      if(lpbkErr){
+         _lpbkErrsQty++;
+         if(_bitDlyUs < _dfltBitDlyUs)
+            _bitDlyUs = _dfltBitDlyUs; // The calibrated rate is not reliable anymore, the safe one is restored
+      }
+      memcpy(_lpbkExpPtr, outImgPtr, _srQty);
+      _lpbkExpVld = true;
+   }
+   if(_trcRngPtr != nullptr)
+      _recTrcFrm();
 
    return result;
 }
 
-uint8_t* ShiftRegGPIOXpander::getMainBuffPtr(){
-
-   return _mainBuffrArryPtr;
-}
-
-uint8_t ShiftRegGPIOXpander::getMaxSRGXPin(){
-
-   return _maxSRGXPin;
-}
-
-uint8_t ShiftRegGPIOXpander::getSrQty(){
-
-   return _srQty;
-}
-
-bool ShiftRegGPIOXpander::isValid(SRGXVPort &VPort){
-
-   return (VPort.getSRGXPtr() != nullptr);
-}
-
-bool ShiftRegGPIOXpander::_moveAuxToMain(){
-   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-   bool result {false};
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_stampSgmnt(const uint8_t* newSgmntPtr, const uint8_t &strtPin, const uint8_t &pinsQty, const bool &keepRsrvd){
+   uint8_t bffrIdx{static_cast<uint8_t>(strtPin / 8)};
+   uint8_t bffrMsk{0x00};
+   uint8_t bffrVals{0x00};
 
-   if(_auxBuffrArryPtr != nullptr){
-      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching
-      memcpy( _mainBuffrArryPtr, _auxBuffrArryPtr, _srQty);
-      _discardAux();
-      taskEXIT_CRITICAL(&mux);   // Exit critical section
-      _sendAllSRCntnt();
-      result = true;}
+   for (int ptrInc{0}; ptrInc < pinsQty; ptrInc++){
+      if(((strtPin + ptrInc) / 8) != bffrIdx){  // The segment crossed to the next Main Buffer byte, commit the accumulated byte
+         if(keepRsrvd)
+            _mainUnrsrvdWrt(bffrIdx, bffrMsk, bffrVals);
+         else
+            _mainMskdWrt(bffrIdx, bffrMsk, bffrVals);
+         bffrIdx = (strtPin + ptrInc) / 8;
+         bffrMsk = 0x00;
+         bffrVals = 0x00;
+      }
+      bffrMsk |= (0x01 << ((strtPin + ptrInc) % 8));
+      if(*(newSgmntPtr + (ptrInc / 8)) & (0x01 << (ptrInc % 8)))
+         bffrVals |= (0x01 << ((strtPin + ptrInc) % 8));
+   }
+   if(keepRsrvd)
+      _mainUnrsrvdWrt(bffrIdx, bffrMsk, bffrVals);
+   else
+      _mainMskdWrt(bffrIdx, bffrMsk, bffrVals);
 
-   return result;
+   return true;
 }
 
-bool ShiftRegGPIOXpander::moveAuxToMain(){
-   bool result {false};
-
-   if(_auxBuffrArryPtr != nullptr){
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            result = _moveAuxToMain(); 
-            xSemaphoreGive(_SRGXAuxBffrMtx);
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_stampBytesLckFree(const uint8_t* bffrIdxPtr, const uint8_t* mskPtr, const uint8_t* valsPtr, const uint8_t* tgglPtr, const uint8_t &bytesQty, const SRGXTrcApi &trcApi, uint32_t* asyncWrtSeqPtr){
+   bool result{false};
+   uint32_t lckFreeWrtSeq{0};
+
+   if(bffrIdxPtr != nullptr){
+      for(int ptrInc{0}; ptrInc < bytesQty; ptrInc++)
+         _mainMskdWrt(*(bffrIdxPtr + ptrInc), (mskPtr != nullptr)?*(mskPtr + ptrInc):0x00, (valsPtr != nullptr)?*(valsPtr + ptrInc):0x00, (tgglPtr != nullptr)?*(tgglPtr + ptrInc):0x00);
+      if(asyncWrtSeqPtr != nullptr)
+         result = _reqAsyncFlush(*asyncWrtSeqPtr);
+      else{
+         lckFreeWrtSeq = __atomic_add_fetch(&_lckFreeWrtSeq, 1, __ATOMIC_ACQ_REL);
+         if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+            if(static_cast<int32_t>(_flshdWrtSeq - lckFreeWrtSeq) < 0)   // No flush including this write started since it was sequenced, flush now
+               _sendAllSRCntnt(trcApi);
+            xSemaphoreGive(_SRGXMnBffrMtx);
+            result = true;
          }
-         xSemaphoreGive(_SRGXMnBffrMtx);
       }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::resetBit(const uint8_t &srPin){
+bool ShiftRegGPIOXpander::_stampBytesOverMain(const uint8_t* bffrIdxPtr, const uint8_t* mskPtr, const uint8_t* valsPtr, const uint8_t &bytesQty, const SRGXTrcApi &trcApi){
    bool result{false};
 
-   if(srPin <= _maxSRGXPin){
-      digitalWriteSr(srPin, LOW); // Set the pin to LOW
-      result = true;
+   if((bffrIdxPtr != nullptr) && (mskPtr != nullptr) && (valsPtr != nullptr)){
+      if(_takeMainBffr(trcApi)){
+         for(int ptrInc{0}; ptrInc < bytesQty; ptrInc++)
+            _mainUnrsrvdWrt(*(bffrIdxPtr + ptrInc), *(mskPtr + ptrInc), *(valsPtr + ptrInc));
+         _giveMainBffr(true, trcApi);
+         result = true;
+      }
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::_sendAllSRCntnt(){
-   uint8_t curSRcntnt{0};
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_stampSgmntLckFree(const uint8_t &strtPin, const uint8_t &pinsQty, const uint16_t &sgmntMsk, const uint16_t &sgmntVals, const uint16_t &sgmntTggl, const SRGXTrcApi &trcApi, uint32_t* asyncWrtSeqPtr){
    bool result{false};
 
-   if((_srQty > 0) && (_mainBuffrArryPtr != nullptr)){
-      ::digitalWrite(_st_cp, LOW); // Start of access to the shift register internal buffer to write -> Lower the latch pin
-      for(int srBuffDsplcPtr{_srQty - 1}; srBuffDsplcPtr >= 0; srBuffDsplcPtr--){
-         curSRcntnt = *(_mainBuffrArryPtr + srBuffDsplcPtr);
-         result = _sendSnglSRCntnt(curSRcntnt);
+   if((pinsQty > 0) && (pinsQty <= 16) && ((strtPin + pinsQty - 1) <= _maxSRGXPin)){
+      const uint32_t wideMsk = static_cast<uint32_t>(sgmntMsk) << (strtPin % 8);
+      const uint32_t wideVals = static_cast<uint32_t>(sgmntVals) << (strtPin % 8);
+      const uint32_t wideTggl = static_cast<uint32_t>(sgmntTggl) << (strtPin % 8);
+      uint8_t bffrIdx[3]{};   // A 16 pins segment spans at most 3 Main Buffer bytes
+      uint8_t bffrMsk[3]{};
+      uint8_t bffrVals[3]{};
+      uint8_t bffrTggl[3]{};
+      uint8_t bytesQty{0};
+
+      for(int bffrPos{strtPin / 8}; bffrPos <= ((strtPin + pinsQty - 1) / 8); bffrPos++){
+         const uint8_t bytePos = bytesQty * 8;
+         bffrIdx[bytesQty] = bffrPos;
+         bffrMsk[bytesQty] = (wideMsk >> bytePos) & 0xFF;
+         bffrVals[bytesQty] = (wideVals >> bytePos) & 0xFF;
+         bffrTggl[bytesQty] = (wideTggl >> bytePos) & 0xFF;
+         bytesQty++;
       }
-      ::digitalWrite(_st_cp, HIGH);   // End of access to the shift register internal buffer, copy the buffer values to the output pins -> Lower the latch pin
-      result = true;
+      result = _stampBytesLckFree(bffrIdx, bffrMsk, bffrVals, bffrTggl, bytesQty, trcApi, asyncWrtSeqPtr);
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::_sendSnglSRCntnt(const uint8_t &data){  
-   uint8_t mask{0x80};
-   bool result{true};
+void ShiftRegGPIOXpander::_stTsk(void* argp){
+   ShiftRegGPIOXpander* SRGXPtr = static_cast<ShiftRegGPIOXpander*>(argp);
 
-   for (int bitPos {7}; bitPos >= 0; bitPos--){   //Send each of the bits corresponding to one 8-bits shift register module
-      ::digitalWrite(_sh_cp, LOW); // Start of next bit value addition to the shift register internal buffer -> Lower the clock pin         
-      ::digitalWrite(_ds, (data & mask)?HIGH:LOW);
-      mask >>= 1; // Shift the mask to the right to get the next bit value
-      delayMicroseconds(10);  // Time required by the 74HCx595 to modify the SH_CP line by datasheet
-      /* 
-      delayMicroseconds(10) Equivalent:
-         uint64_t micros = esp_timer_get_time();
-         while((esp_timer_get_time() - micros) < 10){}; // Wait for the time required by the 74HCx595 to modify the SH_CP line by datasheet
-      */
-      ::digitalWrite(_sh_cp, HIGH);   // End of next bit value addition to the shift register internal buffer -> Lower the clock pin      
-   }
+   for(;;){
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      if(!SRGXPtr->_stTskEnd){   // The flushes latched during the coalescing window are absorbed by it
+         const TickType_t strtTm{xTaskGetTickCount()};
+         const TickType_t wndwTcks{pdMS_TO_TICKS(SRGXPtr->_stCoalesceMs)};
 
-   return result;
+         while(!SRGXPtr->_stTskEnd && ((xTaskGetTickCount() - strtTm) < wndwTcks))
+            ulTaskNotifyTake(pdTRUE, wndwTcks - (xTaskGetTickCount() - strtTm));
+      }
+      if(xSemaphoreTake(SRGXPtr->_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+         memcpy(SRGXPtr->_stImgPtr, SRGXPtr->_mainBuffrArryPtr, SRGXPtr->_srQty);
+         xSemaphoreGive(SRGXPtr->_SRGXMnBffrMtx);
+      }
+      if(memcmp(SRGXPtr->_stImgPtr, SRGXPtr->_stSavedPtr, SRGXPtr->_srQty) != 0){  // Saved out of the mutex, the store writes do not delay the outputs modifications
+         if(SRGXPtr->_stStorePtr->save(SRGXPtr->_stImgPtr, SRGXPtr->_srQty))
+            memcpy(SRGXPtr->_stSavedPtr, SRGXPtr->_stImgPtr, SRGXPtr->_srQty);
+      }
+      if(SRGXPtr->_stTskEnd)
+         break;
+   }
+   SRGXPtr->_stTskHndl = nullptr;
+   vTaskDelete(NULL);
 }
 
-bool ShiftRegGPIOXpander::setBit(const uint8_t &srPin){
+bool SRGX_IRAM_ATTR ShiftRegGPIOXpander::_takeMainBffr(const SRGXTrcApi &trcApi){
    bool result{false};
 
-   if(srPin <= _maxSRGXPin){
-      digitalWriteSr(srPin, HIGH); // Set the pin to HIGH
+   if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
+      if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+         _drainAsyncWrts();
+         if(_auxBuffrArryPtr != nullptr)
+            _moveAuxToMain(trcApi);
+         xSemaphoreGive(_SRGXAuxBffrMtx);
+      }
       result = true;
    }
 
    return result;
 }
 
-bool ShiftRegGPIOXpander::stampMaskOverMain(uint8_t* maskPtr, uint8_t* valsPtr){
-   portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-   bool result{false};  
-
-   if((maskPtr != nullptr) && (valsPtr != nullptr)){
-      taskENTER_CRITICAL(&mux);  // Enter critical section to avoid any interrupt, including task switching
-      uint8_t* localMaskPtr = new uint8_t[_srQty];
-      memcpy(localMaskPtr, maskPtr, _srQty);
-      uint8_t* localValsPtr = new uint8_t[_srQty];
-      memcpy(localValsPtr, valsPtr, _srQty);
-      taskEXIT_CRITICAL(&mux);   // Exit critical section
+bool ShiftRegGPIOXpander::_takeSnpsht(const uint8_t &slot){
+   bool result{false};
 
-      if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){
-         if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
-            if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain(); // Move the Auxiliary Buffer to the Main Buffer, if it exists      
-            xSemaphoreGive(_SRGXAuxBffrMtx);
+   if(slot < _snpshtsQty){
+      if(_takeMainBffr(trcApiMoveAuxToMain)){   // The Main Buffer is held while the staging condition is checked, so an empty slot is staged from a stable image. The mutexes are taken in the Main Buffer first order
+         if(xSemaphoreTake(_SRGXSnpshtMtx, portMAX_DELAY) == pdTRUE){
+            if(!(_snpshtStgdMsk & (0x0001 << slot))){
+               memcpy(*(_snpshtSlotsPtr + slot), _mainBuffrArryPtr, _srQty);
+               _snpshtStgdMsk |= (0x0001 << slot);
+            }
+            result = true;
          }
-         for (int ptrInc{0}; ptrInc < _maxSRGXPin; ptrInc++){
-            if(*(localMaskPtr + (ptrInc / 8)) & (static_cast<uint8_t>(0x01) << (ptrInc % 8))){  // If the bit is set in the mask check if the bit state in the Main needs to be changed
-               if((*(_mainBuffrArryPtr + (ptrInc / 8)) & (static_cast<uint8_t>(0x01) << (ptrInc % 8))) != (*(localValsPtr + (ptrInc / 8)) & (0x01 << (static_cast<uint8_t>(0x01) % 8))))
-                  *(_mainBuffrArryPtr + (ptrInc / 8)) ^= (static_cast<uint8_t>(0x01) << (ptrInc % 8));
-            } // If the bit is set in the mask, then check if the bit state in the Main Buffer needs to be changed
-         }      
-         _sendAllSRCntnt(); // Flush the Main Buffer to the shift registers
-         xSemaphoreGive(_SRGXMnBffrMtx);
-         result = true; // If the parameters were valid, the operation was successful
+         _giveMainBffr(false, trcApiNone);
       }
-      delete [] localMaskPtr; // Free the memory allocated for the local mask
-      delete [] localValsPtr; // Free the memory allocated for the local values
    }
 
    return result;
@@ -616,12 +2729,14 @@ bool ShiftRegGPIOXpander::stampOverMain(uint8_t* newCntntPtr){
 
       if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){            
          if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
             if(_auxBuffrArryPtr != nullptr)
                _discardAux();
             xSemaphoreGive(_SRGXAuxBffrMtx);
          }
-         memcpy(_mainBuffrArryPtr, newCntntPtr, _srQty);
-         _sendAllSRCntnt();
+         for (int ptrInc{0}; ptrInc < _srQty; ptrInc++)
+            _mainUnrsrvdWrt(ptrInc, 0xFF, *(localNewCntntPtr + ptrInc));
+         _sendAllSRCntnt(trcApiStampOverMain);
          xSemaphoreGive(_SRGXMnBffrMtx);
          result = true;         
       }      
@@ -637,15 +2752,13 @@ bool ShiftRegGPIOXpander::stampSgmntOverMain(uint8_t *newSgmntPtr, const uint8_t
    if((newSgmntPtr != nullptr) && (pinsQty > 0) && ((strtPin + pinsQty - 1) <= _maxSRGXPin)){
       if(xSemaphoreTake(_SRGXMnBffrMtx, portMAX_DELAY) == pdTRUE){            
          if(xSemaphoreTake(_SRGXAuxBffrMtx, portMAX_DELAY) == pdTRUE){
+            _drainAsyncWrts();
             if(_auxBuffrArryPtr != nullptr)
-               _moveAuxToMain(); // Move the Auxiliary Buffer to the Main Buffer, if it exists
+               _moveAuxToMain(trcApiStampSgmntOverMain); // Move the Auxiliary Buffer to the Main Buffer, if it exists
             xSemaphoreGive(_SRGXAuxBffrMtx);
          }
-         for (int ptrInc{0}; ptrInc < pinsQty; ptrInc++){
-            if((*(_mainBuffrArryPtr + ((strtPin + ptrInc) / 8)) & (0x01 << ((strtPin + ptrInc) % 8))) != (*(newSgmntPtr + (ptrInc / 8)) & (0x01 << (ptrInc % 8)))) // If the bit state in the segment is different from the bit state in the Main Buffer
-               *(_mainBuffrArryPtr + ((strtPin + ptrInc) / 8)) ^= (0x1 << ((strtPin + ptrInc) % 8));
-         }
-         _sendAllSRCntnt();
+         _stampSgmnt(newSgmntPtr, strtPin, pinsQty);
+         _sendAllSRCntnt(trcApiStampSgmntOverMain);
          xSemaphoreGive(_SRGXMnBffrMtx);
          result = true;
       }      
@@ -654,6 +2767,45 @@ bool ShiftRegGPIOXpander::stampSgmntOverMain(uint8_t *newSgmntPtr, const uint8_t
    return result;
 }
 
+bool ShiftRegGPIOXpander::toggleMany(const uint8_t* pinsPtr, const size_t &pinsQty){
+
+   return _applyPinsLst(_lstToggle, nullptr, pinsPtr, pinsQty, trcApiToggleMany);
+}
+
+bool ShiftRegGPIOXpander::updateInputs(){
+   bool result{false};
+
+   if(_inSrQty > 0){
+      if(_takeMainBffr(trcApiUpdateInputs)){
+         _giveMainBffr(true, trcApiUpdateInputs);
+         result = true;
+      }
+   }
+
+   return result;
+}
+
+SRGXAsyncHndl ShiftRegGPIOXpander::writeAsync(const uint8_t &srPin, const uint8_t &value){
+   SRGXAsyncHndl result{};
+   uint32_t wrtSeq{0};
+
+   if((srPin <= _maxSRGXPin) && !isPinReserved(srPin) && (_mainBuffrArryPtr != nullptr) && (_SRGXMnBffrMtx != nullptr)){
+      const uint8_t bffrIdx{static_cast<uint8_t>(srPin / 8)};
+      const uint8_t pinMsk = 0x01 << (srPin % 8);
+      const uint8_t pinVal{(value)?pinMsk:static_cast<uint8_t>(0x00)};
+
+      if(_reqAsyncFlush(wrtSeq, &bffrIdx, &pinMsk, &pinVal, 1))
+         result = SRGXAsyncHndl(this, wrtSeq);
+   }
+
+   return result;
+}
+
+bool ShiftRegGPIOXpander::writeMany(const SRGXPinValue* itemsPtr, const size_t &itemsQty){
+
+   return _applyPinsLst(_lstWrite, itemsPtr, nullptr, itemsQty, trcApiWriteMany);
+}
+
 //=========================================================================> Class methods delimiter
 
 SRGXVPort::SRGXVPort()
@@ -673,12 +2825,104 @@ SRGXVPort::SRGXVPort(ShiftRegGPIOXpander* SRGXPtr, uint8_t strtPin, uint8_t pins
    }
 }
 
+SRGXVPort::SRGXVPort(ShiftRegGPIOXpander* SRGXPtr, const uint8_t* pinsLstPtr, uint8_t pinsQty)
+:_SRGXPtr{SRGXPtr}, _pinsQty{pinsQty}
+{
+   bool validPins{(_SRGXPtr != nullptr) && (pinsLstPtr != nullptr) && (_pinsQty > 0) && (_pinsQty <= _maxPortPinsQty)};
+
+   for(uint8_t pinInc{0}; validPins && (pinInc < _pinsQty); pinInc++){
+      if(*(pinsLstPtr + pinInc) > _SRGXPtr->getMaxSRGXPin())
+         validPins = false;
+      for(uint8_t prvPinInc{0}; validPins && (prvPinInc < pinInc); prvPinInc++){
+         if(*(pinsLstPtr + prvPinInc) == *(pinsLstPtr + pinInc))  // Duplicated pins make the scatter/gather operation ambiguous
+            validPins = false;
+      }
+   }
+   if(!validPins){
+      _SRGXPtr = nullptr;
+      _pinsQty = 0;
+   }
+   else{
+      _sctrPinsLstPtr = new uint8_t[_pinsQty];
+      memcpy(_sctrPinsLstPtr, pinsLstPtr, _pinsQty);
+      _strtPin = *_sctrPinsLstPtr;
+      _vportMaxVal = static_cast<uint16_t>((1UL << _pinsQty) - 1);
+      _buildSctrTbls();
+   }
+}
+
+SRGXVPort::SRGXVPort(SRGXVPort&& other) noexcept
+:ShiftRegGPIOXpander()
+{
+   _takeSRGXVPortRsrcs(other);
+}
+
 SRGXVPort::~SRGXVPort(){
+   _releaseSRGXVPortRsrcs();
+   _SRGXPtr = nullptr; // Just to make it visible. The pointer will be destructed even if not explicitly done, when the object is destructed
+}
+
+SRGXVPort& SRGXVPort::operator=(SRGXVPort&& other) noexcept{
+   if(this != &other){
+      _releaseSRGXVPortRsrcs();
+      _takeSRGXVPortRsrcs(other);
+   }
+
+   return *this;
+}
+
+void SRGXVPort::_releaseSRGXVPortRsrcs(){
+   releasePins();
    if(_srgxStampMskPtr != nullptr){ // If the mask pointer is not null, delete the mask
       delete [] _srgxStampMskPtr;
       _srgxStampMskPtr = nullptr;
    }
-   _SRGXPtr = nullptr; // Just to make it visible. The pointer will be destructed even if not explicitly done, when the object is destructed
+   if(_SRGXVPortMskMtx != nullptr){ // If the mutex was created by begin(), release it
+      vSemaphoreDelete(_SRGXVPortMskMtx);
+      _SRGXVPortMskMtx = nullptr;
+   }
+   if(_sctrPinsLstPtr != nullptr){
+      delete [] _sctrPinsLstPtr;
+      _sctrPinsLstPtr = nullptr;
+   }
+   if(_sctrRegsPtr != nullptr){
+      delete [] _sctrRegsPtr;
+      _sctrRegsPtr = nullptr;
+      _sctrRegsQty = 0;
+   }
+   _begun = false;
+
+   return;
+}
+
+void SRGXVPort::_takeSRGXVPortRsrcs(SRGXVPort &other){
+   _SRGXPtr = other._SRGXPtr;
+   _strtPin = other._strtPin;
+   _pinsQty = other._pinsQty;
+   _srgxStampMskPtr = other._srgxStampMskPtr;
+   _sctrPinsLstPtr = other._sctrPinsLstPtr;
+   _sctrRegsPtr = other._sctrRegsPtr;
+   _sctrRegsQty = other._sctrRegsQty;
+   _vportBuffer = other._vportBuffer;
+   _vportMaxVal = other._vportMaxVal;
+   _begun = other._begun;
+   _exclusive = other._exclusive;
+   _SRGXVPortMskMtx = other._SRGXVPortMskMtx;
+
+   other._SRGXPtr = nullptr;  // The source object is left as an invalid SRGXVPort object, owning no resources
+   other._strtPin = 0;
+   other._pinsQty = 0;
+   other._srgxStampMskPtr = nullptr;
+   other._sctrPinsLstPtr = nullptr;
+   other._sctrRegsPtr = nullptr;
+   other._sctrRegsQty = 0;
+   other._vportBuffer = 0;
+   other._vportMaxVal = 0;
+   other._begun = false;
+   other._exclusive = false;
+   other._SRGXVPortMskMtx = nullptr;
+
+   return;
 }
 
 bool SRGXVPort::begin(uint16_t initCntnt){
@@ -688,19 +2932,13 @@ bool SRGXVPort::begin(uint16_t initCntnt){
       if(_SRGXPtr != nullptr){
          if(initCntnt <= _vportMaxVal){ 
             _SRGXVPortMskMtx = xSemaphoreCreateMutex();
-            /*Alternate coding: Cast the initCntnt to a pointer to uint8_t, this is safe for the ESP32 as it uses little-endian byte order*/
-            // uint8_t* initCntntPtr = reinterpret_cast<uint8_t*>(&initCntnt); 
-            uint8_t* initCntntPtr = new uint8_t[2];
-            initCntntPtr[0] = static_cast<uint8_t>(initCntnt & 0x00FF); // Set in the first array slot the least significant byte
-            initCntntPtr[1] = static_cast<uint8_t>((initCntnt >> 8) & 0x00FF); // Set in the second array slot the most significant byte            
             result = _buildSRGXVPortMsk(_srgxStampMskPtr);
             if(result){
-               result = _SRGXPtr->stampSgmntOverMain(initCntntPtr, _strtPin, _pinsQty);
+               result = writePort(initCntnt);   // The port is not exclusive yet, the writing is done through the regular mutex protected methods
                if(result){
                   _begun = true;
                }
             }
-            delete [] initCntntPtr; // Free the memory allocated for the initCntnt pointer
          }
       }
    }
@@ -715,8 +2953,8 @@ bool SRGXVPort::_buildSRGXVPortMsk(uint8_t* &maskPtr){
       if(xSemaphoreTake(_SRGXVPortMskMtx,portMAX_DELAY) == pdTRUE){
          maskPtr = new uint8_t[_SRGXPtr->getSrQty()];
          memset(maskPtr, 0x00, _SRGXPtr->getSrQty()); // Initialize the mask to 0x00
-         for(uint8_t pinInc{_strtPin}; pinInc < (_strtPin + _pinsQty); pinInc++)
-            *(maskPtr + (pinInc / 8)) |= (1 << (pinInc % 8)); // Set the bit in the mask for the virtual port position
+         for(uint8_t pinInc{0}; pinInc < _pinsQty; pinInc++)
+            *(maskPtr + (_vportPinToSRGXPin(pinInc) / 8)) |= (1 << (_vportPinToSRGXPin(pinInc) % 8)); // Set the bit in the mask for the virtual port position
          result = true;
          xSemaphoreGive(_SRGXVPortMskMtx);
       }
@@ -725,6 +2963,59 @@ bool SRGXVPort::_buildSRGXVPortMsk(uint8_t* &maskPtr){
    return result;    
 }
 
+void SRGXVPort::_buildSctrTbls(){
+   uint8_t regsIdx[_maxPortPinsQty]{};
+   uint8_t srgxPin{0};
+   uint8_t regInc{0};
+
+   _sctrRegsQty = 0;
+   for(uint8_t pinInc{0}; pinInc < _pinsQty; pinInc++){ // List the shift registers involved, in ascending order
+      srgxPin = *(_sctrPinsLstPtr + pinInc);
+      for(regInc = 0; (regInc < _sctrRegsQty) && (regsIdx[regInc] < (srgxPin / 8)); regInc++);
+      if((regInc == _sctrRegsQty) || (regsIdx[regInc] != (srgxPin / 8))){
+         memmove(&regsIdx[regInc + 1], &regsIdx[regInc], _sctrRegsQty - regInc);
+         regsIdx[regInc] = srgxPin / 8;
+         _sctrRegsQty++;
+      }
+   }
+
+   _sctrRegsPtr = new SRGXVPortSctrReg[_sctrRegsQty]{};
+   for(regInc = 0; regInc < _sctrRegsQty; regInc++)
+      (_sctrRegsPtr + regInc)->bffrIdx = regsIdx[regInc];
+
+   for(uint8_t pinInc{0}; pinInc < _pinsQty; pinInc++){
+      srgxPin = *(_sctrPinsLstPtr + pinInc);
+      for(regInc = 0; (_sctrRegsPtr + regInc)->bffrIdx != (srgxPin / 8); regInc++);
+      SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+      const uint8_t regBit = srgxPin % 8;
+
+      sctrReg.bffrMsk |= (0x01 << regBit);
+      for(uint8_t nblVal{0}; nblVal < 16; nblVal++){
+         if(nblVal & (0x01 << (pinInc % 4)))   // The port pin is bit (pinInc % 4) of the port nibble (pinInc / 4)
+            sctrReg.sctrTbl[pinInc / 4][nblVal] |= (0x01 << regBit);
+         if(nblVal & (0x01 << (regBit % 4)))   // The register bit is bit (regBit % 4) of the register nibble (regBit / 4)
+            sctrReg.gthrTbl[regBit / 4][nblVal] |= (static_cast<uint16_t>(0x01) << pinInc);
+      }
+   }
+
+   return;
+}
+
+uint16_t SRGXVPort::andPort(const uint16_t &andMsk){
+
+   return _rmwPort(_rmwAnd, andMsk);
+}
+
+uint16_t SRGXVPort::cmpXchgPort(const uint16_t &expctdVal, const uint16_t &newPortVal){
+
+   return _rmwPort(_rmwCmpXchg, expctdVal, newPortVal);
+}
+
+uint16_t SRGXVPort::decPort(const uint16_t &decVal, const bool &saturate){
+
+   return _rmwPort(saturate?_rmwDecSat:_rmwDec, decVal);
+}
+
 int SRGXVPort::digitalRead(const uint8_t &srPin){
    int result {GPIO_NUM_NC};
 
@@ -744,7 +3035,7 @@ uint8_t SRGXVPort::digitalReadSr(const uint8_t &srPin){
 
    if(_SRGXPtr != nullptr){
       if(srPin < _pinsQty){
-         result = _SRGXPtr->digitalReadSr(_strtPin + srPin);
+         result = _SRGXPtr->digitalReadSr(_vportPinToSRGXPin(srPin));
       }
    }
 
@@ -761,8 +3052,12 @@ bool SRGXVPort::digitalWriteSr(const uint8_t &srPin, const uint8_t &value){
    bool result{false};
 
    if(_SRGXPtr != nullptr){
-      if(srPin < _pinsQty)
-         result = _SRGXPtr->digitalWriteSr(_strtPin + srPin, value);
+      if(srPin < _pinsQty){
+         if(_exclusive)
+            result = _SRGXPtr->_stampSgmntLckFree(_vportPinToSRGXPin(srPin), 1, 0x0001, (value)?0x0001:0x0000, 0x0000, trcApiVPortWrite);
+         else
+            result = _SRGXPtr->digitalWriteSr(_vportPinToSRGXPin(srPin), value);
+      }
    }
 
    return result;
@@ -772,8 +3067,12 @@ bool SRGXVPort::flipBit(const uint8_t &srPin){
    bool result{false};
 
    if(_SRGXPtr != nullptr){
-      if(srPin < _pinsQty)
-         result = _SRGXPtr->flipBit(_strtPin + srPin);
+      if(srPin < _pinsQty){
+         if(_exclusive)
+            result = _SRGXPtr->_stampSgmntLckFree(_vportPinToSRGXPin(srPin), 1, 0x0000, 0x0000, 0x0001, trcApiVPortWrite);
+         else
+            result = _SRGXPtr->flipBit(_vportPinToSRGXPin(srPin));
+      }
    }
 
    return result;
@@ -794,50 +3093,349 @@ uint16_t SRGXVPort::getVPortMaxVal(){
    return _vportMaxVal;
 }
 
+uint16_t SRGXVPort::incPort(const uint16_t &incVal, const bool &saturate){
+
+   return _rmwPort(saturate?_rmwIncSat:_rmwInc, incVal);
+}
+
+bool SRGXVPort::isExclusive(){
+
+   return _exclusive;
+}
+
+uint16_t SRGXVPort::orPort(const uint16_t &orMsk){
+
+   return _rmwPort(_rmwOr, orMsk);
+}
+
+uint16_t SRGXVPort::_readPortVal(){
+   uint16_t portVal{0};
+   const uint8_t* mainBffrPtr = _SRGXPtr->_mainBuffrArryPtr;
+
+   if(_sctrRegsPtr != nullptr){
+      for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++){
+         const SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+         const uint8_t regVal = *(mainBffrPtr + sctrReg.bffrIdx);
+         portVal |= sctrReg.gthrTbl[0][regVal & 0x0F] | sctrReg.gthrTbl[1][regVal >> 4];
+      }
+   }
+   else{
+      uint32_t sgmntWndw{0};  // A 16 pins segment spans at most 3 Main Buffer bytes
+      for(int bffrIdx{(_strtPin + _pinsQty - 1) / 8}; bffrIdx >= (_strtPin / 8); bffrIdx--)
+         sgmntWndw = (sgmntWndw << 8) | *(mainBffrPtr + bffrIdx);
+      portVal = static_cast<uint16_t>(sgmntWndw >> (_strtPin % 8)) & _vportMaxVal;
+   }
+
+   return portVal;
+}
+
 uint16_t SRGXVPort::readPort(){
    uint16_t portVal{0};
-   bool result{false};
 
-   if(_SRGXPtr != nullptr)
-      _SRGXPtr->digitalReadSgmntSr(_strtPin, _pinsQty, portVal);
+   if(_SRGXPtr != nullptr){
+      if(_sctrRegsPtr != nullptr){  // Scatter/gather port, each register involved is gathered through it's nibble lookup tables
+         uint8_t regsIdx[_maxPortPinsQty];
+         uint8_t regsVals[_maxPortPinsQty];
+
+         for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++)
+            regsIdx[regInc] = (_sctrRegsPtr + regInc)->bffrIdx;
+         if(_SRGXPtr->_readBytesFromMain(regsIdx, _sctrRegsQty, regsVals, trcApiVPortRead)){
+            for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++){
+               const SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+               portVal |= sctrReg.gthrTbl[0][regsVals[regInc] & 0x0F] | sctrReg.gthrTbl[1][regsVals[regInc] >> 4];
+            }
+         }
+      }
+      else
+         _SRGXPtr->digitalReadSgmntSr(_strtPin, _pinsQty, portVal);
+   }
 
    return portVal;
 }
 
+bool SRGXVPort::releasePins(){
+   bool result{false};
+
+   if(_exclusive){
+      result = _SRGXPtr->_releasePins(_srgxStampMskPtr);
+      _exclusive = false;
+   }
+
+   return result;
+}
+
+bool SRGXVPort::reservePins(){
+   bool result{false};
+
+   if((_SRGXPtr != nullptr) && _begun && !_exclusive){
+      result = _SRGXPtr->_reservePins(_srgxStampMskPtr);
+      _exclusive = result;
+   }
+
+   return result;
+}
+
+uint16_t SRGXVPort::_rmwPort(const SRGXVPortRmwOp &rmwOp, const uint16_t &opArg, const uint16_t &opArg2){
+   uint16_t prevVal{0};
+   uint16_t newVal{0};
+
+   if(_SRGXPtr != nullptr){
+      if(_SRGXPtr->_takeMainBffr(trcApiVPortRmw)){
+         prevVal = _readPortVal();
+         switch(rmwOp){
+            case _rmwInc:
+               newVal = (prevVal + opArg) & _vportMaxVal;
+               break;
+            case _rmwIncSat:
+               newVal = ((static_cast<uint32_t>(prevVal) + opArg) > _vportMaxVal)?_vportMaxVal:(prevVal + opArg);
+               break;
+            case _rmwDec:
+               newVal = (prevVal - opArg) & _vportMaxVal;
+               break;
+            case _rmwDecSat:
+               newVal = (opArg > prevVal)?0:(prevVal - opArg);
+               break;
+            case _rmwRotL:
+               newVal = ((static_cast<uint32_t>(prevVal) << (opArg % _pinsQty)) | (prevVal >> ((_pinsQty - (opArg % _pinsQty)) % _pinsQty))) & _vportMaxVal;
+               break;
+            case _rmwRotR:
+               newVal = ((prevVal >> (opArg % _pinsQty)) | (static_cast<uint32_t>(prevVal) << ((_pinsQty - (opArg % _pinsQty)) % _pinsQty))) & _vportMaxVal;
+               break;
+            case _rmwShftL:
+               newVal = (opArg >= _pinsQty)?0:((static_cast<uint32_t>(prevVal) << opArg) & _vportMaxVal);
+               break;
+            case _rmwShftR:
+               newVal = (opArg >= _pinsQty)?0:(prevVal >> opArg);
+               break;
+            case _rmwAnd:
+               newVal = prevVal & opArg;
+               break;
+            case _rmwOr:
+               newVal = (prevVal | opArg) & _vportMaxVal;
+               break;
+            case _rmwXor:
+               newVal = (prevVal ^ opArg) & _vportMaxVal;
+               break;
+            case _rmwCmpXchg:
+               newVal = ((prevVal == opArg) && (opArg2 <= _vportMaxVal))?opArg2:prevVal;
+               break;
+         }
+         if(newVal != prevVal)
+            _writePortVal(newVal);
+         _SRGXPtr->_giveMainBffr(newVal != prevVal, trcApiVPortRmw);  // A single flush, only if the port value was modified
+      }
+   }
+
+   return prevVal;
+}
+
 bool SRGXVPort::resetBit(const uint8_t &srPin){
    bool result{false};
 
    if(_SRGXPtr != nullptr){
       if(srPin < _pinsQty){
-         result = _SRGXPtr->resetBit(_strtPin + srPin);
+         if(_exclusive)
+            result = _SRGXPtr->_stampSgmntLckFree(_vportPinToSRGXPin(srPin), 1, 0x0001, 0x0000, 0x0000, trcApiVPortWrite);
+         else
+            result = _SRGXPtr->resetBit(_vportPinToSRGXPin(srPin));
       }
    }
 
    return result;
 }
 
+uint16_t SRGXVPort::rotLPort(const uint8_t &bitsQty){
+
+   return _rmwPort(_rmwRotL, bitsQty);
+}
+
+uint16_t SRGXVPort::rotRPort(const uint8_t &bitsQty){
+
+   return _rmwPort(_rmwRotR, bitsQty);
+}
+
 bool SRGXVPort::setBit(const uint8_t &srPin){
    bool result{false};
 
    if(_SRGXPtr != nullptr){
       if(srPin < _pinsQty){
-         result = _SRGXPtr->setBit(_strtPin + srPin);
+         if(_exclusive)
+            result = _SRGXPtr->_stampSgmntLckFree(_vportPinToSRGXPin(srPin), 1, 0x0001, 0x0001, 0x0000, trcApiVPortWrite);
+         else
+            result = _SRGXPtr->setBit(_vportPinToSRGXPin(srPin));
       }
    }
 
    return result;
 }
 
+uint16_t SRGXVPort::shftLPort(const uint8_t &bitsQty){
+
+   return _rmwPort(_rmwShftL, bitsQty);
+}
+
+uint16_t SRGXVPort::shftRPort(const uint8_t &bitsQty){
+
+   return _rmwPort(_rmwShftR, bitsQty);
+}
+
+uint8_t SRGXVPort::_vportPinToSRGXPin(const uint8_t &srPin){
+
+   return (_sctrPinsLstPtr != nullptr)?*(_sctrPinsLstPtr + srPin):(_strtPin + srPin);
+}
+
 bool SRGXVPort::writePort(uint16_t portVal){
    bool result{false};
    uint8_t* portValPtr {nullptr};
 
    if(_SRGXPtr != nullptr){
-      if(portVal <= _vportMaxVal){
-         portValPtr = reinterpret_cast<uint8_t*>(&portVal); // Cast the portVal to a pointer to uint8_t
-         result = _SRGXPtr->stampSgmntOverMain(portValPtr, _strtPin, _pinsQty); // Stamp the segment over the Main Buffer
+      if((portVal <= _vportMaxVal) && (_sctrRegsPtr != nullptr)){  // Scatter/gather port, each register involved is built through it's nibble lookup tables
+         uint8_t regsIdx[_maxPortPinsQty];
+         uint8_t regsMsk[_maxPortPinsQty];
+         uint8_t regsVals[_maxPortPinsQty];
+
+         for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++){
+            const SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+            regsIdx[regInc] = sctrReg.bffrIdx;
+            regsMsk[regInc] = sctrReg.bffrMsk;
+            regsVals[regInc] = sctrReg.sctrTbl[0][portVal & 0x0F] | sctrReg.sctrTbl[1][(portVal >> 4) & 0x0F] | sctrReg.sctrTbl[2][(portVal >> 8) & 0x0F] | sctrReg.sctrTbl[3][(portVal >> 12) & 0x0F];
+         }
+         if(_exclusive)
+            result = _SRGXPtr->_stampBytesLckFree(regsIdx, regsMsk, regsVals, nullptr, _sctrRegsQty, trcApiVPortWrite);
+         else
+            result = _SRGXPtr->_stampBytesOverMain(regsIdx, regsMsk, regsVals, _sctrRegsQty, trcApiVPortWrite);
       }
+      else if(portVal <= _vportMaxVal){
+         if(_exclusive){
+            result = _SRGXPtr->_stampSgmntLckFree(_strtPin, _pinsQty, _vportMaxVal, portVal, 0x0000, trcApiVPortWrite); // Lock-free stamp of the segment over the Main Buffer, the pins are reserved for this port
+         }
+         else if(_SRGXPtr->_takeMainBffr(trcApiVPortWrite)){
+            portValPtr = reinterpret_cast<uint8_t*>(&portVal); // Cast the portVal to a pointer to uint8_t
+            _SRGXPtr->_stampSgmnt(portValPtr, _strtPin, _pinsQty);   // Stamp the segment over the Main Buffer, as stampSgmntOverMain() does
+            _SRGXPtr->_giveMainBffr(true, trcApiVPortWrite);
+            result = true;
+         }
+      }
+   }
+
+   return result;
+}
+
+SRGXAsyncHndl SRGXVPort::writePortAsync(const uint16_t &newPortVal){
+   SRGXAsyncHndl result{};
+   uint32_t wrtSeq{0};
+   bool wrtSqncd{false};
+
+   if((_SRGXPtr != nullptr) && (newPortVal <= _vportMaxVal)){
+      if(_sctrRegsPtr != nullptr){  // Scatter/gather port, each register involved is built through it's nibble lookup tables
+         uint8_t regsIdx[_maxPortPinsQty];
+         uint8_t regsMsk[_maxPortPinsQty];
+         uint8_t regsVals[_maxPortPinsQty];
+
+         for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++){
+            const SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+            regsIdx[regInc] = sctrReg.bffrIdx;
+            regsMsk[regInc] = sctrReg.bffrMsk;
+            regsVals[regInc] = sctrReg.sctrTbl[0][newPortVal & 0x0F] | sctrReg.sctrTbl[1][(newPortVal >> 4) & 0x0F] | sctrReg.sctrTbl[2][(newPortVal >> 8) & 0x0F] | sctrReg.sctrTbl[3][(newPortVal >> 12) & 0x0F];
+         }
+         if(_exclusive)
+            wrtSqncd = _SRGXPtr->_stampBytesLckFree(regsIdx, regsMsk, regsVals, nullptr, _sctrRegsQty, trcApiAsync, &wrtSeq);
+         else
+            wrtSqncd = _SRGXPtr->_reqAsyncFlush(wrtSeq, regsIdx, regsMsk, regsVals, _sctrRegsQty);
+      }
+      else if(_exclusive)
+         wrtSqncd = _SRGXPtr->_stampSgmntLckFree(_strtPin, _pinsQty, _vportMaxVal, newPortVal, 0x0000, trcApiAsync, &wrtSeq);
+      else{ // Contiguous non exclusive port, the segment spans at most 3 Main Buffer bytes
+         const uint32_t wideMsk = static_cast<uint32_t>(_vportMaxVal) << (_strtPin % 8);
+         const uint32_t wideVals = static_cast<uint32_t>(newPortVal) << (_strtPin % 8);
+         uint8_t regsIdx[3]{};
+         uint8_t regsMsk[3]{};
+         uint8_t regsVals[3]{};
+         uint8_t regsQty{0};
+
+         for(int bffrPos{_strtPin / 8}; bffrPos <= ((_strtPin + _pinsQty - 1) / 8); bffrPos++){
+            regsIdx[regsQty] = bffrPos;
+            regsMsk[regsQty] = (wideMsk >> (regsQty * 8)) & 0xFF;
+            regsVals[regsQty] = (wideVals >> (regsQty * 8)) & 0xFF;
+            regsQty++;
+         }
+         wrtSqncd = _SRGXPtr->_reqAsyncFlush(wrtSeq, regsIdx, regsMsk, regsVals, regsQty);
+      }
+      if(wrtSqncd)
+         result = SRGXAsyncHndl(_SRGXPtr, wrtSeq);
+   }
+
+   return result;
+}
+
+void SRGX_IRAM_ATTR SRGXVPort::_writePortVal(const uint16_t &newPortVal){
+   if(_sctrRegsPtr != nullptr){
+      for(uint8_t regInc{0}; regInc < _sctrRegsQty; regInc++){
+         const SRGXVPortSctrReg &sctrReg = *(_sctrRegsPtr + regInc);
+         const uint8_t regVals = sctrReg.sctrTbl[0][newPortVal & 0x0F] | sctrReg.sctrTbl[1][(newPortVal >> 4) & 0x0F] | sctrReg.sctrTbl[2][(newPortVal >> 8) & 0x0F] | sctrReg.sctrTbl[3][(newPortVal >> 12) & 0x0F];
+
+         if(_exclusive)  // The pins are reserved for this port
+            _SRGXPtr->_mainMskdWrt(sctrReg.bffrIdx, sctrReg.bffrMsk, regVals);
+         else
+            _SRGXPtr->_mainUnrsrvdWrt(sctrReg.bffrIdx, sctrReg.bffrMsk, regVals);
+      }
+   }
+   else{
+      const uint8_t portValBytes[2]{static_cast<uint8_t>(newPortVal & 0x00FF), static_cast<uint8_t>((newPortVal >> 8) & 0x00FF)};
+      _SRGXPtr->_stampSgmnt(portValBytes, _strtPin, _pinsQty, !_exclusive);
+   }
+
+   return;
+}
+
+uint16_t SRGXVPort::xorPort(const uint16_t &xorMsk){
+
+   return _rmwPort(_rmwXor, xorMsk);
+}
+
+//=========================================================================> Class methods delimiter
+
+SRGXInVPort::SRGXInVPort()
+{
+}
+
+SRGXInVPort::SRGXInVPort(ShiftRegGPIOXpander* SRGXPtr, const uint8_t &strtPin, const uint8_t &pinsQty)
+:_SRGXPtr{SRGXPtr}, _strtPin{strtPin}, _pinsQty{pinsQty}
+{
+   if((_SRGXPtr == nullptr) || (_SRGXPtr->getInSrQty() == 0) || (_pinsQty == 0) || (_pinsQty > _maxPortPinsQty) || ((_strtPin + _pinsQty - 1) > _SRGXPtr->getMaxSRGXInPin())){
+      _SRGXPtr = nullptr;
+      _strtPin = 0;
+      _pinsQty = 0;
+   }
+   else{
+      _vportMaxVal = static_cast<uint16_t>((1UL << _pinsQty) - 1);
    }
+}
+
+int SRGXInVPort::digitalRead(const uint8_t &inPin){
+   int result {GPIO_NUM_NC};
+
+   if((_SRGXPtr != nullptr) && (inPin < _pinsQty))
+      result = _SRGXPtr->digitalReadIn(_strtPin + inPin);
 
    return result;
-}
\ No newline at end of file
+}
+
+ShiftRegGPIOXpander* SRGXInVPort::getSRGXPtr(){
+
+   return _SRGXPtr;
+}
+
+uint16_t SRGXInVPort::getVPortMaxVal(){
+
+   return _vportMaxVal;
+}
+
+uint16_t SRGXInVPort::readPort(){
+   uint16_t portVal{0};
+
+   if(_SRGXPtr != nullptr)
+      _SRGXPtr->digitalReadSgmntIn(_strtPin, _pinsQty, portVal);
+
+   return portVal;
+}
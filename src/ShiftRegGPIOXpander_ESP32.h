@@ -45,7 +45,258 @@
 #include <Arduino.h>
 #include <stdint.h>
 
+/*Opt-in hot paths placement: building with the SRGX_IRAM_HOT_PATHS macro defined (i.e. the
+-DSRGX_IRAM_HOT_PATHS build flag) places the flushing, the bit kernels and the Main Buffer mutators
+fast paths in IRAM, drives the shift registers lines through the GPIO low level registers access and
+allocates the Main and Auxiliary Buffers in internal DRAM, so flushing never stalls on flash cache
+misses (i.e. while NVS writes or OTA updates disable the cache). Outside the ESP-IDF based builds the
+attribute is a no-op.*/
+#if defined(SRGX_IRAM_HOT_PATHS) && defined(ESP_PLATFORM)
+   #define SRGX_IRAM_EN 1
+   #include <esp_attr.h>
+   #define SRGX_IRAM_ATTR IRAM_ATTR
+#else
+   #define SRGX_IRAM_EN 0
+   #define SRGX_IRAM_ATTR
+#endif
+
+/*C++20 coroutines support: on toolchains providing it the SRGXAsyncHndl objects are awaitable
+(co_await) from coroutines.*/
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && __has_include(<coroutine>)
+   #define SRGX_CORO_EN 1
+   #include <coroutine>
+#else
+   #define SRGX_CORO_EN 0
+#endif
+
+class ShiftRegGPIOXpander;
 class SRGXVPort;
+class SRGXInVPort;
+class SRGXBus;
+class SRGXStateStore;
+
+/**
+ * @brief Flushing policies, setting how the Main Buffer flushing bit train is protected from preemption, see ShiftRegGPIOXpander::setFlushPolicy(const SRGXFlushPolicy&, const uint32_t&).
+ */
+enum SRGXFlushPolicy : uint8_t{
+   flshPreemptible,  // The flushing might be preempted at any point of the bit train (default)
+   flshPerRegister,  // Each shift register byte is sent inside a critical section, preemption might happen only between registers
+   flshWholeFrame // The whole bit train is sent inside a single critical section, split in chunks if it exceeds the maximum critical section duration
+};
+
+/**
+ * @brief Identifiers of the API methods requesting the flushes, held by the trace recorder records, see ShiftRegGPIOXpander::beginTrace(const uint32_t&).
+ * 
+ * The values are part of the trace dump format: new identifiers are added at the end.
+ */
+enum SRGXTrcApi : uint8_t{
+   trcApiNone,   // Flush not attributed to an API method
+   trcApiAsync,   // Asynchronous writes flushed by the asynchronous flushing task: writeAsync(), stampAsync() and SRGXVPort::writePortAsync()
+   trcApiBegin,
+   trcApiBeginInput,
+   trcApiClearPinsRemap,
+   trcApiDigitalReadSgmntSr,   // The reading methods flush the Auxiliary Buffer moved to the Main Buffer
+   trcApiDigitalReadSr,
+   trcApiDigitalToggleSr,
+   trcApiDigitalToggleSrAll,
+   trcApiDigitalToggleSrMask,
+   trcApiDigitalWriteSr,   // Including the SRGXPinDsc based setBit(), resetBit() and flipBit()
+   trcApiDigitalWriteSrAllReset,
+   trcApiDigitalWriteSrAllSet,
+   trcApiDigitalWriteSrMaskReset,
+   trcApiDigitalWriteSrMaskSet,
+   trcApiMoveAuxToMain,
+   trcApiMoveSnapshotToMain,
+   trcApiResetMany,
+   trcApiSetMany,
+   trcApiSetPinsRemap,
+   trcApiStampMaskOverMain,
+   trcApiStampOverMain,
+   trcApiStampSgmntOverMain,
+   trcApiToggleMany,
+   trcApiUpdateInputs,
+   trcApiWriteMany,
+   trcApiVPortRead,   // SRGXVPort::readPort(), flushing the Auxiliary Buffer moved to the Main Buffer
+   trcApiVPortRmw,   // SRGXVPort read-modify-write methods: andPort(), orPort(), xorPort(), incPort()...
+   trcApiVPortWrite,   // SRGXVPort writing methods: writePort(), digitalWriteSr(), setBit(), resetBit() and flipBit()
+   trcApiCmdSrvr,   // SRGXCmdSrvr frames
+   trcApiMuxScanner,   // SRGXMuxScanner rows
+   trcApiSeqPlayer,   // SRGXSeqPlayer frames
+   trcApiStepperEng   // SRGXStepperEng ticks and releaseMotor()
+};
+
+/**
+ * @brief Pin descriptor resolved at compile time, see SRGXPin().
+ * 
+ * The descriptor holds the Main Buffer index and the bit mask of a pin, so the descriptor based methods -ShiftRegGPIOXpander::digitalWriteSr(const SRGXPinDsc&, const uint8_t&), ShiftRegGPIOXpander::setBit(const SRGXPinDsc&) and ShiftRegGPIOXpander::resetBit(const SRGXPinDsc&)- need no pin number range validation nor register and bit calculations, only the register index is compared against the object's chain length.
+ * 
+ * @struct SRGXPinDsc
+ */
+struct SRGXPinDsc{
+   uint8_t bffrIdx;  // Main Buffer index of the pin's shift register
+   uint8_t bitMsk;   // Bit of the pin in it's shift register
+   uint8_t srQty; // Chain length the descriptor was validated against
+};
+
+/**
+ * @brief Builds a pin descriptor, validating the pin number against the chain length at compile time.
+ * 
+ * As the pin assignments are fixed for each hardware design, the descriptors might be declared as constexpr constants, i.e.:
+ * constexpr SRGXPinDsc redLed{SRGXPin<2, 13>()};
+ * A pin number beyond the chain length fails the compilation.
+ * 
+ * @tparam srQty Number of shift registers of the chain, as passed to the ShiftRegGPIOXpander constructor.
+ * @tparam srPin Pin number. The valid range is 0 <= srPin <= (srQty * 8) - 1.
+ * 
+ * @return The pin descriptor.
+ * 
+ * @attention The descriptor's chain length is checked against the ShiftRegGPIOXpander object by ShiftRegGPIOXpander::isValid(const SRGXPinDsc&). The descriptor based methods only compare the register index against the object's chain length, rejecting a pin beyond it.
+ */
+template <uint8_t srQty, uint8_t srPin>
+constexpr SRGXPinDsc SRGXPin(){
+   static_assert((srQty > 0) && (srQty <= 32), "SRGXPin: the chain length must be 1 <= srQty <= 32");
+   static_assert(srPin < (srQty * 8), "SRGXPin: the pin number is beyond the chain length");
+
+   return SRGXPinDsc{static_cast<uint8_t>(srPin / 8), static_cast<uint8_t>(0x01 << (srPin % 8)), srQty};
+}
+
+/**
+ * @brief Pin and value pair, item of the pins lists written by ShiftRegGPIOXpander::writeMany(const SRGXPinValue*, const size_t&).
+ * 
+ * @struct SRGXPinValue
+ */
+struct SRGXPinValue{
+   uint8_t pin;
+   uint8_t value; // LOW (0x00) or HIGH (any other value)
+};
+
+/**
+ * @brief Logical to physical remapping tables for one pair of logical and physical shift registers, see ShiftRegGPIOXpander::setPinsRemap(const uint8_t*, const bool&).
+ * 
+ * The tables hold the physical register bits set by each value of the logical register nibbles, so a logical byte is transformed with two lookups no matter how many of it's pins map to the physical register.
+ * 
+ * @struct SRGXRemapReg
+ */
+struct SRGXRemapReg{
+   uint8_t lgclIdx;  // Main Buffer index of the logical shift register
+   uint8_t physIdx;  // Chain position of the physical shift register
+   uint8_t rmpTbl[2][16];  // rmpTbl[n][v]: physical register bits set by the value v of the logical register nibble n
+};
+
+/**
+ * @brief Task or coroutine waiting for an asynchronous write to be latched, see SRGXAsyncHndl.
+ * 
+ * @struct SRGXAsyncWtr
+ */
+struct SRGXAsyncWtr{
+   uint32_t wrtSeq;  // Sequence number of the write waited for
+   TaskHandle_t tskHndl;   // Task to notify, nullptr for a coroutine
+   void* crtnAddr;   // Address of the coroutine to resume, nullptr for a task
+};
+
+/**
+ * @brief Outputs change notification, delivered to the observers once per latch that modified any pin, see ShiftRegGPIOXpander::addObserver(SRGXObsCb, void*).
+ *
+ * The masks and values have the Main Buffer layout: bit n of byte i corresponds to the pin i * 8 + n.
+ *
+ * @struct SRGXChgDiff
+ */
+struct SRGXChgDiff{
+   uint32_t ltchNmbr;   // Number of the latch notified, counted from 1 since ShiftRegGPIOXpander::beginObservers(const uint8_t&, const BaseType_t&)
+   uint32_t tmStmp;  // Latching time, esp_timer microseconds (lower 32 bits)
+   uint32_t coalescedQty;  // Preceding latches folded into this notification as the queue was full, 0 if none
+   uint8_t srQty; // Number of bytes pointed by chgMskPtr and newValsPtr
+   const uint8_t* chgMskPtr;  // Bits set for the pins changed since the preceding notification
+   const uint8_t* newValsPtr; // Whole image latched, the pins not set in chgMskPtr kept their values
+};
+
+/*SRGXObsCb: Observer callback, the diff pointers are valid for the duration of the call only.*/
+typedef void (*SRGXObsCb)(const SRGXChgDiff &diff, void* argp);
+
+/**
+ * @brief Observer registered to the outputs change notifications, see ShiftRegGPIOXpander::addObserver(SRGXObsCb, void*).
+ *
+ * @struct SRGXObsReg
+ */
+struct SRGXObsReg{
+   SRGXObsCb cb;
+   void* argp; // Argument passed to the callback
+};
+
+/**
+ * @brief Completion handle of an asynchronous write.
+ * 
+ * The asynchronous write methods -see ShiftRegGPIOXpander::writeAsync(const uint8_t&, const uint8_t&), ShiftRegGPIOXpander::stampAsync(uint8_t*, uint8_t*) and SRGXVPort::writePortAsync(const uint16_t&)- return without flushing the Main Buffer, the flush is done by a flushing task dedicated to the ShiftRegGPIOXpander object. The writes to the shared pins are queued and applied with the Main Buffer mutex taken, by that task or by the next Main Buffer operation of any task, whichever takes the mutex first, so they keep their order against the later writes. Only the pins reserved by an exclusive SRGXVPort are written without taking it. The handle returned identifies the write, and is completed when a flush including the write has been latched to the outputs. The writes made while a flush is pending are coalesced in a single flush.
+ * 
+ * The handle completion might be polled -isDone()-, waited for by the calling task -wait(const TickType_t&)- or, on toolchains supporting C++20 coroutines, awaited with co_await.
+ * 
+ * @note The handle is a lightweight value object -a pointer and a sequence number- that might be freely copied, and discarded if the completion is of no interest.
+ * 
+ * @class SRGXAsyncHndl
+ */
+class SRGXAsyncHndl{
+   /*Allows the ShiftRegGPIOXpander and SRGXVPort classes to build valid handles for the
+   asynchronous writes sequenced.*/
+   friend class ShiftRegGPIOXpander;
+   friend class SRGXVPort;
+
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   uint32_t _wrtSeq{0};
+
+   SRGXAsyncHndl(ShiftRegGPIOXpander* SRGXPtr, const uint32_t &wrtSeq);
+
+public:
+   /**
+    * @brief Default constructor, builds an invalid handle.
+    */
+   SRGXAsyncHndl();
+   /**
+    * @brief Returns the completion of the write.
+    * 
+    * @retval true The write was latched to the outputs.
+    * @retval false The write is not latched yet, or the handle is not valid.
+    */
+   bool isDone() const;
+   /**
+    * @brief Returns the validity of the handle.
+    * 
+    * @retval true The handle identifies a write sequenced.
+    * @retval false The write method failed, or the handle was built by the default constructor.
+    */
+   bool isValid() const;
+   /**
+    * @brief Blocks the calling task until the write is latched to the outputs.
+    * 
+    * The task waits for a task notification sent by the flushing task, so no CPU time is used while waiting.
+    * 
+    * @param tmOut Optional parameter. Maximum time to wait, in ticks. portMAX_DELAY (default) to wait with no time limit.
+    * 
+    * @retval true The write was latched.
+    * @retval false The time was out before the write was latched, or the handle is not valid.
+    * 
+    * @warning The method uses the calling task notification value, a notification sent to the task by other means while waiting will be consumed, and the calling party might be notified once after the method returns.
+    */
+   bool wait(const TickType_t &tmOut = portMAX_DELAY);
+#if SRGX_CORO_EN
+   /**
+    * @brief co_await support, returns true if the write was already latched, so the coroutine is not suspended.
+    */
+   bool await_ready() const noexcept;
+   /**
+    * @brief co_await support, registers the coroutine to be resumed when the write is latched.
+    * 
+    * @note The coroutine is resumed in the context of the flushing task of the ShiftRegGPIOXpander object, so it must not block it: awaiting other handles is safe, waiting for them is not.
+    */
+   bool await_suspend(std::coroutine_handle<> crtnHndl);
+   /**
+    * @brief co_await support, the value of the co_await expression.
+    * 
+    * @return The completion of the write, it might be false if the waiters list was full when suspending, see isDone().
+    */
+   bool await_resume() const noexcept;
+#endif
+};
 
 /**
  * @brief A class that models a GPIO outputs pins expander through the use of 8-bits Serial In Paralell Out (SIPO) shift registers
@@ -57,12 +308,184 @@ class SRGXVPort;
  * @class ShiftRegGPIOXpander
  */
 class ShiftRegGPIOXpander{
+   /*Allows the SRGXVPort class to access the lock-free writing and pins reservation
+   private members of the ShiftRegGPIOXpander object providing it's resources.*/
+   friend class SRGXVPort;
+   /*Allows the SRGXSeqPlayer class to apply the frames to the Main Buffer under a single mutex
+   taking and flushing.*/
+   friend class SRGXSeqPlayer;
+   /*Allows the SRGXMuxScanner class to reserve the display pins and refresh the rows under a single
+   mutex taking.*/
+   friend class SRGXMuxScanner;
+   /*Allows the SRGXStepperEng class to reserve the motors pins and merge the phases of all the
+   motors stepped in a tick under a single mutex taking.*/
+   friend class SRGXStepperEng;
+   /*Allows the SRGXBus class to register the object and to shift and latch it's Main Buffer
+   contents on behalf of it, coalescing the flushes of the objects sharing the bus.*/
+   friend class SRGXBus;
+   /*Allows the SRGXAsyncHndl class to check the asynchronous writes completion and to register
+   the tasks and coroutines waiting for it.*/
+   friend class SRGXAsyncHndl;
+   /*Allows the SRGXCmdSrvr class to apply the operations of a frame to the Main Buffer under a
+   single mutex taking and flushing.*/
+   friend class SRGXCmdSrvr;
 
 private:
    uint8_t _ds{};
    uint8_t _sh_cp{};
    uint8_t _st_cp{};
 
+   uint8_t* _pinOwnrshpPtr{nullptr};   // Bitmap of the pins reserved by exclusive SRGXVPort objects, same layout as the Main Buffer
+   portMUX_TYPE _SRGXOwnrshpMux = portMUX_INITIALIZER_UNLOCKED;   // Spinlock protecting the pins reservation check-and-set
+   uint32_t _lckFreeWrtSeq{0};   // Sequence number of the last lock-free write applied to the Main Buffer
+   uint32_t _flshdWrtSeq{0};  // Sequence number of the last lock-free write included in a flush
+
+   uint8_t _qh{0};   // 74HCx165 input chain pins and size, see beginInput()
+   uint8_t _sh_ld{0};
+   uint8_t _inSrQty{0};
+   uint8_t _maxSRGXInPin{0};
+   uint8_t* _inBffrArryPtr{nullptr};   // Input Image, published under the _inImgSeq seqlock
+   uint8_t* _inStgBffrPtr{nullptr};    // Inputs being captured by the flush in progress
+   uint32_t _inImgSeq{0};  // Input Image seqlock sequence, odd while the Input Image is being updated
+
+   SRGXFlushPolicy _flshPolicy{flshPreemptible};   // Flushing policy and instrumentation, see setFlushPolicy()
+   static const uint32_t _dfltFlshMaxCrtclUs{200};  // Default maximum critical section duration for the flshWholeFrame policy, about two registers at the default bit time delay
+   uint32_t _flshMaxCrtclUs{0};  // Maximum critical section duration for the flshWholeFrame policy, 0 for the policies not using it
+   uint32_t _flshRegTmUs{0}; // Worst observed time to send one shift register byte inside a critical section, used to size the flshWholeFrame chunks
+   uint32_t _flshWrstUs{0};   // Worst observed flush duration
+   uint32_t _flshCrtclWrstUs{0}; // Worst observed critical section duration
+   portMUX_TYPE _flshMux = portMUX_INITIALIZER_UNLOCKED;
+   static const uint32_t _dfltBitDlyUs{10}; // Bit time delay safe for any chain, by the 74HCx595 datasheet
+   static const uint32_t _maxBitDlyUs{1000};
+   uint32_t _bitDlyUs{_dfltBitDlyUs};  // Delay before each SH_CP rising edge, see calibrateBitDelay()
+   uint8_t _lpbkPin{0xFF}; // Input pin wired to the QH' output of the last 74HCx595, 0xFF if not used
+   uint32_t _lpbkChkPrd{0};   // Flushes between loop-back integrity checks, 0 if not checking, see setLoopbackCheck()
+   uint32_t _lpbkChkCnt{0};
+   uint8_t* _lpbkExpPtr{nullptr};   // Physical frame held by the chain, expected back through QH' by the next bit train
+   bool _lpbkExpVld{false};   // The chain contents are known, false after a calibration or before the first flush checked
+   uint32_t _lpbkErrsQty{0};
+
+   SRGXBus* _busPtr{nullptr};   // Shared bus the object flushes through, see SRGXBus
+   bool _busFlshPndng{false}; // A flush through the bus was requested and is not done yet
+
+   uint32_t _ltchdWrtSeq{0}; // Sequence number of the last lock-free write latched to the outputs
+   uint8_t _asyncTskSt{0};   // Asynchronous flushing task state: 0 not created, 1 being created, 2 running
+   bool _asyncTskEnd{false};
+   TaskHandle_t _asyncTskHndl{nullptr};
+   BaseType_t _asyncTskPrrty{configMAX_PRIORITIES - 2};
+   SRGXAsyncWtr* _asyncWtrsPtr{nullptr};  // Waiters for the asynchronous writes completion, allocated with the flushing task
+   uint8_t _asyncWtrsQty{0};
+   static const uint8_t _maxAsyncWtrsQty{8};
+   portMUX_TYPE _asyncMux = portMUX_INITIALIZER_UNLOCKED;  // Spinlock protecting the waiters list
+   uint32_t* _asyncWrtsSeqPtr{nullptr};   // Asynchronous writes queue, applied to the Main Buffer by the flushing task, allocated with it. Sequence number of each write
+   uint8_t* _asyncWrtsMskPtr{nullptr}; // Mask of each write, getSrQty() bytes per write
+   uint8_t* _asyncWrtsValsPtr{nullptr};   // Values of each write, getSrQty() bytes per write
+   uint8_t _asyncWrtsHd{0};   // Oldest write queued
+   uint8_t _asyncWrtsQty{0};
+   static const uint8_t _asyncWrtsDpth{8};
+   portMUX_TYPE _asyncWrtsMux = portMUX_INITIALIZER_UNLOCKED;  // Spinlock protecting the writes queue, the sequence numbers are assigned in the queue order
+
+   SRGXRemapReg* _rmpRegsPtr{nullptr}; // Logical to physical remapping tables, grouped by logical register, nullptr if no remapping is set
+   uint16_t _rmpRegsQty{0};
+   uint8_t* _physImgPtr{nullptr};   // Physical image sent by the flush when a remapping is set
+   uint8_t* _lgclPrvFrmPtr{nullptr};   // Logical frame latched by the last flush, kept from the first beginObservers() or addInterlock() on
+   uint8_t* _lgclCurFrmPtr{nullptr};   // Logical frame being shifted out, copied from the Main Buffer
+
+   static const uint8_t _maxIlcksQty{16};
+   uint32_t* _ilckMsksPtr{nullptr}; // Interlock groups pins masks, Main Buffer layout padded to 32-bits words, see addInterlock()
+   uint32_t _ilckDeadTmUs[_maxIlcksQty]{};
+   static const uint32_t _maxIlckSpinUs{100};  // Longest dead time busy-waited, longer ones are waited blocking the flushing task
+   static const uint32_t _maxIlckDeadTmUs{1000000};
+   uint8_t _ilcksQty{0};
+   uint8_t* _ilckBrkFrmPtr{nullptr};   // Break frame of the break-before-make sequence
+   uint32_t _ilckBrksQty{0};  // Break-before-make sequences emitted
+   uint32_t _ilckFltsQty{0};  // Frames requesting more than one pin of a group set, sent with the group pins reset
+
+   uint8_t** _snpshtSlotsPtr{nullptr}; // Snapshot slots, preallocated by beginSnapshots()
+   uint8_t _snpshtsQty{0};
+   static const uint8_t _maxSnpshtsQty{16};
+   uint16_t _snpshtStgdMsk{0};   // Bit n set if the slot n holds a staged image
+
+   uint8_t* _trcRngPtr{nullptr}; // Latched frames trace recorder ring buffer, nullptr if not tracing, see beginTrace()
+   uint32_t _trcRngSize{0};
+   uint32_t _trcTail{0};   // Ring buffer offset of the oldest record
+   uint32_t _trcUsed{0};   // Ring buffer bytes used by the records
+   uint32_t _trcLostQty{0};   // Records evicted to make room for the newer ones
+   uint32_t _trcSeq{0}; // Trace seqlock sequence, odd while a record is being added
+   uint8_t* _trcBaseFrmPtr{nullptr};   // Frame preceding the oldest record
+   uint8_t* _trcPrvFrmPtr{nullptr}; // Frame latched by the newest record
+   uint8_t* _trcCurFrmPtr{nullptr}; // Frame being shifted out
+   uint8_t* _trcRecPtr{nullptr}; // Record being built
+   SRGXTrcApi _trcApi{trcApiNone};  // API method that requested the flush in progress, see _sendAllSRCntnt(const SRGXTrcApi&)
+   uint32_t _trcWrstCycles{0};   // Worst observed recording time, in CPU cycles
+
+   uint8_t _oe{0xFF};   // 74HCx595 OE line pin, 0xFF if not used, see setOEPin()
+   uint8_t _oeLedcChnl{0xFF}; // LEDC channel driving the OE line, 0xFF if not dimming, see beginOEDimming()
+   uint32_t _oeMaxDuty{0}; // LEDC duty keeping the OE line HIGH for the whole period, equal to the maximum brightness
+   uint32_t _oeBrghtns{0};
+   uint32_t _oeLedcSig{0}; // GPIO matrix output signal of the LEDC channel, reconnected to the OE pin when a blanking ends
+   bool _oeBlnkFlsh{false};  // The outputs are disabled while the chain is shifted, see setOEBlanking()
+   SRGXStateStore* _stStorePtr{nullptr};  // Store the latched image is persisted to, see setStateStore()
+   uint32_t _stCoalesceMs{0}; // Time window the latched image changes are coalesced in before saving them
+   uint8_t* _stSavedPtr{nullptr};   // Image held by the store
+   uint8_t* _stImgPtr{nullptr};  // Image being saved
+   bool _stRestored{false};   // The Main Buffer initial contents were loaded from the store
+   bool _stTskEnd{false};
+   TaskHandle_t _stTskHndl{nullptr};
+
+   QueueHandle_t _obsQueue{nullptr};   // Outputs change notifications queue, nullptr if the notifications were not begun, see beginObservers()
+   bool _obsEn{false};  // The flushes queue the outputs change notifications
+   uint32_t* _obsItemPtr{nullptr};  // Notification being built: latch number, timestamp, coalesced latches, changes mask words and values words
+   uint32_t* _obsRcvdPtr{nullptr};  // Notification being delivered by the dispatching task
+   uint32_t _obsLtchsQty{0};
+   bool _obsPndng{false};  // The notification being built holds changes not queued yet
+   static const uint8_t _maxObsRegsQty{8};
+   SRGXObsReg _obsRegs[_maxObsRegsQty]{}; // Observers registered, see addObserver()
+   uint8_t _obsRegsQty{0};
+   portMUX_TYPE _obsMux = portMUX_INITIALIZER_UNLOCKED;  // Spinlock protecting the observers list
+   TaskHandle_t _obsTskHndl{nullptr};
+
+   /*SRGXPinsLstOp: Operations applied to the pins lists by _applyPinsLst()*/
+   enum SRGXPinsLstOp : uint8_t{
+      _lstWrite,
+      _lstSet,
+      _lstReset,
+      _lstToggle
+   };
+
+   /**
+    * @brief Adds a task or a coroutine to the asynchronous writes waiters list.
+    * 
+    * @param wrtSeq Sequence number of the write waited for.
+    * @param tskHndl Task to be notified when the write is latched, nullptr for a coroutine.
+    * @param crtnAddr Address of the coroutine to be resumed when the write is latched, nullptr for a task.
+    * 
+    * @retval true The waiter was added.
+    * @retval false The waiters list is full, or the flushing task was not created.
+    */
+   bool _addAsyncWtr(const uint32_t &wrtSeq, TaskHandle_t tskHndl, void* crtnAddr);
+   /**
+    * @brief Asynchronous flushing task, flushes the Main Buffer when asynchronous writes are pending and signals the waiters of the writes latched.
+    */
+   static void _asyncTsk(void* argp);
+   /**
+    * @brief Disables or enables the outputs through the OE line, see setOEBlanking(const bool&).
+    * 
+    * When the OE line is driven by a LEDC channel the pin is disconnected from the channel and driven HIGH through the GPIO matrix, so the outputs are disabled immediately instead of at the end of the running PWM period. When enabled the pin is reconnected to the channel, that kept running with the dimming duty. The method only uses ROM and inlined register accesses, so it's safe to be invoked from the IRAM resident flushing code.
+    * 
+    * @param blank true to disable the outputs, false to enable them.
+    */
+   void _blankOE(const bool &blank);
+   /**
+    * @brief Transforms the Main Buffer logical image into the physical image sent by the flush.
+    * 
+    * The physical image is built in a single pass over the remapping tables, two lookups per logical and physical registers pair, so the cost depends on the quantity of shift registers and not on the quantity of pins.
+    * 
+    * @param lgclImgPtr Pointer to the logical image, the Main Buffer or a copy of it.
+    * 
+    * @note Each logical register is read once, so all it's pins are sent from the same Main Buffer value even if lock-free writes are in progress.
+    */
+   void _buildPhysImg(const uint8_t* lgclImgPtr);
    /**
     * @brief A private version of the copyMainToAux() method
     * 
@@ -71,48 +494,390 @@ private:
     * @note The method is used by the copyMainToAux() method, which takes care of the mutexes before calling this method.
     */
    bool _copyMainToAux(const bool &overWriteIfExists = true);
+   /**
+    * @brief Allocates a zero filled buffer for the Main or the Auxiliary Buffer.
+    * 
+    * The buffer is allocated as 32-bits words, as needed by _mainMskdWrt(). If the SRGX_IRAM_HOT_PATHS build flag is set, the buffer is allocated in internal DRAM.
+    * 
+    * @param bytesQty Size of the buffer in bytes.
+    * 
+    * @return Pointer to the buffer allocated.
+    */
+   static uint8_t* _allocBffr(const uint8_t &bytesQty);
+   /**
+    * @brief Allocates the logical frames kept by the flush, the preceding frame is initialized with the Main Buffer contents.
+    * 
+    * @note Executed with the Main Buffer mutex taken, or before the object is begun. The frames are kept until the object is destructed.
+    */
+   void _allocLgclFrms();
+   /**
+    * @brief Validates the logical frame to be shifted out against the interlock groups and the frame latched last, building the break frame if needed.
+    * 
+    * The checks are done word-wise, a group at a time:
+    * - A frame setting more than one pin of a group is fixed by resetting every pin of the group, as the safe state.
+    * - A frame setting a pin of a group while other pin of the group was set in the frame latched last would switch both at once, so the break frame is built from the frame with the pins being set of those groups kept reset.
+    * 
+    * @param deadTmUs Variable where the longest dead time of the groups needing the break frame is stored.
+    * 
+    * @retval true The break frame must be latched before the frame, and both separated by deadTmUs microseconds.
+    * @retval false The frame might be latched directly.
+    * 
+    * @note Executed by the flush, with the Main Buffer mutex taken.
+    */
+   bool _applyIlcks(uint32_t &deadTmUs);
+   /**
+    * @brief Applies the asynchronous writes queued to the Main Buffer, in the queue order, and flushes them.
+    * 
+    * Invoked by the asynchronous flushing task, the writes are applied by the Main Buffer mutex taking, see _takeMainBffr() and _drainAsyncWrts(). See _reqAsyncFlush().
+    */
+   void _applyAsyncWrts();
+   /**
+    * @brief Applies an operation to a list of pins in a single Main Buffer mutex taking, and flushes the Main Buffer once.
+    * 
+    * Consecutive items of the list belonging to the same shift register are merged in a single masked write, so lists sorted by pin number are applied a register at a time, see _mainMskdWrt(). The whole list is validated before any pin is modified.
+    * 
+    * @param lstOp Operation to apply, see SRGXPinsLstOp.
+    * @param itemsPtr Pointer to the pin and value pairs list, used by the _lstWrite operation.
+    * @param pinsPtr Pointer to the pins list, used by the rest of the operations.
+    * @param itemsQty Number of items in the list.
+    * @param trcApi API method requesting the flush, see SRGXTrcApi.
+    * 
+    * @retval true The pins were modified and flushed.
+    * @retval false The list pointer was a nullptr, the list was empty, a pin was out of range or reserved, or the Main Buffer mutex could not be taken.
+    */
+   bool _applyPinsLst(const SRGXPinsLstOp &lstOp, const SRGXPinValue* itemsPtr, const uint8_t* pinsPtr, const size_t &itemsQty, const SRGXTrcApi &trcApi);
    /**
     * @brief A private version of the discardAux() method
     * 
     * This method is used internally to discard the Auxiliary Buffer, without taking care of the mutexes, it is used by calling parties that already have the mutexes taken, and thus are not in danger of concurrent access to the Auxiliary Buffer, and deadlockings due to nested mutexes.
     */
    void _discardAux();
+   /**
+    * @brief Applies the asynchronous writes queued to the Main Buffer, in the queue order.
+    * 
+    * Invoked with the Main and the Auxiliary Buffer mutexes taken, before any other Main or Auxiliary Buffer access, so every write queued is applied before the later operations of the same or other tasks, whichever task takes the mutex first. If the Auxiliary Buffer exists the writes are applied to it too, as it's copy of the pins written is older than the writes.  
+    * Every method taking the Main Buffer mutex to modify, copy, commit over or flush the Main Buffer invokes it, directly or through _takeMainBffr(const SRGXTrcApi&), the snapshot and remapping methods and beginInput() included. The lock-free writes of the reserved pins, which no write queued targets, don't.
+    */
+   void _drainAsyncWrts();
+   /**
+    * @brief Releases a buffer allocated by _allocBffr(), setting the pointer to nullptr.
+    * 
+    * @param bffrPtr Reference to the pointer to the buffer to release, nullptr pointers are accepted.
+    */
+   static void _freeBffr(uint8_t* &bffrPtr);
+   /**
+    * @brief Releases the Main Buffer mutex taken by _takeMainBffr(), optionally flushing the Main Buffer before releasing it.
+    * 
+    * @param flush Indicates if the Main Buffer must be flushed before releasing the mutex.
+    * @param trcApi API method requesting the flush, see SRGXTrcApi.
+    */
+   void _giveMainBffr(const bool &flush, const SRGXTrcApi &trcApi);
+   /**
+    * @brief Checks a pin might be used as the QH' loop-back input.
+    * 
+    * @param lpbkPin The pin to check.
+    * 
+    * @retval true The pin is a valid GPIO, and it's not one of the chain lines: DS, SH_CP, ST_CP, OE if set, or the 74HCx165 QH and SH/LD lines if the input chain was begun.
+    * @retval false The pin is not valid, or it's already used by the chain.
+    * 
+    * @note The Main Buffer mutex must be taken by the calling party, if the object was begun.
+    */
+   bool _lpbkPinVld(const uint8_t &lpbkPin);
+   /**
+    * @brief Verifies the chain transfers at the bit time delay set, through the QH' loop-back.
+    * 
+    * Test patterns are shifted through the chain with no latching, each one read back through the QH' output while the next one is shifted in, so the outputs are not modified.
+    * 
+    * @param passesQty Quantity of test patterns to round-trip.
+    * 
+    * @retval true Every test pattern was read back unaltered.
+    * @retval false A test pattern was altered.
+    * 
+    * @note The Main Buffer mutex must be taken by the calling party.
+    */
+   bool _lpbkTest(const uint8_t &passesQty);
+   /**
+    * @brief Atomically modifies a Main Buffer byte.
+    * 
+    * The byte is modified as ((byte & ~msk) | (vals & msk)) ^ tgglMsk through a compare-and-swap over the 32-bits word containing it, so that the modification is never lost to a concurrent lock-free write performed by an exclusive SRGXVPort over a different set of pins of the same word.  
+    * 
+    * @param bffrIdx Index of the Main Buffer byte to modify. The valid range is 0 <= bffrIdx < getSrQty().
+    * @param msk Bits of the byte to be overwritten.
+    * @param vals Values for the bits set in msk.
+    * @param tgglMsk Bits of the byte to be toggled after the overwriting.
+    * 
+    * @note Every Main Buffer modification is done through this method, the calling parties are expected to have the Main Buffer mutex taken, with the only exception of _stampSgmntLckFree().  
+    */
+   void _mainMskdWrt(const uint8_t &bffrIdx, const uint8_t &msk, const uint8_t &vals, const uint8_t &tgglMsk = 0x00);
+   /**
+    * @brief Atomically modifies the pins of a Main Buffer byte not reserved by an exclusive SRGXVPort, a SRGXMuxScanner or a SRGXStepperEng.
+    * 
+    * The masks are cleared of the reserved pins and the modification is applied by _mainMskdWrt(), so the bulk writers never overwrite the pins owned by other objects. The parameters are the same as _mainMskdWrt().
+    */
+   void _mainUnrsrvdWrt(const uint8_t &bffrIdx, const uint8_t &msk, const uint8_t &vals, const uint8_t &tgglMsk = 0x00);
    /**
     * @brief A private version of the moveAuxToMain() method
     * 
     * This method is used internally to move the contents of the Auxiliary Buffer to the Main Buffer, without taking care of the mutexes, it is used by calling parties that already have the mutexes taken, and thus are not in danger of concurrent access to the Auxiliary Buffer, and deadlockings due to nested mutexes.
     * 
+    * @param trcApi API method requesting the flush, see SRGXTrcApi.
+    * 
     * @return A boolean value indicating the success of the operation.
     * @retval true The Auxiliary Buffer was successfully moved to the Main Buffer, and the Auxiliary Buffer was discarded.
     * @return false The Auxiliary Buffer move operation failed, either because the Auxiliary Buffer does not exist or because the Main Buffer is not available for writing.
     */
-   bool _moveAuxToMain();
+   bool _moveAuxToMain(const SRGXTrcApi &trcApi);
+   /**
+    * @brief Notifies the tasks and resumes the coroutines waiting for writes already latched, removing them from the waiters list.
+    * 
+    * @note Executed by the asynchronous flushing task, without the Main Buffer mutex taken.
+    */
+   void _notifyAsyncWtrs();
+   /**
+    * @brief Outputs change notifications dispatching task, delivers the queued notifications to the observers registered.
+    * 
+    * The observers list is copied under it's spinlock and the callbacks are invoked out of it, so the observers might be added or removed from the callbacks themselves. The task ends itself when it receives the ending notification -latch number 0- queued by endObservers().
+    */
+   static void _obsTsk(void* argp);
+   /**
+    * @brief Queues the outputs change notification for the frame just latched.
+    * 
+    * The frame latched is compared word-wise against the preceding one and the changed bits are accumulated in the notification being built. The notification is queued without waiting: if the queue is full the changes are kept and folded into the notification of the next latch, so the flush is never extended by slow observers and no change is lost. Latches that modified no pin are not notified.
+    * 
+    * @param ltchd true when invoked by the flush for the frame just latched, false to retry queueing the notification pending, as done by the dispatching task when it empties the queue.
+    * 
+    * @note Executed with the Main Buffer mutex taken.
+    */
+   void _postObsDiff(const bool &ltchd);
+   /**
+    * @brief Adds the frame just latched to the trace recorder ring buffer.
+    * 
+    * The record holds the timestamp, the calling task, the flush requesting API method and the registers that changed from the previous frame. The oldest records are evicted -and folded into the base frame- to make room for it.
+    * 
+    * @note Executed by the flush, with the Main Buffer mutex taken, so there's a single writer. The readers are synchronized by the _trcSeq seqlock, see dumpTrace(uint8_t*, const uint32_t&).
+    */
+   void _recTrcFrm();
+   /**
+    * @brief Releases the pins reserved by an exclusive SRGXVPort.
+    * 
+    * @param pinsMskPtr Pointer to a Main Buffer sized mask, with the bits set for the pins to release.
+    * 
+    * @retval true The pins were released.
+    * @retval false The mask pointer provided was a nullptr.
+    */
+   bool _releasePins(const uint8_t* pinsMskPtr);
+   /**
+    * @brief Frees the outputs change notifications frames and items buffers.
+    */
+   void _releaseObsRsrcs();
+   /**
+    * @brief Frees the trace recorder frames and record buffers, the ring buffer is freed by the calling party.
+    */
+   void _releaseTrcRsrcs();
+   /**
+    * @brief Reads a list of Main Buffer bytes under the Main Buffer mutex.
+    * 
+    * As with every other reading method, if the Auxiliary Buffer exists it is moved to the Main Buffer before reading.
+    * 
+    * @param bffrIdxPtr Pointer to the list of Main Buffer indexes to read.
+    * @param bytesQty Number of indexes in the list.
+    * @param valsPtr Pointer to the memory area where the bytes read will be stored, at least bytesQty bytes long.
+    * @param trcApi API method reading, identifies the flush of the Auxiliary Buffer moved, see SRGXTrcApi.
+    * 
+    * @retval true The bytes were read.
+    * @retval false A pointer parameter was a nullptr or the Main Buffer mutex could not be taken.
+    */
+   bool _readBytesFromMain(const uint8_t* bffrIdxPtr, const uint8_t &bytesQty, uint8_t* valsPtr, const SRGXTrcApi &trcApi);
+   /**
+    * @brief Reads a consistent copy of a range of the Input Image bytes.
+    * 
+    * The Input Image is protected by a seqlock: the reading is retried if a flush published new inputs while it was being copied, so the reader never blocks the flushing task nor takes any mutex.  
+    * 
+    * @param frstIdx Index of the first Input Image byte to read.
+    * @param bytesQty Number of bytes to read, the range is expected to be validated by the calling party.
+    * @param valsPtr Pointer to the memory area where the bytes read will be stored, at least bytesQty bytes long.
+    */
+   void _readInImg(const uint8_t &frstIdx, const uint8_t &bytesQty, uint8_t* valsPtr);
+   /**
+    * @brief Reserves pins for the exclusive use of a SRGXVPort.
+    * 
+    * The reservation is an all or nothing operation: if any of the pins in the mask is already reserved no pin is reserved.
+    * 
+    * @param pinsMskPtr Pointer to a Main Buffer sized mask, with the bits set for the pins to reserve.
+    * 
+    * @retval true The pins were free and are now reserved.
+    * @retval false At least one of the pins was already reserved, or the mask pointer provided was a nullptr.
+    */
+   bool _reservePins(const uint8_t* pinsMskPtr);
+   /**
+    * @brief Sequences an asynchronous write and requests it's flushing to the asynchronous flushing task, creating it if needed.
+    * 
+    * Two kinds of writes are sequenced:
+    * - The lock-free writes of the exclusive SRGXVPort objects, already applied to their reserved pins of the Main Buffer (mskPtr is nullptr).
+    * - The writes to the shared pins, which must not bypass the Main Buffer mutex: the mask and values pair is queued, and the first task taking the mutex -the flushing task or any later Main Buffer operation- applies it, so a later Auxiliary or snapshot move can not overwrite it with older values, nor a later write be overtaken by it. See _drainAsyncWrts(). The pins reserved by other objects keep their value, see _mainUnrsrvdWrt().
+    * 
+    * @param wrtSeq Variable to store the sequence number of the write.
+    * @param bffrIdxPtr Optional parameter. Pointer to the list of Main Buffer indexes of the queued write, nullptr for the bytes 0 to (bytesQty - 1).
+    * @param mskPtr Optional parameter. Pointer to the list of masks of the queued write, nullptr for a lock-free write already applied.
+    * @param valsPtr Optional parameter. Pointer to the list of values of the queued write.
+    * @param bytesQty Optional parameter. Number of bytes in the lists.
+    * 
+    * @retval true The flush was requested.
+    * @retval false The asynchronous flushing task could not be created.
+    * 
+    * @note If the queue is full the method waits for the flushing task to apply the oldest write queued.
+    */
+   bool _reqAsyncFlush(uint32_t &wrtSeq, const uint8_t* bffrIdxPtr = nullptr, const uint8_t* mskPtr = nullptr, const uint8_t* valsPtr = nullptr, const uint8_t &bytesQty = 0);
+   /**
+    * @brief Removes a task or a coroutine from the asynchronous writes waiters list.
+    * 
+    * @retval true The waiter was found and removed.
+    * @retval false The waiter was not in the list, i.e. it was already notified or resumed.
+    */
+   bool _rmvAsyncWtr(TaskHandle_t tskHndl, void* crtnAddr);
    /**
     * @brief Flushes the contents of the Main Buffer to the GPIO Expander pins.  
     * 
+    * If the object is registered with a SRGXBus object, the flush is arbitrated by the bus -that might coalesce it with the flushes of the rest of the objects registered- otherwise the contents are directly sent by _sendChainCntnt().  
+    * 
+    * @param trcApi API method requesting the flush, recorded by the trace recorder, see SRGXTrcApi.
+    * 
+    * @return true if the operation succeeds.  
+    */
+   bool _sendAllSRCntnt(const SRGXTrcApi &trcApi);
+   /**
+    * @brief Sends the contents of the Main Buffer through the DS and SH_CP lines and latches them.  
+    * 
     * The **private method** will ensure the object's Main Buffer is updated -if there are modifications pending in the Auxiliary Buffer- enable the hardware to receive the information, invoke the needed methods to send the information required to each physical shift register and activate the shift registers latching function, that sets the output pins levels to the Main Buffer values.  
     * 
     * @return true if the operation succeeds.  
     * 
+    * The flush duration is registered for the flushing instrumentation, see setFlushPolicy(const SRGXFlushPolicy&, const uint32_t&). If interlock groups are set and the frame would switch two pins of a group at once, the break frame is latched first, see _applyIlcks(uint32_t&).  
+    * 
     * @note The adoption of a boolean type return value is a consideration for future development that may consider the method operation to fail. At this development stage there's no conditions that would produce such outcome.  
     * 
     * @warning The Auxiliary buffer is a non permanent memory array, it will be deleted after moving it's contents to the Main Buffer 
     */
-   bool _sendAllSRCntnt();
+   bool _sendChainCntnt();
    /**
     * @brief Sends the content of a single byte to a Shift Register. 
     * 
     * The method's action is limited to filling the shift register's internal buffer, but it does not latch it (it does not set the output pins of the shfit register to the buffered value). The latching must be done by the calling party, when the contents of all the shift registers are set to the desired values. The usual calling of this method is done by the _sendAllSRCntnt() method, which will flush the contents of the Main Buffer to the shift registers array.  
     * 
     * @param data The byte to be sent to the shift register, the bits in the byte will be sent in the order from MSB to LSB (MSB First). 
+    * @param rcvdDataPtr Optional parameter. If not nullptr, the byte simultaneously shifted out of the 74HCx165 input chain is stored in the pointed variable, MSB first (the first bit sampled is the H input).
+    * @param lpbkDataPtr Optional parameter. If not nullptr, the byte simultaneously shifted out of the last 74HCx595 QH' output is stored in the pointed variable, MSB first, see setLoopbackCheck(const uint8_t&, const uint32_t&).
     * 
     * @return true Allways true, as the method does not have any condition that would produce a failure in the operation. The boolean type return value is a consideration for backward compatibility with previous versions.
     */
-   bool _sendSnglSRCntnt(const uint8_t &data); 
+   bool _sendSnglSRCntnt(const uint8_t &data, uint8_t* rcvdDataPtr = nullptr, uint8_t* lpbkDataPtr = nullptr); 
+   /**
+    * @brief Shifts a logical frame out and latches it.
+    * 
+    * The frame is remapped to the physical image if a remapping is set, the inputs are parallel loaded to be captured by the same clock train, and the bit train is protected from preemption as set by the flushing policy. The frame latched is added to the trace recorder if it was started. If the loop-back integrity check is set, the frame shifted out of the chain through QH' is compared against the one shifted in by the preceding bit train.
+    * 
+    * @param lgclFrmPtr Pointer to the logical frame, the Main Buffer or a copy of it.
+    * 
+    * @return true Allways true, as the method does not have any condition that would produce a failure in the operation.
+    */
+   bool _shiftOutFrm(const uint8_t* lgclFrmPtr);
+   /**
+    * @brief Stamps a segment of consecutive pins over the Main Buffer, without flushing it.
+    * 
+    * The segment bits are accumulated per Main Buffer byte, so that each byte touched is modified in a single _mainMskdWrt() operation.  
+    * 
+    * @param newSgmntPtr Pointer to the right aligned segment values, see stampSgmntOverMain(uint8_t*, const uint8_t&, const uint8_t&).
+    * @param strtPin First pin of the segment.
+    * @param pinsQty Number of pins in the segment.
+    * @param keepRsrvd Optional parameter. If true the pins reserved by other objects keep their value, see _mainUnrsrvdWrt(). False for the owner of the pins (default true).
+    * 
+    * @return Allways true, the parameters are expected to be validated by the calling party.
+    */
+   bool _stampSgmnt(const uint8_t* newSgmntPtr, const uint8_t &strtPin, const uint8_t &pinsQty, const bool &keepRsrvd = true);
+   /**
+    * @brief Modifies a list of Main Buffer bytes without taking the Main Buffer mutex, and flushes the Main Buffer.
+    * 
+    * See _stampSgmntLckFree() for the lock-free writing mechanism, this method is the byte list version used by the exclusive scatter/gather SRGXVPort objects.
+    * 
+    * @param bffrIdxPtr Pointer to the list of Main Buffer indexes to modify.
+    * @param mskPtr Pointer to the list of bits to be overwritten in each byte, or nullptr if no bit is overwritten.
+    * @param valsPtr Pointer to the list of values for the bits set in each mask, or nullptr for all values 0.
+    * @param tgglPtr Pointer to the list of bits to be toggled in each byte, or nullptr if no bit is toggled.
+    * @param bytesQty Number of bytes in the lists.
+    * @param trcApi API method requesting the flush, see SRGXTrcApi. Not used if the flush is requested to the asynchronous flushing task.
+    * @param asyncWrtSeqPtr Optional parameter. If not nullptr the flush is requested to the asynchronous flushing task instead of being done by the method, and the sequence number of the write is stored in the pointed variable, see _reqAsyncFlush(uint32_t&).
+    * 
+    * @retval true The bytes were modified and flushed, or the flush was requested.
+    * @retval false The indexes list pointer was a nullptr, the Main Buffer mutex could not be taken, or the flush could not be requested.
+    */
+   bool _stampBytesLckFree(const uint8_t* bffrIdxPtr, const uint8_t* mskPtr, const uint8_t* valsPtr, const uint8_t* tgglPtr, const uint8_t &bytesQty, const SRGXTrcApi &trcApi, uint32_t* asyncWrtSeqPtr = nullptr);
+   /**
+    * @brief Modifies a list of Main Buffer bytes and flushes the Main Buffer, in a single Main Buffer mutex taking.
+    * 
+    * The pins reserved by other objects keep their value, see _mainUnrsrvdWrt().
+    * 
+    * @param bffrIdxPtr Pointer to the list of Main Buffer indexes to modify.
+    * @param mskPtr Pointer to the list of bits to be overwritten in each byte.
+    * @param valsPtr Pointer to the list of values for the bits set in each mask.
+    * @param bytesQty Number of bytes in the lists.
+    * @param trcApi API method requesting the flush, see SRGXTrcApi.
+    * 
+    * @retval true The bytes were modified and flushed.
+    * @retval false A pointer parameter was a nullptr or the Main Buffer mutex could not be taken.
+    */
+   bool _stampBytesOverMain(const uint8_t* bffrIdxPtr, const uint8_t* mskPtr, const uint8_t* valsPtr, const uint8_t &bytesQty, const SRGXTrcApi &trcApi);
+   /**
+    * @brief Modifies a segment of up to 16 consecutive pins without taking the Main Buffer mutex, and flushes the Main Buffer.
+    * 
+    * The method is used by the SRGXVPort objects whose pins are reserved for their exclusive use (see SRGXVPort::reservePins()). As no other SRGXVPort can write those pins the Main Buffer is modified through atomic masked operations (see _mainMskdWrt()), and only the flush is serialized by the Main Buffer mutex. If a flush started after the modification was applied the flush is skipped, as the modification was already sent to the shift registers.  
+    * 
+    * @param strtPin First pin of the segment.
+    * @param pinsQty Number of pins in the segment, 1 <= pinsQty <= 16.
+    * @param sgmntMsk Right aligned mask of the segment bits to be overwritten.
+    * @param sgmntVals Right aligned values for the bits set in sgmntMsk.
+    * @param sgmntTggl Right aligned mask of the segment bits to be toggled.
+    * @param trcApi API method requesting the flush, see SRGXTrcApi. Not used if the flush is requested to the asynchronous flushing task.
+    * @param asyncWrtSeqPtr Optional parameter. If not nullptr the flush is requested to the asynchronous flushing task, see _stampBytesLckFree().
+    * 
+    * @retval true The segment was modified and flushed, or the flush was requested.
+    * @retval false The parameters were not valid, the Main Buffer mutex could not be taken, or the flush could not be requested.
+    * 
+    * @attention The Auxiliary Buffer is not moved to the Main Buffer by this method, and when moved by other methods the reserved pins are not overwritten, see moveAuxToMain().
+    */
+   bool _stampSgmntLckFree(const uint8_t &strtPin, const uint8_t &pinsQty, const uint16_t &sgmntMsk, const uint16_t &sgmntVals, const uint16_t &sgmntTggl, const SRGXTrcApi &trcApi, uint32_t* asyncWrtSeqPtr = nullptr);
+   /**
+    * @brief State persisting task, saves the latched image to the store at most once every coalescing time window.
+    * 
+    * The task is notified by every flush, the first notification opens the coalescing window and the following ones are absorbed by it. The Main Buffer image is then copied under the Main Buffer mutex and saved out of it, only if it differs from the image held by the store, so the flash based stores are written once per burst of changes. When ended, a pending image is saved before the task deletes itself.
+    */
+   static void _stTsk(void* argp);
+   /**
+    * @brief Takes the Main Buffer mutex for a multi-step Main Buffer operation, moving the Auxiliary Buffer to the Main Buffer if it exists.
+    * 
+    * The Main Buffer consistency procedures are the same followed by every Main Buffer modification method. The mutex must be released by the _giveMainBffr(const bool&, const SRGXTrcApi&) method.
+    * 
+    * @param trcApi API method taking the mutex, identifies the flush of the Auxiliary Buffer moved, see SRGXTrcApi.
+    * 
+    * @retval true The Main Buffer mutex was taken.
+    * @retval false The Main Buffer mutex could not be taken.
+    */
+   bool _takeMainBffr(const SRGXTrcApi &trcApi);
+   /**
+    * @brief Takes the snapshot slots mutex, staging the slot from the Main Buffer contents if it was empty.
+    * 
+    * The Main Buffer is taken through _takeMainBffr(const SRGXTrcApi&) before the snapshot slots mutex, and held while the staging condition is checked and the slot staged, so the Main Buffer is never copied while a flush or a writing method modifies it.
+    * 
+    * @param slot Index of the snapshot slot.
+    * 
+    * @retval true The slot is staged and the snapshot slots mutex was taken, the caller must give it back.
+    * @retval false The slot index was not valid, or the mutexes could not be taken.
+    */
+   bool _takeSnpsht(const uint8_t &slot);
 
 protected:
-   SemaphoreHandle_t _SRGXAuxBffrMtx; // Mutex to protect the Auxiliary Buffer from concurrent access
-   SemaphoreHandle_t _SRGXMnBffrMtx; // Mutex to protect the Main Buffer from concurrent access
+   SemaphoreHandle_t _SRGXAuxBffrMtx{nullptr}; // Mutex to protect the Auxiliary Buffer from concurrent access
+   SemaphoreHandle_t _SRGXMnBffrMtx{nullptr}; // Mutex to protect the Main Buffer from concurrent access
+   SemaphoreHandle_t _SRGXSnpshtMtx{nullptr}; // Mutex to protect the snapshot slots from concurrent access, taken after the Main Buffer mutex and before the Auxiliary Buffer mutex when they are needed together
 
    uint8_t* _mainBuffrArryPtr{};
    uint8_t* _auxBuffrArryPtr{nullptr};
@@ -134,33 +899,205 @@ public:
     * @param st_cp MCU GPIO pin connected to the ST_CP pin -a.k.a. storage register clock input- to set (latch) the output pins from the internal buffer of the expander
     * @param srQty Optional parameter. Quantity of shift registers set in daisy-chain configuration composing the expander.
     * 
-    * @note The object will create a dynamic array to buffer the information written to the shift registers, it will be referred to as the **Main Buffer**, **the Buffer** or **the Main**.  
-    * The action of sending the Buffer contents to the shift registers array will be reffered as **Flushing**. Every time the Buffer is **flushed** to the shift registers array the whole contents of that array will be sent.  
-    * A secondary dynamic array will be created for delayed operations purposes, that buffer will be referred to as the **Auxiliary Buffer** or **the Auxiliary**. The Auxiliary will be created every time it's needed and destroyed after it's temporary use becomes unnecessary. The Auxiliary will be used to allow several bit changing operations without the need of flushing the whole buffer for each bit change. The usual propper use of the mechanism will make all the bits changes that occur simultaneously to the Auxiliary Buffer and then **moving** the Auxiliary Buffer to the Main Buffer and flushing the Buffer.  
+    * @note The object will create a dynamic array to buffer the information written to the shift registers, it will be referred to as the **Main Buffer**, **the Buffer** or **the Main**.  
+    * The action of sending the Buffer contents to the shift registers array will be reffered as **Flushing**. Every time the Buffer is **flushed** to the shift registers array the whole contents of that array will be sent.  
+    * A secondary dynamic array will be created for delayed operations purposes, that buffer will be referred to as the **Auxiliary Buffer** or **the Auxiliary**. The Auxiliary will be created every time it's needed and destroyed after it's temporary use becomes unnecessary. The Auxiliary will be used to allow several bit changing operations without the need of flushing the whole buffer for each bit change. The usual propper use of the mechanism will make all the bits changes that occur simultaneously to the Auxiliary Buffer and then **moving** the Auxiliary Buffer to the Main Buffer and flushing the Buffer.  
+    * 
+    * @note There is no mechanism to flush the **Auxiliary** straight to the shift registers.  
+    * 
+    * @attention Every method that invokes a Main Buffer modification -see digitalWriteSr(const uint8_t, const uint8_t), digitalWriteSrAllReset(), digitalWriteSrAllSet(), digitalWriteSrMaskReset(uint8_t*), digitalWriteSrMaskSet(uint8_t*) - and/or flushing -see bool _sendAllSRCntnt() - will force first the Auxiliary to be moved over the Main Buffer, destroy the Auxiliary, perform the intended operation over the Main Buffer and then finally flush the resulting Main Buffer contents to the shift registers. This procedure is enforced to guarantee buffer contents consistency and avoid any loss of modifications done to the Auxiliary. The digitalReadSr(const uint8_t) method will also invoke a moveAuxToMain() before returning the requested pin state. See digitalReadSr(const uint8_t) for more information.
+    */
+   ShiftRegGPIOXpander(uint8_t ds, uint8_t sh_cp, uint8_t st_cp, uint8_t srQty = 1);
+   /**
+    * @brief Copy constructor, deleted.
+    * 
+    * The object owns the Main Buffer, the Auxiliary Buffer and the mutexes protecting them, a copy would share those resources with the original object, leading to their double release when both objects are destructed.
+    */
+   ShiftRegGPIOXpander(const ShiftRegGPIOXpander&) = delete;
+   /**
+    * @brief Copy assignment operator, deleted.
+    * 
+    * See ShiftRegGPIOXpander(const ShiftRegGPIOXpander&) for the reasons of the deletion.
+    */
+   ShiftRegGPIOXpander& operator=(const ShiftRegGPIOXpander&) = delete;
+   /**
+    * @brief Class destructor
+    * 
+    * Takes care of resources releasing
+    */
+   ~ShiftRegGPIOXpander();
+   /**
+    * @brief Adds an interlock group, a set of pins that must never be set at the same time (i.e. the high and low side drivers of a H-bridge leg, or the star and delta contactors of a motor starter).
+    * 
+    * Every frame flushed is validated word-wise against the groups, so the interlocks are enforced no matter the method used to write the pins:
+    * - If the frame sets more than one pin of a group, every pin of the group is sent reset, the Main Buffer is not modified. See getInterlockFltsQty().
+    * - If the frame sets a pin of a group while other pin of the group is set in the outputs, the flush latches a break frame -the frame with the pins being set kept reset- waits for the dead time and then latches the frame. See getInterlockBrksQty().
+    * - Otherwise the frame is latched as usual, no extra latches are added.
+    * 
+    * @param pinsPtr Pointer to the list of pins of the group, each in the valid range 0 <= pin <= getMaxSRGXPin().
+    * @param pinsQty Quantity of pins in the list, at least two different pins.
+    * @param deadTmUs Optional parameter. Time between the break frame latching and the frame latching, in microseconds (default 0, the frames are separated by the bit train duration only). The valid range is 0 <= deadTmUs <= 1000000. When several groups need the break frame in the same flush, the longest dead time is used.
+    * 
+    * @retval true The group was added.
+    * @retval false The pins list was not valid, the dead time was out of range, 16 groups were already added, or the Main Buffer mutex could not be taken.
+    * 
+    * @note The pins are the logical ones, before the logical to physical remapping if one is set, see setPinsRemap(const uint8_t*, const bool&).
+    * @attention The dead time is waited by the task flushing, with the Main Buffer mutex taken, so the writing methods invoked meanwhile are blocked. Dead times up to 100 us (driver dead times) are busy-waited, longer ones (contactors, relays) are waited with vTaskDelay(), rounded up to whole ticks, so the flushing task yields the CPU but the flush lasts at least one tick more. The outputs are not validated until the first flush after the group was added.
+    */
+   bool addInterlock(const uint8_t* pinsPtr, const uint8_t &pinsQty, const uint32_t &deadTmUs = 0);
+   /**
+    * @brief Registers an observer of the outputs changes.
+    * 
+    * The callback is invoked by the dispatching task once per latch that modified any pin, with the pins changed and the whole image latched, see SRGXChgDiff. Polling the pins with digitalReadSr(const uint8_t&) is no longer needed, and the flush is not extended by the observers, see beginObservers(const uint8_t&, const BaseType_t&).
+    * 
+    * @param cb Callback to invoke.
+    * @param argp Optional parameter. Argument passed to the callback, i.e. the observing object (default nullptr).
+    * 
+    * @retval true The observer was registered.
+    * @retval false The callback was a nullptr, the callback and argument pair was already registered, or the observers list is full (8 observers).
+    * 
+    * @note The observers might be registered before or after beginObservers(const uint8_t&, const BaseType_t&).
+    * @attention The callbacks are executed by the dispatching task, they must not block for long as the following notifications are coalesced meanwhile. They might use every method of the object but endObservers() and end().
+    */
+   bool addObserver(SRGXObsCb cb, void* argp = nullptr);
+   /**
+    * @brief GPIOXpander object setup and activation 
+    * 
+    * This method sets the controller pins configuration, and optionally sets the initial pin values for the GPIOXpander pins.
+    * 
+    * @param initCntnt Optional parameter. Initial value to be loaded into the Main Buffer, and thus will be the inital state of the Shift Register output pins. The value is provided in the form of a uint8_t*, and the constructor expects the data to be set in the memory area from the pointed address to the pointed address + (srQty - 1) consecutive bytes. If the parameter is not provided, or set to nullptr the inital value to be loaded into the Main Buffer will be 0x00 to all the shift registers positions, making all pins' output 0/LOW/RESET.  
+    * 
+    * If a state store was set (see setStateStore(SRGXStateStore*, const uint32_t&)) and it holds a valid image for the chain, the image is loaded into the Main Buffer instead of initCntnt, restoring the outputs latched before the reset in a single flush, and the state persisting task is started. If an OE pin was set (see setOEPin(const uint8_t&)) the outputs are kept disabled until that first flush is latched.  
+    * 
+    * @return The success of the operation.
+    * @retval true The operation was successful, the GPIOXpander object is ready to be used.
+    * @retval false The operation failed, either because the pins could not be set, or the mutexes could not be created.
+    */
+   bool begin(uint8_t* initCntnt = nullptr);   
+   /**
+    * @brief Adds a 74HCx165 (PISO) input chain, read during the same clock train that flushes the outputs.
+    * 
+    * The input chain shares the SH_CP clock line with the output chain, so every flush both latches the outputs and captures the inputs, without a separate clocking sequence. The inputs are parallel loaded at the start of every flush and the captured values are published to the **Input Image** when the flush ends. See updateInputs() to capture the inputs without modifying the outputs.  
+    * 
+    * If the input chain is longer than the output chain the flush clock train is extended accordingly, the padding bytes are sent before the Main Buffer contents so they are shifted out of the output chain before latching.  
+    * 
+    * @param qh MCU GPIO pin connected to the QH pin -serial data output- of the 74HCx165 nearest to the MCU in the chain.
+    * @param sh_ld MCU GPIO pin connected to the SH/LD pin -shift/parallel load input- of every 74HCx165 in the chain. The CLK pins must be connected to the SH_CP line, and the CLK INH pins to GND.
+    * @param inSrQty Quantity of 74HCx165 set in daisy-chain configuration. Input pin 0 is the A input of the 74HCx165 nearest to the MCU.
+    * 
+    * @return The success of the operation.
+    * @retval true The input chain was set and the inputs were captured for the first time.
+    * @retval false The object was not begun, an input chain was already set, or the inSrQty was 0.
+    * 
+    * @note Must be invoked after begin(uint8_t*).
+    */
+   bool beginInput(const uint8_t &qh, const uint8_t &sh_ld, const uint8_t &inSrQty);
+   /**
+    * @brief Starts the outputs change notifications to the observers registered, see addObserver(SRGXObsCb, void*).
+    * 
+    * From then on every flush compares word-wise the logical frame latched against the preceding one, and queues the changed bits mask and the new values without waiting. A dispatching task delivers the notifications to the observers, so the flush duration does not depend on them. When the queue is full the changes are folded into the following notification, the SRGXChgDiff::coalescedQty field reports the latches folded.
+    * 
+    * @param queueDepth Optional parameter. Quantity of notifications the queue holds, the valid range is queueDepth >= 1 (default 8).
+    * @param obsTskPrrty Optional parameter. Priority of the dispatching task, the valid range is 0 < obsTskPrrty < configMAX_PRIORITIES (default tskIDLE_PRIORITY + 1).
+    * 
+    * @retval true The notifications were started.
+    * @retval false The notifications were already started, the parameters were out of range, or the queue or the dispatching task could not be created.
+    * 
+    * @note The frames compared are the logical ones, before the logical to physical remapping if one is set, see setPinsRemap(const uint8_t*, const bool&).
+    */
+   bool beginObservers(const uint8_t &queueDepth = 8, const BaseType_t &obsTskPrrty = tskIDLE_PRIORITY + 1);
+   /**
+    * @brief Starts driving the OE line through a LEDC channel, for the global dimming of every output.
+    * 
+    * The 74HCx595 OE line is active LOW, the LEDC channel drives it with a PWM signal whose LOW time is the brightness set. The brightness of every output of the chain is modified by setBrightness(const uint32_t&) with no chain transfers at all, replacing the software PWM done by flushing the chain repeatedly.
+    * 
+    * @param ledcChnl LEDC channel to use. Ignored by the Arduino-ESP32 cores 3.x and later, which pick a free channel themselves.
+    * @param freqHz Optional parameter. PWM frequency, in Hz (default 20000, beyond the audible range and the visible flicker).
+    * @param rsltnBits Optional parameter. PWM duty resolution, in bits, 1 <= rsltnBits <= 14 (default 8). The brightness range is 0 to 2^rsltnBits.
+    * 
+    * @retval true The LEDC channel drives the OE line, with the maximum brightness set.
+    * @retval false The object was not begun, no OE pin was set, the dimming was already started, the parameters were not valid, or the LEDC channel could not be set.
+    * 
+    * @note Must be invoked after begin(uint8_t*), and the OE pin set by setOEPin(const uint8_t&).
+    */
+   bool beginOEDimming(const uint8_t &ledcChnl, const uint32_t &freqHz = 20000, const uint8_t &rsltnBits = 8);
+   /**
+    * @brief Preallocates the snapshot slots, a set of independent staging images generalizing the Auxiliary Buffer.
+    * 
+    * Each slot holds a full image of the Main Buffer, staged by copyMainToSnapshot(const uint8_t&), digitalWriteSrToSnapshot(const uint8_t&, const uint8_t&, const uint8_t&) and stampMaskOverSnapshot(const uint8_t&, uint8_t*, uint8_t*), compared against the Main Buffer by cmpSnapshotToMain(const uint8_t&, uint8_t*) and committed by moveSnapshotToMain(const uint8_t&, const bool&) with a single flush.  
+    * 
+    * Unlike the Auxiliary Buffer, the slots are never moved to the Main Buffer implicitly: the writing methods leave them untouched, so an image -i.e. a recipe changeover- can be prepared in the background while the outputs keep being operated, and switched at once when ready.  
+    * 
+    * @param snpshtsQty Quantity of slots, the valid range is 1 <= snpshtsQty <= 16.
+    * 
+    * @retval true The slots were allocated, all of them empty.
+    * @retval false The slots were already allocated, the quantity was out of range, or the mutex could not be created.
+    * 
+    * @note The slots are allocated once, staging and committing never allocate memory.
+    */
+   bool beginSnapshots(const uint8_t &snpshtsQty);
+   /**
+    * @brief Starts the latched frames trace recorder.
+    * 
+    * From then on every flush adds a record to a ring buffer of fixed size, with the exact frame latched and when it was latched, for post-mortem analysis. Each record is 10 + 2 * n bytes long, n being the quantity of shift registers whose value changed from the previous frame:
+    * - uint32_t timestamp, esp_timer microseconds (lower 32 bits).
+    * - uint32_t handle of the task that executed the flush.
+    * - uint8_t identifier of the API method that requested the flush, see SRGXTrcApi.
+    * - uint8_t n.
+    * - n pairs of uint8_t shift register index and uint8_t bits changed (XOR against the previous frame).
+    * 
+    * When the ring buffer is full the oldest records are evicted, so the RAM used is bounded.
+    * 
+    * @param rngSize Size of the ring buffer, in bytes. The valid range is rngSize >= 10 + 2 * getSrQty().
+    * 
+    * @retval true The recorder was started.
+    * @retval false The recorder was already started, the size was out of range, or the Main Buffer mutex could not be taken.
+    * 
+    * @note The frames are recorded as shifted out, i.e. after the logical to physical remapping if one is set, see setPinsRemap(const uint8_t*, const bool&).
+    * @note The recording cost does not depend on the flush duration, it's worst value is available through getTraceWrstCycles().
+    */
+   bool beginTrace(const uint32_t &rngSize);
+   /**
+    * @brief Calibrates the fastest bit time the chain transfers reliably at, through a QH' loop-back.
+    * 
+    * The safe chain clock rate depends on the wiring length and the boards, so the bit time delay defaults to the 10 microseconds safe for any chain. With the QH' output of the last 74HCx595 wired to an input pin, the method shifts test patterns through the chain at decreasing bit time delays, from the default one down to none, reading each pattern back through QH' while the next one is shifted in. The fastest delay every pattern round-tripped at, plus the safety margin, is set as the bit time delay used by the flushes.
     * 
-    * @note There is no mechanism to flush the **Auxiliary** straight to the shift registers.  
+    * @param lpbkPin Input pin wired to the QH' output of the last 74HCx595 of the chain.
+    * @param marginUs Optional parameter. Safety margin added to the fastest delay passed, in microseconds (default 1). The valid range is 0 <= marginUs <= 990.
+    * @param passesQty Optional parameter. Quantity of test patterns that must round-trip at each delay (default 8).
     * 
-    * @attention Every method that invokes a Main Buffer modification -see digitalWriteSr(const uint8_t, const uint8_t), digitalWriteSrAllReset(), digitalWriteSrAllSet(), digitalWriteSrMaskReset(uint8_t*), digitalWriteSrMaskSet(uint8_t*) - and/or flushing -see bool _sendAllSRCntnt() - will force first the Auxiliary to be moved over the Main Buffer, destroy the Auxiliary, perform the intended operation over the Main Buffer and then finally flush the resulting Main Buffer contents to the shift registers. This procedure is enforced to guarantee buffer contents consistency and avoid any loss of modifications done to the Auxiliary. The digitalReadSr(const uint8_t) method will also invoke a moveAuxToMain() before returning the requested pin state. See digitalReadSr(const uint8_t) for more information.
+    * @retval true The calibration was done, the delay set is returned by getBitDelay().
+    * @retval false The object was not begun, it's registered with a SRGXBus, the parameters were not valid -lpbkPin not a valid GPIO or one of the chain lines, see setLoopbackCheck(const uint8_t&, const uint32_t&)-, or the patterns did not round-trip at the default delay (i.e. the loop-back is not wired). The bit time delay was not modified.
+    * 
+    * @note The patterns are not latched, so the outputs are not modified, and the next flush shifts the Main Buffer contents in again. The delay found might be saved and set by setBitDelay(const uint32_t&) at startup, to skip the calibration.
+    * @attention The 74HCx165 input chain, if used, is clocked by the same SH_CP line but it's not verified by the calibration.
     */
-   ShiftRegGPIOXpander(uint8_t ds, uint8_t sh_cp, uint8_t st_cp, uint8_t srQty = 1);
+   bool calibrateBitDelay(const uint8_t &lpbkPin, const uint32_t &marginUs = 1, const uint8_t &passesQty = 8);
    /**
-    * @brief Class destructor
+    * @brief Removes every interlock group, see addInterlock(const uint8_t*, const uint8_t&, const uint32_t&).
     * 
-    * Takes care of resources releasing
+    * @retval true The groups were removed.
+    * @retval false There were no groups added, or the Main Buffer mutex could not be taken.
     */
-   ~ShiftRegGPIOXpander();
+   bool clearInterlocks();
    /**
-    * @brief GPIOXpander object setup and activation 
+    * @brief Removes the logical to physical pins remapping, see setPinsRemap(const uint8_t*, const bool&).
     * 
-    * This method sets the controller pins configuration, and optionally sets the initial pin values for the GPIOXpander pins.
+    * The Main Buffer is sent as is from then on, and the outputs are flushed with the new wiring immediately if the object is begun.
     * 
-    * @param initCntnt Optional parameter. Initial value to be loaded into the Main Buffer, and thus will be the inital state of the Shift Register output pins. The value is provided in the form of a uint8_t*, and the constructor expects the data to be set in the memory area from the pointed address to the pointed address + (srQty - 1) consecutive bytes. If the parameter is not provided, or set to nullptr the inital value to be loaded into the Main Buffer will be 0x00 to all the shift registers positions, making all pins' output 0/LOW/RESET.  
+    * @retval true The remapping was removed.
+    * @retval false There was no remapping set, or the Main Buffer mutex could not be taken.
+    */
+   bool clearPinsRemap();
+   /**
+    * @brief Compares a staged snapshot slot against the Main Buffer.
     * 
-    * @return The success of the operation.
-    * @retval true The operation was successful, the GPIOXpander object is ready to be used.
-    * @retval false The operation failed, either because the pins could not be set, or the mutexes could not be created.
+    * @param slot Index of the snapshot slot.
+    * @param diffMskPtr Optional parameter. Pointer to a getSrQty() bytes long array, set to the bits that differ between the slot and the Main Buffer. nullptr (default) if not needed.
+    * 
+    * @return The quantity of pins whose value differ between the slot and the Main Buffer, 0 if the slot would not modify any output, or -1 if the slot index was not valid or the slot was empty.
     */
-   bool begin(uint8_t* initCntnt = nullptr);   
+   int16_t cmpSnapshotToMain(const uint8_t &slot, uint8_t* diffMskPtr = nullptr);
    /**
     * @brief Copies the Buffer content to the Auxiliary Buffer  
     * 
@@ -176,6 +1113,17 @@ public:
     * @retval false The Auxiliary was existent and the parameter allowing overwriting was false, generating a failure in the operation.  
     */
    bool copyMainToAux(const bool &overWriteIfExists = true);
+   /**
+    * @brief Stages a snapshot slot with the current Main Buffer contents, overwriting the slot if it was staged.
+    * 
+    * @param slot Index of the snapshot slot.
+    * 
+    * @retval true The Main Buffer contents were copied to the slot.
+    * @retval false The slot index was not valid, or the mutexes could not be taken.
+    * 
+    * @note The Main Buffer is copied as the reading methods see it: if an Auxiliary Buffer exists it's moved over the Main Buffer and flushed first. The same applies to the empty slots staged by digitalWriteSrToSnapshot(const uint8_t&, const uint8_t&, const uint8_t&) and stampMaskOverSnapshot(const uint8_t&, uint8_t*, uint8_t*).
+    */
+   bool copyMainToSnapshot(const uint8_t &slot);
    /**
     * @brief Instantiate a SRGXVPort object
     * 
@@ -188,6 +1136,28 @@ public:
     * @attention Note that as described, the minimum amount of pins that can be set in a virtual port is 1, and the maximum amount of pins that can be set in a virtual port is equal to the number of shift registers multiplied by 8 minus the strtPin value, although using the maximum amount of pins available make no sense as the virtual port will be the same as the whole GPIOXpander object.  
     */
    SRGXVPort createSRGXVPort(const uint8_t &strtPin, const uint8_t &pinsQty);
+   /**
+    * @brief Instantiate a scatter/gather SRGXVPort object
+    * 
+    * The method will create a SRGXVPort object whose pins are not a contiguous segment of the ShiftRegGPIOXpander pins, but an arbitrary list of them. Pin n of the virtual port will be the ShiftRegGPIOXpander pin listed in the position n of the list. The scatter (writing) and gather (reading) permutation is precompiled at creation into per-register nibble lookup tables, so writePort(uint16_t) and readPort() are resolved by a few table lookups per shift register involved, modifying the Main Buffer under a single mutex taking and a single flush.  
+    * 
+    * @param pinsLstPtr Pointer to the list of ShiftRegGPIOXpander pins composing the virtual port. Each pin must be in the valid range 0 <= pin <= getMaxSRGXPin(), and no pin might be listed more than once. The list is copied, it's not needed after the invocation.  
+    * @param pinsQty Number of pins in the list. The valid range is 1 <= pinsQty <= 16.
+    * @return SRGXVPort The SRGXVPort object created, or an empty SRGXVPort object if the parameters provided were not valid.
+    * 
+    * @note The lookup tables take 130 bytes of heap for each shift register involved in the virtual port.
+    */
+   SRGXVPort createSRGXSctrVPort(const uint8_t* pinsLstPtr, const uint8_t &pinsQty);
+   /**
+    * @brief Instantiate a SRGXInVPort object
+    * 
+    * The method will create a SRGXInVPort object, an input virtual port that will allow the user to read a contiguous set of input pins as a single value, with it's pins numbered from 0 to pinsQty - 1.
+    * 
+    * @param strtPin Input pin number from which the virtual port will start. The valid range is 0 <= strtPin <= getMaxSRGXInPin().
+    * @param pinsQty Number of pins that will compose the virtual port. The valid range is 1 <= pinsQty <= 16, and (strtPin + pinsQty - 1) <= getMaxSRGXInPin().
+    * @return SRGXInVPort The SRGXInVPort object created, or an empty SRGXInVPort object if the parameters provided were not valid or no input chain was set.
+    */
+   SRGXInVPort createSRGXInVPort(const uint8_t &strtPin, const uint8_t &pinsQty);
    /**
     * @brief Returns a 16-bits value containing a zero-based segment of the Main Buffer.
     * 
@@ -235,6 +1205,31 @@ public:
     * @warning If a moveAuxToMain(true) had to be executed, the Auxiliary will be destroyed. This will have no major consequences as every new need of the Auxiliary will automatically create a new instance of that buffer, but keep this concept in mind.  
     */
    uint8_t digitalReadSr(const uint8_t &srPin);   
+   /**
+    * @brief Returns the state of the requested input pin.
+    * 
+    * The value is retrieved from the Input Image, so it's the value captured by the last flush. The reading takes no mutex and never blocks.
+    * 
+    * @param inPin Input pin whose captured value is required. The valid range is 0 <= inPin <= getMaxSRGXInPin().
+    * 
+    * @retval LOW The pin state captured was LOW
+    * @retval HIGH The pin state captured was HIGH
+    * @retval -1 ERROR, no input chain was set or the pin number was beyond the implemented input pins.
+    */
+   int digitalReadIn(const uint8_t &inPin);
+   /**
+    * @brief Returns a 16-bits value containing a zero-based segment of the Input Image.
+    * 
+    * See digitalReadSgmntSr(const uint8_t&, const uint8_t&, uint16_t&) for the segment format. All the segment bits are taken from the same capture.
+    * 
+    * @param strtPin The first input pin of the segment. The valid range is 0 <= strtPin <= getMaxSRGXInPin().
+    * @param pinsQty The number of pins of the segment. The valid range is 1 <= pinsQty <= 16, and (strtPin + pinsQty - 1) <= getMaxSRGXInPin().
+    * @param inSgmnt A reference to a uint16_t variable where the segment will be stored.
+    * 
+    * @retval true The segment was successfully retrieved and stored in the inSgmnt variable.
+    * @retval false No input chain was set or the parameters provided were not valid.
+    */
+   bool digitalReadSgmntIn(const uint8_t &strtPin, const uint8_t &pinsQty, uint16_t &inSgmnt);
    /**
      * @brief Toggles the state of a specific pin.
      * 
@@ -248,7 +1243,7 @@ public:
      * 
      * @return A boolean value indicating the success of the operation.
      * @retval true The operation was successful, the pin was toggled in the Main Buffer and the change was flushed to the GPIO pin.
-     * @retval false The operation failed, either because the pin number was beyond the implemented limit or because the mutexes could not be taken.
+     * @retval false The operation failed, either because the pin number was beyond the implemented limit, the pin is reserved by other object (see isPinReserved()) or because the mutexes could not be taken.
      */
    bool digitalToggleSr(const uint8_t &srPin);
    /**
@@ -261,6 +1256,8 @@ public:
     * @return A boolean value indicating the success of the operation.
     * @retval true The operation was successful, all the pins were toggled in the Main Buffer and the change was flushed to the GPIO pins.
     * @retval false The operation failed, because the mutexes could not be taken.
+    * 
+    * @note The pins reserved by other objects (see isPinReserved()) keep their value.
     */
    bool digitalToggleSrAll();
    /**
@@ -270,7 +1267,7 @@ public:
     * 
     * @param toggleMask Pointer to the array containing the mask to modify the Main.
     * 
-    * @note The method provides a mechanism for toggling various Main buffer bit positions in a single operation.
+    * @note The method provides a mechanism for toggling various Main buffer bit positions in a single operation. The pins reserved by other objects (see isPinReserved()) keep their value.
     * 
     * @attention Any modifications made in the Auxiliary will be moved to the Main and it will be deleted before applying the mask.
     * 
@@ -313,9 +1310,21 @@ public:
    * 
    * @return A boolean value indicating the success of the operation.
    * @retval true The operation was successful, the pin was set in the Main Buffer and the change was flushed to the GPIO pin.
-   * @retval false The operation failed, either because the pin number was beyond the implemented limit or because the mutexes could not be taken.
+   * @retval false The operation failed, either because the pin number was beyond the implemented limit, the pin is reserved by other object (see isPinReserved()) or because the mutexes could not be taken.
    */
    bool digitalWriteSr(const uint8_t &srPin, const uint8_t &value);
+   /**
+    * @brief Set a pin described by a compile time pin descriptor to either HIGH (0x01) or LOW (0x00).
+    * 
+    * The descriptor version of digitalWriteSr(const uint8_t&, const uint8_t&): the pin range was validated at compile time, and the register index and bit mask were precomputed, so no calculations are done, see SRGXPin(). The register index is compared against the object's chain length, as the descriptor might have been built for a longer chain.
+    * 
+    * @param pinDsc Pin descriptor.
+    * @param value Value to set the indicated Pin.  
+    * 
+    * @retval true The pin was set in the Main Buffer and the change was flushed to the GPIO pin.
+    * @retval false The pin is beyond the object's chain length, the pin is reserved by other object (see isPinReserved()), or the mutexes could not be taken.
+    */
+   bool digitalWriteSr(const SRGXPinDsc &pinDsc, const uint8_t &value);
    /**
    * @brief Sets all the pins to LOW (0x00/Reset).
    * 
@@ -324,7 +1333,10 @@ public:
    * 
    * @return A boolean value indicating the success of the operation.
    * @retval true The operation was successful, all the pins were set to LOW in the Main Buffer and the change was flushed to the GPIO pins.
-   * @retval false The operation failed, because the mutexes could not be taken*/
+   * @retval false The operation failed, because the mutexes could not be taken
+   * 
+   * @note The pins reserved by other objects (see isPinReserved()) keep their value.
+   */
    bool digitalWriteSrAllReset();
    /**
    * @brief Sets all the pins to HIGH (0x01).
@@ -335,6 +1347,8 @@ public:
    * @return A boolean value indicating the success of the operation.
    * @retval true The operation was successful, all the pins were set to HIGH in the Main Buffer and the change was flushed to the GPIO pins.
    * @retval false The operation failed, because the mutexes could not be taken.
+   * 
+   * @note The pins reserved by other objects (see isPinReserved()) keep their value.
    */
    bool digitalWriteSrAllSet();
   /**
@@ -344,7 +1358,7 @@ public:
    * 
    * @param resetMask Pointer to the array containing the mask to modify the Main.
    * 
-   * @note The method provides a mechanism for clearing (reseting/lowering) various Main buffer bit positions in a single operation.
+   * @note The method provides a mechanism for clearing (reseting/lowering) various Main buffer bit positions in a single operation. The pins reserved by other objects (see isPinReserved()) keep their value.
    * 
    * @attention Any modifications made in the Auxiliary will be moved to the Main and will be deleted before applying the mask.  
    * 
@@ -362,7 +1376,7 @@ public:
    * 
    * @param setMask Pointer to the array containing the mask to modify the Main.
    * 
-   * @note The method provides a mechanism for seting (rising) various Main buffer bit positions in a single operation.
+   * @note The method provides a mechanism for seting (rising) various Main buffer bit positions in a single operation. The pins reserved by other objects (see isPinReserved()) keep their value.
    * 
    * @attention Any modifications made in the Auxiliary will be moved to the Main and will be deleted before applying the mask.  
    * 
@@ -389,102 +1403,502 @@ public:
    */
    bool digitalWriteSrToAux(const uint8_t srPin, const uint8_t value);
    /**
-    * @brief Deletes the Auxiliary Buffer.  
+    * @brief Sets a specific pin to either HIGH (0x01) or LOW (0x00) in a snapshot slot.
+    * 
+    * If the slot was empty it is staged first with the Main Buffer contents.
+    * 
+    * @param slot Index of the snapshot slot.
+    * @param srPin A positive value indicating which pin to set. The valid range is 0 <= srPin <= getMaxSRGXPin()
+    * @param value Value to set for the indicated pin.
+    * 
+    * @retval true The pin was set in the slot.
+    * @retval false The slot index or the pin number were not valid, or the mutexes could not be taken.
+    * 
+    * @note Neither the Main Buffer nor the outputs are modified until the slot is committed, see moveSnapshotToMain(const uint8_t&, const bool&).
+    */
+   bool digitalWriteSrToSnapshot(const uint8_t &slot, const uint8_t &srPin, const uint8_t &value);
+   /**
+    * @brief Deletes the Auxiliary Buffer.  
+    * 
+    * Discards the contents of the Auxiliary Buffer, frees the memory allocated to it and nullifies the corresponding memory pointer. If the Auxiliary Buffer was not created, the method will do nothing. If the Auxiliary is not transferred to the Main Buffer before invoking this method, the modified contents of the Auxiliary will be lost.  
+    * 
+    * @return A boolean value indicating the success of the operation.
+    * @retval true The Auxiliary Buffer was successfully discarded, and the memory allocated to it was freed.
+    * @retval false The mutexes could not be taken.
+    */
+   bool discardAux();
+   /**
+    * @brief Empties a snapshot slot, discarding it's staged contents.
+    * 
+    * @param slot Index of the snapshot slot.
+    * 
+    * @retval true The slot was emptied, it's memory is kept for the next staging.
+    * @retval false The slot index was not valid, the slot was already empty, or the mutex could not be taken.
+    */
+   bool discardSnapshot(const uint8_t &slot);
+   /**
+    * @brief Copies the trace recorder contents as a binary dump.
+    * 
+    * The recorder is not stopped nor blocked while copying: the copy is retried if a flush added a record meanwhile. The dump, little-endian, holds:
+    * - char[4] "SRGT" signature.
+    * - uint8_t format version, 2 (version 1 records held the uint32_t flush requesting code address instead of the uint8_t SRGXTrcApi identifier, and were 13 + 2 * n bytes long).
+    * - uint8_t quantity of shift registers, srQty.
+    * - uint16_t reserved, 0.
+    * - uint32_t length of the records section, in bytes.
+    * - uint32_t quantity of records evicted since the recorder started.
+    * - srQty bytes base frame, the frame preceding the oldest record (all 0x00 if no record was evicted yet).
+    * - The records, oldest first, as described in beginTrace(const uint32_t&).
+    * 
+    * The extras/SRGXTraceDecoder.py script decodes the dump in the host.
+    * 
+    * @param dumpPtr Pointer to the memory area to copy the dump to.
+    * @param dumpSize Size of the memory area, at least getTraceDumpSize() bytes.
+    * 
+    * @return The length of the dump in bytes, or 0 if the recorder was not started, the parameters were not valid, or the records were being added continuously and no consistent copy could be made.
+    * 
+    * @warning Must not be invoked concurrently with endTrace().
+    */
+   uint32_t dumpTrace(uint8_t* dumpPtr, const uint32_t &dumpSize);
+   /**
+    * @brief Method provided for ending any relevant activation procedures made by the begin(uint8_t*) method.  
+    * 
+    * The method will be invoked as part of the class destructor. If the object is registered with a SRGXBus object, it's removed from the bus. If a state store was set, the image latched is saved -if pending- and the state persisting task is ended. The outputs change notifications and the OE line dimming are stopped.  
+    */
+   void end();
+   /**
+    * @brief Stops the outputs change notifications and frees their resources.
+    * 
+    * The notifications already queued are delivered before the dispatching task ends. The observers stay registered for a later beginObservers(const uint8_t&, const BaseType_t&).
+    * 
+    * @retval true The notifications were stopped.
+    * @retval false The notifications were not started, or the Main Buffer mutex could not be taken.
+    */
+   bool endObservers();
+   /**
+    * @brief Stops driving the OE line through the LEDC channel, the outputs are enabled at full brightness.
+    * 
+    * @retval true The dimming was stopped.
+    * @retval false The dimming was not started, or the Main Buffer mutex could not be taken.
+    */
+   bool endOEDimming();
+   /**
+    * @brief Stops the latched frames trace recorder and frees it's memory.
+    * 
+    * @retval true The recorder was stopped.
+    * @retval false The recorder was not started, or the Main Buffer mutex could not be taken.
+    */
+   bool endTrace();
+   /**
+    * @brief Toggles the state of a specific pin in the Main Buffer.  
+    * 
+    * @param srPin Pin whose state is to be toggled. The valid range is 0 <= srPin <= getMaxSRGXPin()  
+    * @retval true The pin was in the valid range and was toggled in the Main Buffer.
+    * @retval false The pin was not in the valid range or is reserved by other object (see isPinReserved()), and no action was taken.
+    * 
+    * @note flipBit(n) is a synonym for digitalToggleSr(n), and is provided for shortening and using more meaningful name in the code.
+    */
+   bool flipBit(const uint8_t &srPin);
+   /**
+    * @brief Retrieves the pointer to the Main Buffer.  
+    * 
+    * @return Pointer to the array of uint8_t holding the buffered shift registers values.  
+    *
+    * @note The returned array's length is equal to the number of shift registers set in daisy-chain, see uint8_t getSrQty() for information.  
+    */
+   uint8_t* getMainBuffPtr();
+   /**
+    * @brief Returns the bit time delay used by the flushes.
+    * 
+    * @return The delay before each SH_CP rising edge in microseconds, set by calibrateBitDelay(const uint8_t&, const uint32_t&, const uint8_t&) or setBitDelay(const uint32_t&), 10 by default.
+    */
+   uint32_t getBitDelay();
+   /**
+    * @brief Returns the global brightness set.
+    * 
+    * @return The brightness set by setBrightness(const uint32_t&), in the 0 to 2^rsltnBits range set by beginOEDimming(const uint8_t&, const uint32_t&, const uint8_t&), or 0 if the dimming was not started.
+    */
+   uint32_t getBrightness();
+   /**
+    * @brief Returns the worst critical section duration observed while flushing.
+    * 
+    * @return The longest time the flushing kept the preemption disabled, in microseconds, since the flushing policy was set or the instrumentation was reset. 0 for the flshPreemptible policy.
+    */
+   uint32_t getFlushCrtclWrstTm();
+   /**
+    * @brief Returns the flushing policy set.
+    * 
+    * @return The SRGXFlushPolicy value, see setFlushPolicy(const SRGXFlushPolicy&, const uint32_t&).
+    */
+   SRGXFlushPolicy getFlushPolicy();
+   /**
+    * @brief Returns the worst flush duration observed.
+    * 
+    * @return The longest flush observed, from the start of the bit train to the latching, in microseconds, since the flushing policy was set or the instrumentation was reset. Includes the time the flushing was preempted.
+    */
+   uint32_t getFlushWrstTm();
+   /**
+    * @brief Returns the quantity of break-before-make sequences emitted by the flushes to enforce the interlock groups.
+    */
+   uint32_t getInterlockBrksQty();
+   /**
+    * @brief Returns the quantity of frames flushed with the pins of an interlock group reset, as they requested more than one pin of the group set.
+    */
+   uint32_t getInterlockFltsQty();
+   /**
+    * @brief Returns the quantity of flushes whose loop-back integrity check failed, see setLoopbackCheck(const uint8_t&, const uint32_t&).
+    */
+   uint32_t getLoopbackErrsQty();
+   /**
+     * @brief Return the greatest valid pin number.  
+     * 
+     * The greatest valid pin number is directly related to the quantity of shift registers connected, and is equal to the number of shift registers multiplied by 8 minus 1, (getSrQty() * 8) - 1.  
+     * 
+     * @return uint8_t maxPin number value.  
+     * 
+     * @note The value will be used as a limit for the pin numbers to be used in the digitalWriteSr(const uint8_t, const uint8_t) and digitalReadSr(const uint8_t) methods.  
+     */
+   uint8_t getMaxSRGXPin();
+   /**
+    * @brief Return the greatest valid input pin number.  
+    * 
+    * @return uint8_t maxPin number value, (getInSrQty() * 8) - 1, or 0 if no input chain was set, see getInSrQty().
+    */
+   uint8_t getMaxSRGXInPin();
+   /**
+    * @brief Return the quantity of 74HCx165 composing the input chain.  
+    * 
+    * @return uint8_t The number of input shift registers set by beginInput(const uint8_t&, const uint8_t&, const uint8_t&), or 0 if no input chain was set.
+    */
+   uint8_t getInSrQty();
+   /**
+    * @brief Returns the quantity of snapshot slots allocated by beginSnapshots(const uint8_t&), 0 if none was.
+    */
+   uint8_t getSnapshotsQty();
+   /**
+    * @brief Returns the buffer size needed for a trace recorder dump, see dumpTrace(uint8_t*, const uint32_t&).
+    * 
+    * @return 16 + getSrQty() + the ring buffer size, or 0 if the recorder was not started.
+    */
+   uint32_t getTraceDumpSize();
+   /**
+    * @brief Returns the worst observed trace recording time added to a flush, in CPU cycles.
+    * 
+    * @return The worst recording time since the recorder was started, or 0 if no frame was recorded.
+    */
+   uint32_t getTraceWrstCycles();
+   /**
+     * @brief Return the quantity of shift registers composing the GPIOXtender object.  
+     * 
+     * The value is passed as a parameter in the class constructor.  
+     * 
+     * @return uint8_t The number of shift registers composing the physical port extender modeled by the class.  
+     */
+   uint8_t getSrQty();
+   /**
+    * @brief Checks if the provided SRGXVPort object is valid.
+    * 
+    * The method is useful to verify after a createVXVPort(uint8_t&, uint8_t&) invocation that the SRGXVPort object created is valid, i.e. that it was created with a valid ShiftRegGPIOXpander object pointer and that the parameters provided to create the SRGXVPort object were valid.
+    * 
+    * @param VPort SRGXVPort object to be checked for validity.
+    * @return true The created SRGXVPort object is valid and usable.  
+    * @return false The created SRGXVPort object is not valid, and should not be used.
+    * 
+    * @note If the method returns false, the SRGXVPort object should not be used. Consider destructing it and creating a new one with valid parameters.
+    */
+   bool isValid(SRGXVPort &VPort);
+   /**
+    * @brief Checks if the provided pin descriptor is valid for the object.
+    * 
+    * The descriptor based methods only reject the pins beyond the object's chain length, the method is provided to verify once -i.e. at setup- that the chain length the descriptors were built for does not exceed the object's.
+    * 
+    * @param pinDsc Pin descriptor to be checked.
+    * @retval true The descriptor's chain length is not greater than getSrQty(), and it's pin is within it.
+    * @retval false The descriptor was built for a longer chain, and must not be used with this object.
+    */
+   bool isValid(const SRGXPinDsc &pinDsc);
+   /**
+    * @brief Checks if a pin is reserved for the exclusive use of a SRGXVPort object.
+    * 
+    * The reserved pins -by an exclusive SRGXVPort, a SRGXMuxScanner or a SRGXStepperEng- are written only by their owner: the single pin writing methods reject them, and the bulk writing methods leave them unmodified.
+    * 
+    * @param srPin Pin to check. The valid range is 0 <= srPin <= getMaxSRGXPin().
+    * 
+    * @retval true The pin is reserved by an exclusive SRGXVPort, see SRGXVPort::reservePins().
+    * @retval false The pin is not reserved, or the pin number was beyond the implemented limit.
+    */
+   bool isPinReserved(const uint8_t &srPin);
+   /**
+    * @brief Returns the staging condition of a snapshot slot.
+    * 
+    * @param slot Index of the snapshot slot.
+    * 
+    * @retval true The slot holds a staged image, ready to be compared or committed.
+    * @retval false The slot is empty, or the slot index was not valid.
+    */
+   bool isSnapshotStaged(const uint8_t &slot);
+   /**
+    * @brief Returns the origin of the Main Buffer initial contents.
+    * 
+    * @retval true The initial contents were restored from the state store by begin(uint8_t*).
+    * @retval false No state store was set, or it held no valid image for the chain, and the initial contents were taken from the begin(uint8_t*) parameter.
+    */
+   bool isStateRestored();
+   /**
+    * @brief Moves the data in the Auxiliary to the Main
+    * 
+    * Moving the contents from the Auxiliary to the Main implies several steps:  
+    * - Check the existence of the Auxiliary
+    * - Copy the contents from the Auxiliary to the Main (see stampOverMain(uint8_t*))
+    * - Delete the Auxiliary (see discardAux())
+    * 
+    * @note Pins reserved for the exclusive use of a SRGXVPort (see SRGXVPort::reservePins()) are not overwritten by the Auxiliary contents, as those pins are only modified by their owner port.  
+    * 
+    * @return The success of moving the data from the Auxiliary to the Main.  
+    * @retval true There was an Auxiliary and it's value could be moved.  
+    * @retval false There was no Auxiliary present, no data have been moved.  
+    */
+   bool moveAuxToMain();
+   /**
+    * @brief Commits a staged snapshot slot to the Main Buffer, and flushes it with a single latch.
+    * 
+    * Every output switches to the slot image in the same latching pulse.
+    * 
+    * @param slot Index of the snapshot slot.
+    * @param keepSnapshot Optional parameter. If true the slot keeps it's staged image after the commit, to be committed again later, otherwise (default) the slot is emptied.
+    * 
+    * @retval true The slot was committed and flushed.
+    * @retval false The slot index was not valid, the slot was empty, or the mutexes could not be taken.
+    * 
+    * @note Pins reserved for the exclusive use of a SRGXVPort (see SRGXVPort::reservePins()) are not overwritten by the slot contents, as those pins are only modified by their owner port.  
+    * 
+    * @attention The commit supersedes the Auxiliary Buffer: if it exists it's discarded, as stampOverMain(uint8_t*) does, so no later method moves it's older contents over the committed image.
+    */
+   bool moveSnapshotToMain(const uint8_t &slot, const bool &keepSnapshot = false);
+   /**
+    * @brief Copies the whole Input Image.
+    * 
+    * All the bytes copied are taken from the same capture. The reading takes no mutex and never blocks.
+    * 
+    * @param inImgPtr Pointer to the memory area where the Input Image will be copied, at least getInSrQty() bytes long.
+    * 
+    * @retval true The Input Image was copied.
+    * @retval false No input chain was set, or the pointer provided was a nullptr.
+    */
+   bool readInImg(uint8_t* inImgPtr);
+   /**
+    * @brief Unregisters an observer of the outputs changes, see addObserver(SRGXObsCb, void*).
+    * 
+    * @param cb Callback registered.
+    * @param argp Optional parameter. Argument registered with the callback (default nullptr).
+    * 
+    * @retval true The observer was unregistered.
+    * @retval false The callback and argument pair was not registered.
+    * 
+    * @note If a notification is being delivered the callback might still be invoked for it, but not for the following ones.
+    */
+   bool removeObserver(SRGXObsCb cb, void* argp = nullptr);
+   /**
+    * @brief Sets a specific pin to LOW (0x00/Reset) in the Main Buffer.
+    * 
+    * @param srPin Pin whose state is to be reset. The valid range is 0 <= srPin <= getMaxSRGXPin()
+    * @retval true The pin was in the valid range and was reset to LOW (0x00/Reset) in the Main Buffer.
+    * @retval false The pin was not in the valid range or is reserved by other object (see isPinReserved()), and no action was taken.
+    * 
+    * @note resetBit(n) is a synonym for digitalWriteSr(n, LOW), and is provided for shortening and using more meaningful name in the code.
+    */
+   bool resetBit(const uint8_t &srPin);
+   /**
+    * @brief Resets a pin described by a compile time pin descriptor to LOW (0x00/Reset), see digitalWriteSr(const SRGXPinDsc&, const uint8_t&).
+    * 
+    * @param pinDsc Pin descriptor.
+    * @retval true The pin was reset in the Main Buffer and flushed.
+    * @retval false The pin is beyond the object's chain length or reserved by other object (see isPinReserved()), or the mutexes could not be taken.
+    */
+   bool resetBit(const SRGXPinDsc &pinDsc);
+   /**
+    * @brief Resets the flushing instrumentation worst times observed.
+    * 
+    * @retval true The instrumentation was reset.
+    * @retval false The Main Buffer mutex could not be taken.
+    */
+   bool resetFlushStats();
+   /**
+    * @brief Resets a list of pins to LOW, in a single Main Buffer mutex taking and a single flush.
+    * 
+    * @param pinsPtr Pointer to the list of pins. The valid range for each pin is 0 <= pin <= getMaxSRGXPin().
+    * @param pinsQty Number of pins in the list.
+    * 
+    * @retval true The pins were reset and flushed.
+    * @retval false The list was a nullptr or empty, or a pin was out of range or reserved by other object (see isPinReserved()), no pin was modified.
+    * 
+    * @note See writeMany(const SRGXPinValue*, const size_t&) for the list processing details.
+    */
+   bool resetMany(const uint8_t* pinsPtr, const size_t &pinsQty);
+   /**
+    * @brief Sets the priority of the asynchronous flushing task.
+    * 
+    * @param asyncTskPrrty The priority of the task created to flush the asynchronous writes. The default value is (configMAX_PRIORITIES - 2).
+    * 
+    * @retval true The priority was set, it will take effect when the task is created by the first asynchronous write.
+    * @retval false The priority was out of the valid range.
+    */
+   bool setAsyncTskPrrty(const BaseType_t &asyncTskPrrty);
+   /**
+    * @brief Sets a specific pin to HIGH (0x01/Set) in the Main Buffer.
+    * 
+    * @param srPin Pin whose state is to be set. The valid range is 0 <= srPin <= getMaxSRGXPin()
+    * @retval true The pin was in the valid range and was set to HIGH (0x01/Set) in the Main Buffer.
+    * @retval false The pin was not in the valid range or is reserved by other object (see isPinReserved()), and no action was taken.
+    * 
+    * @note setBit(n) is a synonym for digitalWriteSr(n, HIGH), and is provided for shortening and using more meaningful name in the code.
+    */
+   bool setBit(const uint8_t &srPin);
+   /**
+    * @brief Sets a pin described by a compile time pin descriptor to HIGH (0x01/Set), see digitalWriteSr(const SRGXPinDsc&, const uint8_t&).
     * 
-    * Discards the contents of the Auxiliary Buffer, frees the memory allocated to it and nullifies the corresponding memory pointer. If the Auxiliary Buffer was not created, the method will do nothing. If the Auxiliary is not transferred to the Main Buffer before invoking this method, the modified contents of the Auxiliary will be lost.  
+    * @param pinDsc Pin descriptor.
+    * @retval true The pin was set in the Main Buffer and flushed.
+    * @retval false The pin is beyond the object's chain length or reserved by other object (see isPinReserved()), or the mutexes could not be taken.
+    */
+   bool setBit(const SRGXPinDsc &pinDsc);
+   /**
+    * @brief Sets the bit time delay used by the flushes.
     * 
-    * @return A boolean value indicating the success of the operation.
-    * @retval true The Auxiliary Buffer was successfully discarded, and the memory allocated to it was freed.
-    * @retval false The mutexes could not be taken.
+    * @param bitDlyUs Delay before each SH_CP rising edge, in microseconds. The valid range is 0 <= bitDlyUs <= 1000.
+    * 
+    * @retval true The delay was set.
+    * @retval false The delay was out of range, or the Main Buffer mutex could not be taken.
+    * 
+    * @note Intended to restore a delay found by calibrateBitDelay(const uint8_t&, const uint32_t&, const uint8_t&) in a former run.
     */
-   bool discardAux();
+   bool setBitDelay(const uint32_t &bitDlyUs);
    /**
-    * @brief Method provided for ending any relevant activation procedures made by the begin(uint8_t*) method.  
+    * @brief Sets the global brightness of the outputs, through the OE line PWM duty.
+    * 
+    * @param brightness Brightness, from 0 (outputs disabled) to 2^rsltnBits (outputs permanently enabled), rsltnBits being the resolution set by beginOEDimming(const uint8_t&, const uint32_t&, const uint8_t&).
     * 
-    * The method will be invoked as part of the class destructor.  
+    * @retval true The brightness was set, it takes effect on the next PWM period.
+    * @retval false The dimming was not started, the brightness was out of range, or the Main Buffer mutex could not be taken.
+    * 
+    * @note No chain transfer is done, the Main Buffer and the shift registers contents are not modified.
     */
-   void end();
+   bool setBrightness(const uint32_t &brightness);
    /**
-    * @brief Toggles the state of a specific pin in the Main Buffer.  
+    * @brief Sets the flushing policy.
     * 
-    * @param srPin Pin whose state is to be toggled. The valid range is 0 <= srPin <= getMaxSRGXPin()  
-    * @retval true The pin was in the valid range and was toggled in the Main Buffer.
-    * @retval false The pin was not in the valid range, and no action was taken.
+    * The flushing bit train might be preempted by higher priority tasks and interrupts, stretching the flush duration and leaving the SH_CP clock stalled in the middle of the chain. The policy sets the tradeoff between the flush duration determinism and the latency added to the rest of the system:
+    * - flshPreemptible: no critical sections, the flush duration is not bounded.
+    * - flshPerRegister: each shift register byte is sent in a critical section, the latency added is limited to one byte time.
+    * - flshWholeFrame: the whole bit train is sent in a single critical section, split in chunks of as many registers as fit in maxCrtclUs -the register time is measured while flushing- so the latency added is always bounded.
     * 
-    * @note flipBit(n) is a synonym for digitalToggleSr(n), and is provided for shortening and using more meaningful name in the code.
+    * @param flshPolicy The flushing policy, see SRGXFlushPolicy.
+    * @param maxCrtclUs Optional parameter. Maximum critical section duration in microseconds for the flshWholeFrame policy, 0 (default) for the 200 us default bound. A bound shorter than a register time sends one register per critical section. Ignored by the rest of the policies.
+    * 
+    * @retval true The policy was set, the flushing instrumentation is reset.
+    * @retval false The policy value was not valid, or the Main Buffer mutex could not be taken.
+    * 
+    * @note The critical sections disable the interrupts in the core executing the flush, so the policies other than flshPreemptible delay the interrupts serving as well.
     */
-   bool flipBit(const uint8_t &srPin);
+   bool setFlushPolicy(const SRGXFlushPolicy &flshPolicy, const uint32_t &maxCrtclUs = 0);
    /**
-    * @brief Retrieves the pointer to the Main Buffer.  
+    * @brief Sets the periodic chain integrity check through a QH' loop-back.
     * 
-    * @return Pointer to the array of uint8_t holding the buffered shift registers values.  
-    *
-    * @note The returned array's length is equal to the number of shift registers set in daisy-chain, see uint8_t getSrQty() for information.  
+    * Each bit train shifts the frame latched by the preceding one out of the last 74HCx595 QH' output, so with it wired to an input pin the chain integrity is verified with no extra clocking: every chkPrdFlshs flushes the bits read through QH' are compared against the frame shifted in before. A mismatch is counted by getLoopbackErrsQty(), and if the bit time delay was set below the default one it's restored to the default, as the calibrated rate is not reliable anymore.
+    * 
+    * @param lpbkPin Input pin wired to the QH' output of the last 74HCx595 of the chain.
+    * @param chkPrdFlshs Flushes between checks, 1 to check every flush, 0 to stop checking.
+    * 
+    * @retval true The check was set.
+    * @retval false The pin is not a valid GPIO, it's one of the chain lines (DS, SH_CP, ST_CP, OE, or the 74HCx165 QH and SH/LD lines), or the Main Buffer mutex could not be taken. The pin mode was not modified.
+    * 
+    * @note The check is skipped while the object is registered with a SRGXBus, as the chains sharing the bus shift their frames through every chain.
     */
-   uint8_t* getMainBuffPtr();
+   bool setLoopbackCheck(const uint8_t &lpbkPin, const uint32_t &chkPrdFlshs = 1);
    /**
-     * @brief Return the greatest valid pin number.  
-     * 
-     * The greatest valid pin number is directly related to the quantity of shift registers connected, and is equal to the number of shift registers multiplied by 8 minus 1, (getSrQty() * 8) - 1.  
-     * 
-     * @return uint8_t maxPin number value.  
-     * 
-     * @note The value will be used as a limit for the pin numbers to be used in the digitalWriteSr(const uint8_t, const uint8_t) and digitalReadSr(const uint8_t) methods.  
-     */
-   uint8_t getMaxSRGXPin();
+    * @brief Sets a list of pins to HIGH, in a single Main Buffer mutex taking and a single flush.
+    * 
+    * @param pinsPtr Pointer to the list of pins. The valid range for each pin is 0 <= pin <= getMaxSRGXPin().
+    * @param pinsQty Number of pins in the list.
+    * 
+    * @retval true The pins were set and flushed.
+    * @retval false The list was a nullptr or empty, or a pin was out of range or reserved by other object (see isPinReserved()), no pin was modified.
+    * 
+    * @note See writeMany(const SRGXPinValue*, const size_t&) for the list processing details.
+    */
+   bool setMany(const uint8_t* pinsPtr, const size_t &pinsQty);
    /**
-     * @brief Return the quantity of shift registers composing the GPIOXtender object.  
-     * 
-     * The value is passed as a parameter in the class constructor.  
-     * 
-     * @return uint8_t The number of shift registers composing the physical port extender modeled by the class.  
-     */
-   uint8_t getSrQty();
+    * @brief Sets the MCU pin driving the OE (output enable, active low) line of the 74HCx595 chain.
+    * 
+    * The 74HCx595 registers power up with random contents, and keep the ones latched before a MCU reset. With the OE line connected to a MCU pin, and pulled up to Vcc by an external resistor so the outputs are disabled while the MCU is in reset, begin(uint8_t*) drives it HIGH first and LOW once the first valid frame is latched, so the outputs never show an intermediate image.
+    * 
+    * @param oe MCU GPIO pin connected to the OE pin of every 74HCx595 in the chain.
+    * 
+    * @retval true The pin was set.
+    * @retval false The object was already begun.
+    * 
+    * @note Must be invoked before begin(uint8_t*).
+    */
+   bool setOEPin(const uint8_t &oe);
    /**
-    * @brief Checks if the provided SRGXVPort object is valid.
+    * @brief Sets the outputs blanking while the chain is shifted.
     * 
-    * The method is useful to verify after a createVXVPort(uint8_t&, uint8_t&) invocation that the SRGXVPort object created is valid, i.e. that it was created with a valid ShiftRegGPIOXpander object pointer and that the parameters provided to create the SRGXVPort object were valid.
+    * With the blanking set every flush disables the outputs through the OE line before shifting the chain, and enables them after latching it, so the intermediate shift states never reach the outputs of chains not latch-safe -i.e. wired with the ST_CP and SH_CP lines tied together, or with 74HCx164 registers-. The outputs are blanked for the flush duration, see getFlushWrstTm().
     * 
-    * @param VPort SRGXVPort object to be checked for validity.
-    * @return true The created SRGXVPort object is valid and usable.  
-    * @return false The created SRGXVPort object is not valid, and should not be used.
+    * @param blankDuringFlush true to blank the outputs while flushing, false to keep them enabled.
     * 
-    * @note If the method returns false, the SRGXVPort object should not be used. Consider destructing it and creating a new one with valid parameters.
+    * @retval true The blanking was set.
+    * @retval false No OE pin was set, or the Main Buffer mutex could not be taken.
+    * 
+    * @note When the OE line is driven by the LEDC channel (see beginOEDimming(const uint8_t&, const uint32_t&, const uint8_t&)) the blanking disconnects the pin from the channel through the GPIO matrix, so it takes effect immediately and the flush is not extended by the PWM period.
     */
-   bool isValid(SRGXVPort &VPort);
+   bool setOEBlanking(const bool &blankDuringFlush);
    /**
-    * @brief Moves the data in the Auxiliary to the Main
+    * @brief Sets a logical to physical pins remapping, applied to the whole Main Buffer every time it is flushed.
     * 
-    * Moving the contents from the Auxiliary to the Main implies several steps:  
-    * - Check the existence of the Auxiliary
-    * - Copy the contents from the Auxiliary to the Main (see stampOverMain(uint8_t*))
-    * - Delete the Auxiliary (see discardAux())
+    * Every method of the object and of it's SRGXVPort objects keeps working with the logical pins numbering, the Main Buffer contents are transformed into the physical image just before being shifted out. The remapping decouples the pins numbering from the board routing: crossed traces, registers mounted in reverse order, or a chain whose Q0..Q7 outputs are wired in reverse.
     * 
-    * @return The success of moving the data from the Auxiliary to the Main.  
-    * @retval true There was an Auxiliary and it's value could be moved.  
-    * @retval false There was no Auxiliary present, no data have been moved.  
+    * The permutation is precomputed into nibble lookup tables when set, so each flush transforms the image in a register-wise pass, with two lookups for each pair of logical and physical registers sharing pins.
+    * 
+    * @param physPinsPtr Pointer to an array of getMaxSRGXPin() + 1 physical pin numbers, physPinsPtr[n] being the physical pin of the logical pin n. Every physical pin must appear once. nullptr for the identity, to be used with bitRvrs.
+    * @param bitRvrs Optional parameter. If true the bits of every physical register are reversed after the remapping, i.e. physical pin n of a register is sent as pin 7 - n, for chains wired from QH to QA. false by default.
+    * 
+    * @retval true The remapping was set, and the outputs were flushed with it if the object is begun. A resulting identity remapping is not installed and sets no flushing overhead.
+    * @retval false The physPinsPtr array was not a permutation of the pins, both parameters were empty, or the Main Buffer mutex could not be taken. The previous remapping -if any- is kept.
+    * 
+    * @note The remapping might be set before begin(uint8_t*), so the first flush is already remapped.
+    * @note The remapping applies to the outputs chain only, the 74HCx165 input chain is not affected.
     */
-   bool moveAuxToMain();
+   bool setPinsRemap(const uint8_t* physPinsPtr, const bool &bitRvrs = false);
    /**
-    * @brief Sets a specific pin to LOW (0x00/Reset) in the Main Buffer.
+    * @brief Sets the store the latched image is persisted to, and restored from by begin(uint8_t*).
     * 
-    * @param srPin Pin whose state is to be reset. The valid range is 0 <= srPin <= getMaxSRGXPin()
-    * @retval true The pin was in the valid range and was reset to LOW (0x00/Reset) in the Main Buffer.
-    * @retval false The pin was not in the valid range, and no action was taken.
+    * Once begun, every flush notifies a dedicated state persisting task, which saves the Main Buffer image at the end of the coalescing time window opened by the first change, and only if it differs from the image already saved. A burst of changes wears the flash based stores with a single write, and a brown-out or watchdog reset restores the outputs as they were latched up to coalesceMs milliseconds before it.
     * 
-    * @note resetBit(n) is a synonym for digitalWriteSr(n, LOW), and is provided for shortening and using more meaningful name in the code.
+    * @param storePtr Pointer to the store, see SRGXStateStore and it's derived classes. The store must remain valid for the object's lifetime.
+    * @param coalesceMs Optional parameter. Coalescing time window, in milliseconds (default 1000). 0 saves every change, appropriate for the RTC memory store.
+    * 
+    * @retval true The store was set.
+    * @retval false The object was already begun, or storePtr was nullptr.
+    * 
+    * @note Must be invoked before begin(uint8_t*).
+    * @note The image persisted is the logical one, so a pins remapping set (see setPinsRemap(const uint8_t*, const bool&)) is applied to the restored image as well.
     */
-   bool resetBit(const uint8_t &srPin);
+   bool setStateStore(SRGXStateStore* storePtr, const uint32_t &coalesceMs = 1000);
    /**
-    * @brief Sets a specific pin to HIGH (0x01/Set) in the Main Buffer.
+    * @brief Asynchronously sets the value of several scattered (or not) pins in the Main Buffer, according to the provided mask and values.
     * 
-    * @param srPin Pin whose state is to be set. The valid range is 0 <= srPin <= getMaxSRGXPin()
-    * @retval true The pin was in the valid range and was set to HIGH (0x01/Set) in the Main Buffer.
-    * @retval false The pin was not in the valid range, and no action was taken.
+    * The asynchronous version of stampMaskOverMain(uint8_t*, uint8_t*): the mask and values are queued, and the method returns without waiting for the Main Buffer to be modified nor flushed, see SRGXAsyncHndl. The writes queued are applied in order, with the Main Buffer mutex taken, by the flushing task or by the next Main Buffer operation, and flushed together.
     * 
-    * @note setBit(n) is a synonym for digitalWriteSr(n, HIGH), and is provided for shortening and using more meaningful name in the code.
+    * @param maskPtr Pointer to the mask array, getSrQty() bytes long.
+    * @param valsPtr Pointer to the values array, getSrQty() bytes long.
+    * 
+    * @return The completion handle of the write, invalid if the parameters were nullptr, the object was not begun, or the flushing task could not be created.
+    * 
+    * @attention The write is applied to the Auxiliary Buffer too if it exists when the write is applied, so moving it does not overwrite the write, see moveAuxToMain().
+    * 
+    * @note The pins reserved by other objects (see isPinReserved()) keep their value.
     */
-   bool setBit(const uint8_t &srPin);
+   SRGXAsyncHndl stampAsync(uint8_t* maskPtr, uint8_t* valsPtr);
    /**
     * @brief Sets the value of several scattered (or not) pins in the Main Buffer, according to the provided mask and values.
     * 
@@ -493,8 +1907,23 @@ public:
     * 
     * @retval true Main Buffer was modified with the new values and flushed to the shift registers.
     * @retval false Main Buffer was not modified, either because the parameters provided were not valid or because the operation failed for some other reason.
+    * 
+    * @note The pins reserved by other objects (see isPinReserved()) keep their value.
     */
    bool stampMaskOverMain(uint8_t* maskPtr, uint8_t* valsPtr);
+   /**
+    * @brief Sets the value of several scattered (or not) pins in a snapshot slot, according to the provided mask and values.
+    * 
+    * If the slot was empty it is staged first with the Main Buffer contents.
+    * 
+    * @param slot Index of the snapshot slot.
+    * @param maskPtr Pointer to the mask array, getSrQty() bytes long, each bit set indicates the corresponding pin is to be modified.
+    * @param valsPtr Pointer to the values array, getSrQty() bytes long.
+    * 
+    * @retval true The slot was modified.
+    * @retval false The slot index was not valid, the parameters were nullptr, or the mutexes could not be taken.
+    */
+   bool stampMaskOverSnapshot(const uint8_t &slot, uint8_t* maskPtr, uint8_t* valsPtr);
    /**
    * @brief Sets all of the output pins of the shift register to new provided values at once.  
    * 
@@ -508,6 +1937,8 @@ public:
    * @attention If there was an ongoing set of deferred pin modifications through the use of writes to the Auxiliary they will be all lost, as the first data consistency prevention of the method is to discard the Auxiliary.  
    * 
    * @warning As soon as the Main is overwritten with the new values, the Buffer will be flushed.  
+   * 
+   * @note The pins reserved by other objects (see isPinReserved()) keep their value.
    */
    bool stampOverMain(uint8_t* newCntntPtr);
    /**
@@ -523,13 +1954,77 @@ public:
     * @retval true The segment was set in the Main Buffer and the Buffer was flushed.  
     * @retval false The segment could not be set in the Main Buffer, either because the parameters provided were not valid or because the operation failed for some other reason.  
     * 
-    * @note The intended behavior of the method is to present the resulting Main in a single operation, so the method will make all the segment modifications to the Main Buffer before flushing it. If the Auxiliary Buffer contains any pending modifications, they will be moved to the Main Buffer before the segment stamping execution.  
+    * @note The intended behavior of the method is to present the resulting Main in a single operation, so the method will make all the segment modifications to the Main Buffer before flushing it. If the Auxiliary Buffer contains any pending modifications, they will be moved to the Main Buffer before the segment stamping execution. The pins reserved by other objects (see isPinReserved()) keep their value.
     * 
     * @warning The method expects newSgmntPtr to point to a valid memory area containing the data to be set in the segment. If the pointer is nullptr/NULL, the method will return false and no operation will be performed.
     * 
     * @attention Although the method, as all similar methods in the class, expects the data pointed by newSgmntPtr to be the same length as the Main Buffer, it will only use the first pinsQty bits of the data pointed by newSgmntPtr, so the data pointed by newSgmntPtr must be at least pinsQty bits long, that means that the data pointed by newSgmntPtr must be at least ceil(pinsQty / 8) bytes long. 
     */
    bool stampSgmntOverMain(uint8_t* newSgmntPtr, const uint8_t &strtPin, const uint8_t &pinsQty);
+   /**
+    * @brief Toggles a list of pins, in a single Main Buffer mutex taking and a single flush.
+    * 
+    * @param pinsPtr Pointer to the list of pins. The valid range for each pin is 0 <= pin <= getMaxSRGXPin().
+    * @param pinsQty Number of pins in the list.
+    * 
+    * @retval true The pins were toggled and flushed.
+    * @retval false The list was a nullptr or empty, or a pin was out of range or reserved by other object (see isPinReserved()), no pin was modified.
+    * 
+    * @note A pin listed twice is toggled twice, i.e. it keeps it's state.
+    */
+   bool toggleMany(const uint8_t* pinsPtr, const size_t &pinsQty);
+   /**
+    * @brief Captures the inputs without modifying the outputs.
+    * 
+    * Flushes the Main Buffer -which leaves the outputs unchanged- to run a clock train that captures the input chain, see beginInput(const uint8_t&, const uint8_t&, const uint8_t&).
+    * 
+    * @retval true The inputs were captured and published to the Input Image.
+    * @retval false No input chain was set, or the Main Buffer mutex could not be taken.
+    */
+   bool updateInputs();
+   /**
+    * @brief Asynchronously sets the value of a specific pin in the Main Buffer.
+    * 
+    * The asynchronous version of digitalWriteSr(const uint8_t&, const uint8_t&): the write is queued, and the method returns without waiting for the Main Buffer to be modified nor flushed. The writes queued are applied with the Main Buffer mutex taken, by the flushing task dedicated to the object or by the next Main Buffer operation, and flushed coalesced in a single flush, see SRGXAsyncHndl.
+    * 
+    * @param srPin The pin to be set. The valid range is 0 <= srPin <= getMaxSRGXPin().
+    * @param value The value to set the pin to, LOW (0x00) or HIGH (any other value).
+    * 
+    * @return The completion handle of the write, invalid if the pin was out of range or reserved by other object (see isPinReserved()), the object was not begun, or the flushing task could not be created.
+    * 
+    * @attention The write is applied to the Auxiliary Buffer too if it exists when the write is applied, so moving it does not overwrite the write, see moveAuxToMain().
+    */
+   SRGXAsyncHndl writeAsync(const uint8_t &srPin, const uint8_t &value);
+   /**
+    * @brief Sets the values of a list of pins, in a single Main Buffer mutex taking and a single flush.
+    * 
+    * The bulk alternative to a loop of digitalWriteSr(const uint8_t&, const uint8_t&) invocations -each one taking the mutexes and flushing the Main Buffer- for irregular updates, with no need to build the mask and values arrays required by stampMaskOverMain(uint8_t*, uint8_t*).
+    * 
+    * Consecutive items belonging to the same shift register are merged in a single masked write of the Main Buffer, so lists sorted by pin number are applied a register at a time. If a pin is listed more than once, the last value listed is the one set.
+    * 
+    * @param itemsPtr Pointer to the list of pin and value pairs. The valid range for each pin is 0 <= pin <= getMaxSRGXPin().
+    * @param itemsQty Number of items in the list.
+    * 
+    * @retval true The pins were set and flushed.
+    * @retval false The list was a nullptr or empty, or a pin was out of range or reserved by other object (see isPinReserved()), no pin was modified.
+    */
+   bool writeMany(const SRGXPinValue* itemsPtr, const size_t &itemsQty);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Scatter/gather lookup tables for one of the shift registers involved in a scatter/gather SRGXVPort.
+ * 
+ * The tables implement the PDEP/PEXT-like permutation between the virtual port value and the shift register bits, a nibble at a time to keep the tables small.
+ * 
+ * @struct SRGXVPortSctrReg
+ */
+struct SRGXVPortSctrReg{
+   uint8_t bffrIdx;  // Main Buffer index of the shift register
+   uint8_t bffrMsk;  // Shift register bits belonging to the virtual port
+   uint8_t sctrTbl[4][16]; // sctrTbl[n][v]: shift register bits set by the value v of the virtual port nibble n
+   uint16_t gthrTbl[2][16];   // gthrTbl[n][v]: virtual port bits set by the value v of the shift register nibble n
 };
 
 //==========================================================>>
@@ -543,6 +2038,8 @@ public:
  * 
  * A simple example use case is a crossroads traffic light controller, four different traffic lights, one for each direction, totalling 12 pins, might be solved by using a ShiftRegGPIOXpander object with 2 shift registers. Using the ShiftRegGPIOXpander object directly would require the user to remember that the first pin of the first traffic light is pin 0, the second traffic light starts at pin 3, and so on. Using a SRGXVPort object for each traffic light would allow the user to create a virtual port for each traffic light. Pin 0 of each virtual port would be the red light, pin 1 would be the yellow light, and pin 2 would be the green light. The user would then be able to use the virtual port objects to manipulate the traffic lights without having to convert each light to the real pin numbers in the ShiftRegGPIOXpander object, and make the addition of new traffic lights easier, as the managing methods would be the same for each virtual port.  
  * 
+ * @note A virtual port might also be built from a list of non contiguous pins, see ShiftRegGPIOXpander::createSRGXSctrVPort(const uint8_t*, const uint8_t&). Those **scatter/gather** virtual ports provide the same API as the contiguous ones.  
+ * 
  * @note The SRGXVPort class has set a maximum of 16 pins that can be used in each virtual port. The number of pins assigned will be checked against the maximum number of pins available in the ShiftRegGPIOXpander object.  
  * 
  * @note The open possibility of creating virtual ports that overlap pins in the ShiftRegGPIOXpander object is not considered a problem, even if one virtual port includes all the pins of another virtual port. Take as an example the case of the x86 Intel processors, where the 64-bits registers are a superset of the 32-bits registers, the 32-bits registers are a superset of the 16-bits registers and the 16-bits are superset of 8-bits registers, with the possibility of managing the 64 bits at once or subsets by using the corresponding designations provided. The user can manage the virtual ports as they see fit, but the library will not provide any mechanism to prevent overlapping virtual ports.  
@@ -575,10 +2072,53 @@ private:
    The value is used to enforce the range of valid values. */
    uint16_t _vportMaxVal{0};
    bool _begun{false}; // Flag to indicate if the virtual port has been begun, i.e. if the begin() method has been called and the initial state of the virtual port has been set.
+   bool _exclusive{false}; // Flag to indicate the virtual port pins are reserved for it's exclusive use, and written without taking the ShiftRegGPIOXpander Main Buffer mutex
+   uint8_t* _sctrPinsLstPtr{nullptr};  // Pins list of a scatter/gather virtual port, nullptr for contiguous virtual ports
+   SRGXVPortSctrReg* _sctrRegsPtr{nullptr};  // Scatter/gather lookup tables, one for each shift register involved
+   uint8_t _sctrRegsQty{0};
    bool _buildSRGXVPortMsk(uint8_t* &maskPtr);
+   void _buildSctrTbls();
+   void _releaseSRGXVPortRsrcs();
+   void _takeSRGXVPortRsrcs(SRGXVPort &other);
+   uint8_t _vportPinToSRGXPin(const uint8_t &srPin);
+   /*SRGXVPortRmwOp: Read-modify-write operations executed by _rmwPort()*/
+   enum SRGXVPortRmwOp : uint8_t{
+      _rmwInc,
+      _rmwIncSat,
+      _rmwDec,
+      _rmwDecSat,
+      _rmwRotL,
+      _rmwRotR,
+      _rmwShftL,
+      _rmwShftR,
+      _rmwAnd,
+      _rmwOr,
+      _rmwXor,
+      _rmwCmpXchg
+   };
+   /**
+    * @brief Reads the virtual port value straight from the Main Buffer, the calling party is expected to have the Main Buffer mutex taken.
+    */
+   uint16_t _readPortVal();
+   /**
+    * @brief Executes a read-modify-write operation over the virtual port value.
+    * 
+    * The virtual port value is read, modified and written back to the Main Buffer under a single Main Buffer mutex taking, and the Main Buffer is flushed once if the value was modified.  
+    * 
+    * @param rmwOp The operation to execute.
+    * @param opArg The first operand of the operation.
+    * @param opArg2 The second operand of the operation, only used by the compare-and-swap operation.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t _rmwPort(const SRGXVPortRmwOp &rmwOp, const uint16_t &opArg, const uint16_t &opArg2 = 0);
+   /**
+    * @brief Writes the virtual port value straight to the Main Buffer without flushing it, the calling party is expected to have the Main Buffer mutex taken.
+    */
+   void _writePortVal(const uint16_t &newPortVal);
 
 protected:
-   SemaphoreHandle_t _SRGXVPortMskMtx; // Mutex to protect the Auxiliary Buffer from concurrent access
+   SemaphoreHandle_t _SRGXVPortMskMtx{nullptr}; // Mutex to protect the Auxiliary Buffer from concurrent access
 
    /**
     * @brief Default constructor
@@ -596,18 +2136,91 @@ protected:
     * @attention This constructor is not accesible but through the ShiftRegGPIOXpander class, as it is a protected constructor. The user should use the createSRGXVPort(uint8_t&, uint8_t&) method to create a SRGXVPort object.
     */
    SRGXVPort(ShiftRegGPIOXpander* SRGXPtr, uint8_t strtPin, uint8_t pinsQty);
+   /**
+    * @brief Class constructor for scatter/gather virtual ports
+    * 
+    * This constructor will instantiate a virtual port object whose pins are an arbitrary list of the ShiftRegGPIOXpander pins. The pins list is validated and copied, and the scatter/gather lookup tables are built.
+    * 
+    * @param SRGXPtr A pointer to the ShiftRegGPIOXpander object that will provide the resources (pins) for the virtual port.  
+    * @param pinsLstPtr Pointer to the list of ShiftRegGPIOXpander pins, the first pin listed will be pin 0 of the virtual port, and so on.
+    * @param pinsQty The number of pins in the list. 
+    * 
+    * @attention This constructor is not accesible but through the ShiftRegGPIOXpander class, as it is a protected constructor. The user should use the createSRGXSctrVPort(const uint8_t*, const uint8_t&) method to create a scatter/gather SRGXVPort object.
+    */
+   SRGXVPort(ShiftRegGPIOXpander* SRGXPtr, const uint8_t* pinsLstPtr, uint8_t pinsQty);
 
 public:
+   /**
+    * @brief Copy constructor, deleted.
+    * 
+    * A SRGXVPort object owns it's stamp mask and it's mutex, a copy would share both resources with the original object, leading to a double release of the resources when both objects are destructed. The SRGXVPort objects are move-only objects, see SRGXVPort(SRGXVPort&&).
+    */
+   SRGXVPort(const SRGXVPort&) = delete;
+   /**
+    * @brief Move constructor
+    * 
+    * Transfers the ownership of the resources (ShiftRegGPIOXpander pointer, pins range, stamp mask and mutex) from the source object to the new object. No memory allocation is involved in the operation. The source object is left in the same state as an invalid SRGXVPort object, see ShiftRegGPIOXpander::isValid(SRGXVPort&).
+    * 
+    * @param other The SRGXVPort object whose resources will be transferred.
+    * 
+    * @note The move constructor makes it possible to return SRGXVPort objects by value, as the createSRGXVPort(const uint8_t&, const uint8_t&) method does, and to store them in containers.
+    */
+   SRGXVPort(SRGXVPort&& other) noexcept;
    /**
     * @brief Class destructor
     */
    ~SRGXVPort();
+   /**
+    * @brief Copy assignment operator, deleted.
+    * 
+    * See SRGXVPort(const SRGXVPort&) for the reasons of the deletion.
+    */
+   SRGXVPort& operator=(const SRGXVPort&) = delete;
+   /**
+    * @brief Move assignment operator
+    * 
+    * Releases the resources owned by the object, and then transfers the ownership of the resources from the source object, as described for the SRGXVPort(SRGXVPort&&) move constructor. The mechanism allows to rebuild a virtual port at runtime, i.e. `myVPort = srgx.createSRGXVPort(newStrtPin, newPinsQty);`.
+    * 
+    * @param other The SRGXVPort object whose resources will be transferred.
+    * @return A reference to the object.
+    * 
+    * @attention After the assignment the object is not begun, unless the source object was, so the begin(uint16_t) method must be invoked before using it if it was created by createSRGXVPort(const uint8_t&, const uint8_t&).
+    */
+   SRGXVPort& operator=(SRGXVPort&& other) noexcept;
    /**
     * @brief Begins the virtual port, setting the initial state of the VPort pins.
     * 
     * @param initCntnt Initial value to be loaded into the virtual port. 
     */
    bool begin(uint16_t initCntnt);
+   /**
+    * @brief Atomically applies a bitwise AND with the provided mask to the virtual port value.
+    * 
+    * The virtual port value is read, modified and written under a single ShiftRegGPIOXpander Main Buffer mutex taking, and flushed once, so no other writer can modify the virtual port pins in between. The same mechanism is used by every read-modify-write method of the class.
+    * 
+    * @param andMsk The mask to AND the virtual port value with.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t andPort(const uint16_t &andMsk);
+   /**
+    * @brief Atomically compares the virtual port value with an expected value, and if they are equal sets it to a new value.
+    * 
+    * @param expctdVal The value the virtual port is expected to hold.
+    * @param newPortVal The value to set the virtual port to if it holds the expected value. The valid range is 0 <= newPortVal <= getVPortMaxVal().
+    * 
+    * @return The virtual port value previous to the operation. The operation succeeded if the value returned is equal to expctdVal.
+    */
+   uint16_t cmpXchgPort(const uint16_t &expctdVal, const uint16_t &newPortVal);
+   /**
+    * @brief Atomically decrements the virtual port value.
+    * 
+    * @param decVal Optional parameter. The value to subtract from the virtual port value, 1 if not provided.
+    * @param saturate Optional parameter. If true the result is limited to 0, if false (default) the result wraps around modulo (getVPortMaxVal() + 1).
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t decPort(const uint16_t &decVal = 1, const bool &saturate = false);
    /**
     * @brief Returns the state of the requested pin of the virtual port (SRGXVPort).
     * 
@@ -682,6 +2295,30 @@ public:
     * @return uint16_t Maximum value that can be set in the virtual port.
     */
    uint16_t getVPortMaxVal();
+   /**
+    * @brief Atomically increments the virtual port value.
+    * 
+    * @param incVal Optional parameter. The value to add to the virtual port value, 1 if not provided.
+    * @param saturate Optional parameter. If true the result is limited to getVPortMaxVal(), if false (default) the result wraps around modulo (getVPortMaxVal() + 1).
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t incPort(const uint16_t &incVal = 1, const bool &saturate = false);
+   /**
+    * @brief Returns the exclusive use condition of the virtual port pins.
+    * 
+    * @retval true The virtual port pins are reserved for it's exclusive use, see reservePins().
+    * @retval false The virtual port pins are not reserved.
+    */
+   bool isExclusive();
+   /**
+    * @brief Atomically applies a bitwise OR with the provided mask to the virtual port value.
+    * 
+    * @param orMsk The mask to OR the virtual port value with, bits beyond the virtual port width are ignored.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t orPort(const uint16_t &orMsk);
    /**
     * @brief Reads the state of the virtual port as an integer value.
     * 
@@ -690,6 +2327,26 @@ public:
     * @return The state of the virtual port as an unsigned integer value, where each bit represents the state of a pin in the virtual port.
     */
    uint16_t readPort();   
+   /**
+    * @brief Releases the virtual port pins reservation made by reservePins().
+    * 
+    * After releasing, the virtual port writes go back to the regular mutex protected ShiftRegGPIOXpander methods. The reservation is automatically released when the object is destructed or assigned.
+    * 
+    * @retval true The reservation was released.
+    * @retval false The virtual port pins were not reserved.
+    */
+   bool releasePins();
+   /**
+    * @brief Reserves the virtual port pins for it's exclusive use.
+    * 
+    * Once reserved, no other SRGXVPort of the same ShiftRegGPIOXpander can reserve any of the pins, proving the exclusive virtual ports are disjoint. The writes of an exclusive virtual port (writePort(uint16_t), digitalWriteSr(const uint8_t&, const uint8_t&), setBit(const uint8_t&), resetBit(const uint8_t&), flipBit(const uint8_t&)) modify the Main Buffer through atomic masked operations without taking the ShiftRegGPIOXpander Main Buffer mutex, only the flush is serialized. Independent tasks owning their own exclusive ports won't contend with each other but for the flush.  
+    * 
+    * @retval true The pins were reserved.
+    * @retval false The virtual port is not valid or not begun, or at least one of it's pins was already reserved by another virtual port.
+    * 
+    * @attention Each exclusive virtual port is meant to be written by a single task. The ShiftRegGPIOXpander methods might still modify the reserved pins, but the Auxiliary Buffer contents will not be moved over them, see ShiftRegGPIOXpander::moveAuxToMain().  
+    */
+   bool reservePins();
    /**
     * @brief Sets the state of a pin to LOW (0x00/Reset) in the virtual port.
     * 
@@ -698,6 +2355,22 @@ public:
     * @return false The pin was not in the valid range, and no action was taken.
     */
    bool resetBit(const uint8_t &srPin);
+   /**
+    * @brief Atomically rotates the virtual port value to the left, within the virtual port width.
+    * 
+    * @param bitsQty Optional parameter. Number of positions to rotate, 1 if not provided.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t rotLPort(const uint8_t &bitsQty = 1);
+   /**
+    * @brief Atomically rotates the virtual port value to the right, within the virtual port width.
+    * 
+    * @param bitsQty Optional parameter. Number of positions to rotate, 1 if not provided.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t rotRPort(const uint8_t &bitsQty = 1);
    /**
     * @brief Sets the state of a pin to HIGH (0x01/Set) in the virtual port.
     * 
@@ -706,6 +2379,22 @@ public:
     * @return false The pin was not in the valid range, and no action was taken.
     */
    bool setBit(const uint8_t &srPin);
+   /**
+    * @brief Atomically shifts the virtual port value to the left, filling with 0, the bits shifted beyond the virtual port width are lost.
+    * 
+    * @param bitsQty Optional parameter. Number of positions to shift, 1 if not provided.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t shftLPort(const uint8_t &bitsQty = 1);
+   /**
+    * @brief Atomically shifts the virtual port value to the right, filling with 0.
+    * 
+    * @param bitsQty Optional parameter. Number of positions to shift, 1 if not provided.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t shftRPort(const uint8_t &bitsQty = 1);
    /**
     * @brief Sets the state of the pins in the Main Buffer (i.e. the GPIOXpander pins) according to the provided value.
     * 
@@ -715,6 +2404,84 @@ public:
     * @return 
     */
    bool writePort(uint16_t newPortVal);
+   /**
+    * @brief Asynchronously sets the state of the virtual port pins according to the provided value.
+    * 
+    * The asynchronous version of writePort(uint16_t): the method returns without waiting for the flush, see ShiftRegGPIOXpander::writeAsync(const uint8_t&, const uint8_t&) and SRGXAsyncHndl. The pins of an exclusive port are modified through atomic masked operations, the writes of a non exclusive port are queued like ShiftRegGPIOXpander::stampAsync(uint8_t*, uint8_t*) ones.
+    * 
+    * @param newPortVal The value to set the virtual port to. The valid range is 0 <= newPortVal <= getVPortMaxVal().
+    * 
+    * @return The completion handle of the write, invalid if the value was out of range, the virtual port is not valid, or the flushing task could not be created.
+    */
+   SRGXAsyncHndl writePortAsync(const uint16_t &newPortVal);
+   /**
+    * @brief Atomically applies a bitwise XOR with the provided mask to the virtual port value.
+    * 
+    * @param xorMsk The mask to XOR the virtual port value with, bits beyond the virtual port width are ignored.
+    * 
+    * @return The virtual port value previous to the operation.
+    */
+   uint16_t xorPort(const uint16_t &xorMsk);
+};
+
+//==========================================================>>
+
+/**
+ * @brief A class that models **Input Virtual Ports** from the input chain of a ShiftRegGPIOXpander object.  
+ * 
+ * The **Input Virtual Ports** are contiguous sets of input pins read as a single value, with their pins numbered from 0 to pinsQty - 1. The values are taken from the Input Image of the ShiftRegGPIOXpander object, see ShiftRegGPIOXpander::beginInput(const uint8_t&, const uint8_t&, const uint8_t&), so all the pins of a reading belong to the same capture, and the readings take no mutex.  
+ * 
+ * The objects own no resources, they might be freely copied.  
+ * 
+ * @class SRGXInVPort
+ */
+class SRGXInVPort{
+private:
+   ShiftRegGPIOXpander* _SRGXPtr{nullptr};
+   uint8_t _strtPin{0};
+   uint8_t _pinsQty{0};
+   uint16_t _vportMaxVal{0};
+   const uint8_t _maxPortPinsQty{16};
+
+public:
+   /**
+    * @brief Default constructor
+    */
+   SRGXInVPort();
+   /**
+    * @brief Class constructor
+    * 
+    * @param SRGXPtr Pointer to the ShiftRegGPIOXpander object whose input chain provides the pins.
+    * @param strtPin First input pin of the virtual port.
+    * @param pinsQty Number of pins of the virtual port. The valid range is 1 <= pinsQty <= 16.
+    * 
+    * @note If the parameters are not valid the object is built as an invalid object, whose getSRGXPtr() returns nullptr.
+    */
+   SRGXInVPort(ShiftRegGPIOXpander* SRGXPtr, const uint8_t &strtPin, const uint8_t &pinsQty);
+   /**
+    * @brief Returns the captured state of a virtual port pin.
+    * 
+    * @param inPin Virtual port pin. The valid range is 0 <= inPin < pinsQty.
+    * 
+    * @retval LOW The pin state captured was LOW
+    * @retval HIGH The pin state captured was HIGH
+    * @retval -1 ERROR, the object is not valid or the pin number was out of range.
+    */
+   int digitalRead(const uint8_t &inPin);
+   /**
+    * @brief Returns the pointer to the ShiftRegGPIOXpander object providing the input pins, or nullptr for an invalid object.
+    */
+   ShiftRegGPIOXpander* getSRGXPtr();
+   /**
+    * @brief Returns the maximum value the virtual port might read, (2^pinsQty) - 1.
+    */
+   uint16_t getVPortMaxVal();
+   /**
+    * @brief Returns the captured value of the virtual port.
+    * 
+    * @return The value of the virtual port pins, pin 0 being the LSB, or 0 for an invalid object.
+    */
+   uint16_t readPort();
 };
 
 //==========================================================>>